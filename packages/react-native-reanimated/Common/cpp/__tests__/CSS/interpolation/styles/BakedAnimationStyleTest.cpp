@@ -0,0 +1,346 @@
+#include <reanimated/CSS/interpolation/styles/BakedAnimationStyle.h>
+
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace reanimated::css {
+
+namespace {
+
+using InterpolateFunction = BakedAnimationStyle::InterpolateFunction;
+using ValuePath = BakedAnimationStyle::ValuePath;
+
+constexpr size_t ACCURACY_CHECKS_COUNT = 1000;
+
+bool isColorPath(const ValuePath &path) {
+  return !path.empty() && path.front() == "color";
+}
+
+bool neverColor(const ValuePath &) {
+  return false;
+}
+
+std::shared_ptr<const BakedAnimationStyle> bake(
+    const InterpolateFunction &interpolate,
+    const BakedAnimationStyle::IsColorFunction &isColor = neverColor) {
+  return BakedAnimationStyle::bake(interpolate, isColor);
+}
+
+std::string formatAngle(const double radians) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(4) << radians;
+  return stream.str() + "rad";
+}
+
+int64_t toColorValue(const uint32_t color) {
+  return static_cast<int32_t>(color);
+}
+
+// Interpolates colors in the same way as CSSColor (rgb channels of the other
+// color are used when interpolating from/to transparent), keyframe colors are
+// returned as they are
+uint32_t interpolateColor(uint32_t from, uint32_t to, const double progress) {
+  if (progress <= 0) {
+    return from;
+  }
+  if (progress >= 1) {
+    return to;
+  }
+  if (from == 0) {
+    from = to & 0x00FFFFFF;
+  } else if (to == 0) {
+    to = from & 0x00FFFFFF;
+  }
+  uint32_t result = 0;
+  for (int shift = 0; shift < 32; shift += 8) {
+    const auto fromChannel = static_cast<double>((from >> shift) & 0xFF);
+    const auto toChannel = static_cast<double>((to >> shift) & 0xFF);
+    const auto channel =
+        std::round(fromChannel + (toChannel - fromChannel) * progress);
+    result |= static_cast<uint32_t>(channel) << shift;
+  }
+  return result;
+}
+
+double maxChannelError(const int64_t expected, const int64_t actual) {
+  double error = 0;
+  for (int shift = 0; shift < 32; shift += 8) {
+    const auto expectedChannel =
+        static_cast<double>((static_cast<uint32_t>(expected) >> shift) & 0xFF);
+    const auto actualChannel =
+        static_cast<double>((static_cast<uint32_t>(actual) >> shift) & 0xFF);
+    error = std::max(error, std::abs(expectedChannel - actualChannel));
+  }
+  return error;
+}
+
+template <typename TCheck>
+void forEachProgress(TCheck &&check) {
+  for (size_t i = 0; i <= ACCURACY_CHECKS_COUNT; ++i) {
+    check(static_cast<double>(i) / ACCURACY_CHECKS_COUNT);
+  }
+}
+
+} // namespace
+
+TEST(BakedAnimationStyleTest, bakesNumbersWithinTolerance) {
+  // Overshooting easing, similar to cubic-bezier(0.3, -0.5, 0.7, 1.5)
+  const auto interpolate = [](const double progress) -> folly::dynamic {
+    const auto eased = progress + 0.8 * std::sin(2 * M_PI * progress);
+    return folly::dynamic::object("opacity", eased)(
+        "transform",
+        folly::dynamic::array(folly::dynamic::object("scale", 2 * eased)));
+  };
+
+  const auto bakedStyle = bake(interpolate);
+  ASSERT_NE(bakedStyle, nullptr);
+  EXPECT_LE(
+      bakedStyle->getMaxNumberError(), BakedAnimationStyle::NUMBER_TOLERANCE);
+
+  forEachProgress([&](const double progress) {
+    const auto expected = interpolate(progress);
+    const auto actual = bakedStyle->evaluate(progress);
+    EXPECT_NEAR(
+        actual["opacity"].getDouble(),
+        expected["opacity"].getDouble(),
+        BakedAnimationStyle::NUMBER_TOLERANCE);
+    EXPECT_NEAR(
+        actual["transform"][0]["scale"].getDouble(),
+        expected["transform"][0]["scale"].getDouble(),
+        BakedAnimationStyle::NUMBER_TOLERANCE);
+  });
+}
+
+TEST(BakedAnimationStyleTest, escalatesIntervalsCountUntilToleranceIsMet) {
+  // The error of the linear blend of a parabola sampled with n intervals is
+  // 100 / (4 * n^2), so the tolerance is met with 256 intervals
+  const auto bakedStyle = bake([](const double progress) -> folly::dynamic {
+    return folly::dynamic::object("width", 100 * progress * progress);
+  });
+  ASSERT_NE(bakedStyle, nullptr);
+  EXPECT_EQ(bakedStyle->getIntervalsCount(), 256);
+
+  const auto linearStyle = bake([](const double progress) -> folly::dynamic {
+    return folly::dynamic::object("width", 100 * progress);
+  });
+  ASSERT_NE(linearStyle, nullptr);
+  EXPECT_EQ(
+      linearStyle->getIntervalsCount(),
+      BakedAnimationStyle::INITIAL_INTERVALS_COUNT);
+}
+
+TEST(BakedAnimationStyleTest, bakesColorsWithinTolerance) {
+  constexpr uint32_t from = 0xFF2040E0;
+  constexpr uint32_t to = 0x80E02010;
+  const auto interpolate = [](const double progress) -> folly::dynamic {
+    return folly::dynamic::object(
+        "color", toColorValue(interpolateColor(from, to, progress)));
+  };
+
+  const auto bakedStyle = bake(interpolate, isColorPath);
+  ASSERT_NE(bakedStyle, nullptr);
+
+  forEachProgress([&](const double progress) {
+    EXPECT_LE(
+        maxChannelError(
+            interpolate(progress)["color"].getInt(),
+            bakedStyle->evaluate(progress)["color"].getInt()),
+        BakedAnimationStyle::COLOR_CHANNEL_TOLERANCE);
+  });
+}
+
+TEST(BakedAnimationStyleTest, bakesColorsWithTransparentEndpoints) {
+  constexpr uint32_t color = 0xFF3366CC;
+  for (const auto &[from, to] :
+       std::vector<std::pair<uint32_t, uint32_t>>{{0, color}, {color, 0}}) {
+    const auto interpolate = [from, to](
+                                 const double progress) -> folly::dynamic {
+      return folly::dynamic::object(
+          "color", toColorValue(interpolateColor(from, to, progress)));
+    };
+
+    const auto bakedStyle = bake(interpolate, isColorPath);
+    ASSERT_NE(bakedStyle, nullptr);
+
+    forEachProgress([&](const double progress) {
+      EXPECT_LE(
+          maxChannelError(
+              interpolate(progress)["color"].getInt(),
+              bakedStyle->evaluate(progress)["color"].getInt()),
+          BakedAnimationStyle::COLOR_CHANNEL_TOLERANCE);
+    });
+    EXPECT_EQ(bakedStyle->evaluate(from == 0 ? 0 : 1)["color"].getInt(), 0);
+  }
+}
+
+TEST(BakedAnimationStyleTest, bakesAnglesWithinTolerance) {
+  const auto interpolate = [](const double progress) -> folly::dynamic {
+    return folly::dynamic::object(
+        "transform",
+        folly::dynamic::array(folly::dynamic::object(
+            "rotate", formatAngle(2 * M_PI * progress * progress))));
+  };
+
+  const auto bakedStyle = bake(interpolate);
+  ASSERT_NE(bakedStyle, nullptr);
+
+  forEachProgress([&](const double progress) {
+    const auto &expected =
+        interpolate(progress)["transform"][0]["rotate"].getString();
+    const auto actual =
+        bakedStyle->evaluate(progress)["transform"][0]["rotate"].getString();
+    EXPECT_TRUE(actual.ends_with("rad"));
+    EXPECT_NEAR(
+        std::stod(actual),
+        std::stod(expected),
+        BakedAnimationStyle::NUMBER_TOLERANCE);
+  });
+}
+
+TEST(BakedAnimationStyleTest, switchesDiscreteValuesAtNearestSample) {
+  const auto bakedStyle = bake([](const double progress) -> folly::dynamic {
+    return folly::dynamic::object("display", progress < 0.3 ? "flex" : "none");
+  });
+  ASSERT_NE(bakedStyle, nullptr);
+
+  const auto halfInterval =
+      0.5 / static_cast<double>(bakedStyle->getIntervalsCount());
+  EXPECT_EQ(bakedStyle->evaluate(0.3 - 2 * halfInterval)["display"], "flex");
+  EXPECT_EQ(bakedStyle->evaluate(0.3 + 2 * halfInterval)["display"], "none");
+}
+
+TEST(BakedAnimationStyleTest, rejectsDiscreteValuesChangingBetweenSamples) {
+  // The value changes a few times within every interval, even with the max
+  // intervals count
+  const auto bakedStyle = bake([](const double progress) -> folly::dynamic {
+    const auto step = static_cast<int64_t>(progress * 5000);
+    return folly::dynamic::object("zIndex", step % 7);
+  });
+  EXPECT_EQ(bakedStyle, nullptr);
+}
+
+TEST(BakedAnimationStyleTest, rejectsStepsEasing) {
+  // steps(4)
+  const auto bakedStyle = bake([](const double progress) -> folly::dynamic {
+    return folly::dynamic::object(
+        "opacity", std::floor(progress * 4 + 0.5) / 4);
+  });
+  EXPECT_EQ(bakedStyle, nullptr);
+}
+
+TEST(BakedAnimationStyleTest, rejectsStyleStructureChanges) {
+  const auto withRemovedProperty = [](const double progress) {
+    folly::dynamic style = folly::dynamic::object("opacity", progress);
+    if (progress < 0.5) {
+      style["width"] = 100 * progress;
+    }
+    return style;
+  };
+  EXPECT_EQ(bake(withRemovedProperty), nullptr);
+
+  const auto withChangedType = [](const double progress) -> folly::dynamic {
+    return folly::dynamic::object(
+        "width",
+        progress < 0.5 ? folly::dynamic(100 * progress)
+                       : folly::dynamic(formatAngle(progress)));
+  };
+  EXPECT_EQ(bake(withChangedType), nullptr);
+}
+
+class BakedAnimationStylesCacheTest : public ::testing::Test {
+ protected:
+  std::vector<std::function<void()>> scheduledJobs_;
+  std::shared_ptr<BakedAnimationStylesCache> cache_ =
+      std::make_shared<BakedAnimationStylesCache>(
+          [this](std::function<void()> &&job) {
+            scheduledJobs_.push_back(std::move(job));
+          });
+  int bakesCount_ = 0;
+
+  BakedAnimationStylesCache::BakeFunction makeBakeFunction(
+      const bool canBake = true) {
+    return [this, canBake]() -> std::shared_ptr<const BakedAnimationStyle> {
+      bakesCount_++;
+      if (!canBake) {
+        return nullptr;
+      }
+      return bake([](const double progress) -> folly::dynamic {
+        return folly::dynamic::object("opacity", progress);
+      });
+    };
+  }
+
+  void runScheduledJobs() {
+    auto jobs = std::move(scheduledJobs_);
+    scheduledJobs_.clear();
+    for (auto &job : jobs) {
+      job();
+    }
+  }
+};
+
+TEST_F(BakedAnimationStylesCacheTest, bakesStyleOnlyOnTheScheduler) {
+  EXPECT_FALSE(cache_->getOrScheduleBake("linear", makeBakeFunction()));
+  EXPECT_FALSE(cache_->getOrScheduleBake("linear", makeBakeFunction()));
+  EXPECT_EQ(bakesCount_, 0);
+  ASSERT_EQ(scheduledJobs_.size(), 1);
+
+  runScheduledJobs();
+  const auto bakedStyle =
+      cache_->getOrScheduleBake("linear", makeBakeFunction());
+  ASSERT_TRUE(bakedStyle.has_value());
+  EXPECT_NE(bakedStyle.value(), nullptr);
+  EXPECT_EQ(bakesCount_, 1);
+  EXPECT_GT(cache_->getRetainedBytes(), 0);
+}
+
+TEST_F(BakedAnimationStylesCacheTest, doesNotRetryStylesThatCannotBeBaked) {
+  cache_->getOrScheduleBake("steps(4)", makeBakeFunction(false));
+  runScheduledJobs();
+
+  const auto bakedStyle =
+      cache_->getOrScheduleBake("steps(4)", makeBakeFunction(false));
+  ASSERT_TRUE(bakedStyle.has_value());
+  EXPECT_EQ(bakedStyle.value(), nullptr);
+  EXPECT_TRUE(scheduledJobs_.empty());
+  EXPECT_EQ(bakesCount_, 1);
+}
+
+TEST_F(BakedAnimationStylesCacheTest, bakesStylesOfDifferentEasingsSeparately) {
+  cache_->getOrScheduleBake("linear", makeBakeFunction());
+  cache_->getOrScheduleBake("ease-in", makeBakeFunction());
+  EXPECT_EQ(scheduledJobs_.size(), 2);
+}
+
+TEST_F(BakedAnimationStylesCacheTest, bakesOutsideOfTheLock) {
+  // The cache would deadlock here if the bake function ran under its lock
+  std::optional<std::shared_ptr<const BakedAnimationStyle>> nestedResult =
+      std::make_shared<const BakedAnimationStyle>();
+  cache_->getOrScheduleBake("linear", [&]() {
+    nestedResult = cache_->getOrScheduleBake("linear", makeBakeFunction());
+    return nullptr;
+  });
+  runScheduledJobs();
+
+  EXPECT_FALSE(nestedResult.has_value());
+}
+
+TEST_F(BakedAnimationStylesCacheTest, dropsStylesBakedAfterCacheDestruction) {
+  cache_->getOrScheduleBake("linear", makeBakeFunction());
+  cache_.reset();
+
+  runScheduledJobs();
+  EXPECT_EQ(bakesCount_, 1);
+}
+
+} // namespace reanimated::css
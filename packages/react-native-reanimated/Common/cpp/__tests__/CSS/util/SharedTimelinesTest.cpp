@@ -0,0 +1,140 @@
+#include <reanimated/CSS/util/SharedTimelines.h>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+namespace reanimated::css {
+
+namespace {
+
+const int INTERPOLATOR = 0;
+const int OTHER_INTERPOLATOR = 0;
+const int EASING_FUNCTIONS = 0;
+
+AnimationTimelineKey makeKey(
+    const double progress,
+    const std::string_view easingFunctionKey = "linear",
+    const void *styleInterpolator = &INTERPOLATOR) {
+  return {
+      .styleInterpolator = styleInterpolator,
+      .keyframeEasingFunctions = &EASING_FUNCTIONS,
+      .easingFunctionKey = easingFunctionKey,
+      .progress = progress};
+}
+
+class SharedTimelinesTest : public ::testing::Test {
+ protected:
+  SharedTimelines<std::string> timelines_;
+  int interpolationsCount_ = 0;
+
+  std::string getOrInterpolate(
+      const std::optional<AnimationTimelineKey> &key,
+      const std::string &style = "style") {
+    return timelines_.getOrInterpolate(key, [&]() {
+      interpolationsCount_++;
+      return style;
+    });
+  }
+};
+
+} // namespace
+
+TEST_F(SharedTimelinesTest, interpolatesStyleOnceForTheSameTimeline) {
+  EXPECT_EQ(getOrInterpolate(makeKey(0.5), "first"), "first");
+  EXPECT_EQ(getOrInterpolate(makeKey(0.5), "second"), "first");
+  EXPECT_EQ(getOrInterpolate(makeKey(0.5), "third"), "first");
+
+  EXPECT_EQ(interpolationsCount_, 1);
+}
+
+TEST_F(SharedTimelinesTest, comparesRawProgress) {
+  getOrInterpolate(makeKey(0.5));
+  getOrInterpolate(makeKey(0.5 + 1e-12));
+  getOrInterpolate(makeKey(0.25 + 0.25));
+
+  EXPECT_EQ(interpolationsCount_, 2);
+}
+
+TEST_F(SharedTimelinesTest, comparesEasingFunctionKeysByContent) {
+  // Keys are views of strings owned by different animations
+  const std::string easing = "cubic-bezier(0.1, 0.2, 0.3, 0.4)";
+  const std::string sameEasing = easing;
+  const std::string otherEasing = "ease-in";
+
+  getOrInterpolate(makeKey(0.5, easing));
+  getOrInterpolate(makeKey(0.5, sameEasing));
+  EXPECT_EQ(interpolationsCount_, 1);
+
+  getOrInterpolate(makeKey(0.5, otherEasing));
+  EXPECT_EQ(interpolationsCount_, 2);
+}
+
+TEST_F(SharedTimelinesTest, separatesTimelinesOfDifferentKeyframes) {
+  getOrInterpolate(makeKey(0.5, "linear", &INTERPOLATOR));
+  getOrInterpolate(makeKey(0.5, "linear", &OTHER_INTERPOLATOR));
+
+  EXPECT_EQ(interpolationsCount_, 2);
+}
+
+TEST_F(SharedTimelinesTest, neverSharesViewDependentStyles) {
+  getOrInterpolate(std::nullopt, "first");
+  EXPECT_EQ(getOrInterpolate(std::nullopt, "second"), "second");
+  EXPECT_EQ(interpolationsCount_, 2);
+
+  timelines_.finishFrame();
+  const auto &stats = timelines_.getStats();
+  EXPECT_EQ(stats.sharedTimelinesCount, 0);
+  EXPECT_EQ(stats.sharedAnimationsCount, 0);
+  EXPECT_EQ(stats.exclusiveAnimationsCount, 2);
+}
+
+TEST_F(SharedTimelinesTest, collectsStatsOfTheFinishedFrame) {
+  for (int i = 0; i < 3; ++i) {
+    getOrInterpolate(makeKey(0.1));
+  }
+  for (int i = 0; i < 2; ++i) {
+    getOrInterpolate(makeKey(0.2));
+  }
+  getOrInterpolate(makeKey(0.3));
+  getOrInterpolate(std::nullopt);
+
+  timelines_.finishFrame();
+  const auto &stats = timelines_.getStats();
+  EXPECT_EQ(stats.sharedTimelinesCount, 2);
+  EXPECT_EQ(stats.sharedAnimationsCount, 5);
+  EXPECT_EQ(stats.largestTimelineSize, 3);
+  EXPECT_EQ(stats.exclusiveAnimationsCount, 2);
+}
+
+TEST_F(SharedTimelinesTest, sharesStylesOnlyWithinFrame) {
+  getOrInterpolate(makeKey(0.5), "first");
+  timelines_.finishFrame();
+
+  EXPECT_EQ(getOrInterpolate(makeKey(0.5), "second"), "second");
+  EXPECT_EQ(interpolationsCount_, 2);
+
+  timelines_.finishFrame();
+  EXPECT_EQ(timelines_.getStats().exclusiveAnimationsCount, 1);
+}
+
+TEST(SharedTimelinesStatsTest, mergesStatsOfDifferentThreads) {
+  SharedTimelinesStats stats{
+      .sharedTimelinesCount = 1,
+      .sharedAnimationsCount = 4,
+      .largestTimelineSize = 4,
+      .exclusiveAnimationsCount = 2};
+  stats.merge(
+      {.sharedTimelinesCount = 2,
+       .sharedAnimationsCount = 5,
+       .largestTimelineSize = 3,
+       .exclusiveAnimationsCount = 1});
+
+  EXPECT_EQ(stats.sharedTimelinesCount, 3);
+  EXPECT_EQ(stats.sharedAnimationsCount, 9);
+  EXPECT_EQ(stats.largestTimelineSize, 4);
+  EXPECT_EQ(stats.exclusiveAnimationsCount, 3);
+}
+
+} // namespace reanimated::css
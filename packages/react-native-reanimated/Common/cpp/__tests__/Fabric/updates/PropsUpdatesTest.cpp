@@ -0,0 +1,53 @@
+#include <reanimated/Fabric/updates/PropsUpdates.h>
+
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace reanimated {
+
+TEST(PropsUpdatesTest, returnsEmptyObjectWithoutUpdates) {
+  EXPECT_EQ(mergePropsUpdates({}), folly::dynamic(folly::dynamic::object));
+}
+
+TEST(PropsUpdatesTest, keepsPropsUpdatedByOneRegistry) {
+  const std::vector<folly::dynamic> updates = {
+      folly::dynamic::object("opacity", 0.5),
+      folly::dynamic::object("width", 100)};
+
+  const folly::dynamic expected =
+      folly::dynamic::object("opacity", 0.5)("width", 100);
+  EXPECT_EQ(mergePropsUpdates(updates), expected);
+}
+
+TEST(PropsUpdatesTest, laterRegistriesOverrideEarlierOnes) {
+  // In the order of priority of registries: CSS transitions, animated props
+  // and CSS animations
+  const std::vector<folly::dynamic> updates = {
+      folly::dynamic::object("opacity", 0.1)("width", 10)("height", 10),
+      folly::dynamic::object("opacity", 0.2)("width", 20),
+      folly::dynamic::object("opacity", 0.3)};
+
+  const folly::dynamic expected =
+      folly::dynamic::object("opacity", 0.3)("width", 20)("height", 10);
+  EXPECT_EQ(mergePropsUpdates(updates), expected);
+}
+
+TEST(PropsUpdatesTest, overridesNestedPropsAsWhole) {
+  const std::vector<folly::dynamic> updates = {
+      folly::dynamic::object(
+          "transform",
+          folly::dynamic::array(
+              folly::dynamic::object("scale", 2),
+              folly::dynamic::object("rotate", "1rad")))(
+          "shadowOffset", folly::dynamic::object("width", 1)("height", 2)),
+      folly::dynamic::object(
+          "transform",
+          folly::dynamic::array(folly::dynamic::object("translateX", 5)))(
+          "shadowOffset", folly::dynamic::object("width", 3))};
+
+  EXPECT_EQ(mergePropsUpdates(updates), updates.back());
+}
+
+} // namespace reanimated
@@ -0,0 +1,138 @@
+#include <reanimated/Fabric/updates/UpdateRate.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+constexpr double FRAME_INTERVAL_MS = 1000.0 / 60;
+
+// Returns indices of frames in which an item with the given rate is updated
+std::vector<int> getUpdatedFrames(
+    const UpdateRate &updateRate,
+    const int framesCount,
+    const double frameIntervalMs = FRAME_INTERVAL_MS) {
+  UpdateRateClock clock;
+  double lastUpdateTimestamp = NEVER_UPDATED_TIMESTAMP;
+  std::vector<int> frames;
+
+  for (int i = 0; i < framesCount; ++i) {
+    clock.advance(i * frameIntervalMs);
+    if (clock.isDue(updateRate, lastUpdateTimestamp)) {
+      lastUpdateTimestamp = clock.getTimestamp();
+      frames.push_back(i);
+    }
+  }
+
+  return frames;
+}
+
+} // namespace
+
+TEST(UpdateRateTest, parsesNamedRates) {
+  EXPECT_EQ(parseUpdateRate("full"), UpdateRate::full());
+  EXPECT_EQ(parseUpdateRate("half"), UpdateRate::half());
+  EXPECT_THROW(parseUpdateRate("quarter"), std::invalid_argument);
+}
+
+TEST(UpdateRateTest, parsesUpdatesPerSecond) {
+  EXPECT_EQ(parseUpdateRate(24.0), UpdateRate::fixed(24));
+  EXPECT_THROW(parseUpdateRate(0.0), std::invalid_argument);
+  EXPECT_THROW(parseUpdateRate(-30.0), std::invalid_argument);
+  EXPECT_THROW(parseUpdateRate(std::nan("")), std::invalid_argument);
+}
+
+TEST(UpdateRateClockTest, updatesFullRateInEveryFrame) {
+  EXPECT_EQ(getUpdatedFrames(UpdateRate::full(), 60).size(), 60);
+}
+
+TEST(UpdateRateClockTest, updatesHalfRateInEveryOtherFrame) {
+  const auto frames = getUpdatedFrames(UpdateRate::half(), 60);
+
+  ASSERT_EQ(frames.size(), 30);
+  for (size_t i = 1; i < frames.size(); ++i) {
+    EXPECT_EQ(frames[i] - frames[i - 1], 2);
+  }
+}
+
+TEST(UpdateRateClockTest, updatesFixedRateTheGivenNumberOfTimesPerSecond) {
+  EXPECT_EQ(getUpdatedFrames(UpdateRate::fixed(10), 60).size(), 10);
+  EXPECT_EQ(
+      getUpdatedFrames(UpdateRate::fixed(10), 120, 1000.0 / 120).size(), 10);
+}
+
+TEST(UpdateRateClockTest, updatesFixedRateAboveDisplayRateInEveryFrame) {
+  EXPECT_EQ(getUpdatedFrames(UpdateRate::fixed(120), 60).size(), 60);
+}
+
+TEST(UpdateRateClockTest, updatesNeverUpdatedItemImmediately) {
+  UpdateRateClock clock;
+  clock.advance(FRAME_INTERVAL_MS);
+
+  EXPECT_TRUE(clock.isDue(UpdateRate::fixed(1), NEVER_UPDATED_TIMESTAMP));
+}
+
+TEST(UpdateRateClockTest, alignsItemsWithTheSameRateToTheSameFrames) {
+  UpdateRateClock clock;
+  double firstLastUpdate = NEVER_UPDATED_TIMESTAMP;
+  double secondLastUpdate = NEVER_UPDATED_TIMESTAMP;
+  const auto updateRate = UpdateRate::fixed(15);
+
+  for (int i = 0; i < 120; ++i) {
+    clock.advance(i * FRAME_INTERVAL_MS);
+    const auto firstDue = clock.isDue(updateRate, firstLastUpdate);
+    if (firstDue) {
+      firstLastUpdate = clock.getTimestamp();
+    }
+    // The second item starts a few frames later
+    if (i < 3) {
+      continue;
+    }
+    const auto secondDue = clock.isDue(updateRate, secondLastUpdate);
+    if (secondDue) {
+      secondLastUpdate = clock.getTimestamp();
+    }
+    if (i > 3) {
+      EXPECT_EQ(firstDue, secondDue) << "frame " << i;
+    }
+  }
+}
+
+TEST(UpdateRateClockTest, toleratesFrameTimestampJitter) {
+  UpdateRateClock clock;
+  double lastUpdateTimestamp = NEVER_UPDATED_TIMESTAMP;
+  std::vector<int> frames;
+
+  for (int i = 0; i < 60; ++i) {
+    const auto jitterMs = i % 2 == 0 ? 0.8 : -0.8;
+    clock.advance(i * FRAME_INTERVAL_MS + jitterMs);
+    if (clock.isDue(UpdateRate::half(), lastUpdateTimestamp)) {
+      lastUpdateTimestamp = clock.getTimestamp();
+      frames.push_back(i);
+    }
+  }
+
+  ASSERT_EQ(frames.size(), 30);
+  for (size_t i = 1; i < frames.size(); ++i) {
+    EXPECT_EQ(frames[i] - frames[i - 1], 2);
+  }
+}
+
+TEST(UpdateRateClockTest, ignoresPausesWhenEstimatingFrameInterval) {
+  UpdateRateClock clock;
+  clock.advance(0);
+  clock.advance(FRAME_INTERVAL_MS);
+  clock.advance(2000);
+
+  // If the pause were taken as the frame interval, every rate would be
+  // treated as the full one
+  EXPECT_FALSE(
+      clock.isDue(UpdateRate::fixed(30), 2000 - FRAME_INTERVAL_MS / 4));
+}
+
+} // namespace reanimated
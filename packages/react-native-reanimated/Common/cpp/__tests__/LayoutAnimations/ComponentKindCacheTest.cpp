@@ -0,0 +1,42 @@
+#include <reanimated/LayoutAnimations/ComponentKindCache.h>
+
+#include <gtest/gtest.h>
+
+namespace reanimated {
+
+namespace {
+
+const ComponentKindCache::ComponentHandle ROOT_HANDLE = 1;
+
+class ComponentKindCacheTest : public ::testing::Test {
+ protected:
+  ComponentKindCache cache_{ROOT_HANDLE};
+};
+
+} // namespace
+
+TEST_F(ComponentKindCacheTest, recognizesRootByHandle) {
+  EXPECT_EQ(cache_.get(ROOT_HANDLE, "RootView"), ComponentKind::Root);
+  // The name of the root component doesn't matter
+  EXPECT_EQ(cache_.get(ROOT_HANDLE, "View"), ComponentKind::Root);
+}
+
+TEST_F(ComponentKindCacheTest, recognizesScreensByName) {
+  EXPECT_EQ(cache_.get(2, "RNSScreenStack"), ComponentKind::RNSScreen);
+  EXPECT_EQ(cache_.get(3, "RNSScreen"), ComponentKind::RNSScreen);
+  EXPECT_EQ(cache_.get(4, "RNSModalScreen"), ComponentKind::RNSScreen);
+  EXPECT_EQ(cache_.get(5, "RNSScreenContainer"), ComponentKind::Other);
+  EXPECT_EQ(cache_.get(6, "View"), ComponentKind::Other);
+}
+
+TEST_F(ComponentKindCacheTest, comparesNameOncePerHandle) {
+  EXPECT_EQ(cache_.get(2, "RNSScreen"), ComponentKind::RNSScreen);
+  EXPECT_EQ(cache_.get(3, "View"), ComponentKind::Other);
+
+  // Handles identify component types, so names aren't compared again
+  EXPECT_EQ(cache_.get(2, "View"), ComponentKind::RNSScreen);
+  EXPECT_EQ(cache_.get(3, "RNSScreen"), ComponentKind::Other);
+  EXPECT_EQ(cache_.get(3, "RNSScreen"), ComponentKind::Other);
+}
+
+} // namespace reanimated
@@ -0,0 +1,63 @@
+#include <reanimated/LayoutAnimations/PreparedEnteringViews.h>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+namespace reanimated {
+
+namespace {
+
+const int SURFACE_ID = 1;
+const int OTHER_SURFACE_ID = 11;
+
+class PreparedEnteringViewsTest : public ::testing::Test {
+ protected:
+  PreparedEnteringViews<std::string> views_;
+};
+
+} // namespace
+
+TEST_F(PreparedEnteringViewsTest, takesPreparedValueOnlyOnce) {
+  views_.prepare(SURFACE_ID, 2, 5, "props");
+
+  EXPECT_EQ(views_.take(2), std::optional<std::string>("props"));
+  EXPECT_EQ(views_.take(2), std::nullopt);
+  EXPECT_EQ(views_.take(3), std::nullopt);
+}
+
+TEST_F(PreparedEnteringViewsTest, replacesValuePreparedByOlderCommit) {
+  views_.prepare(SURFACE_ID, 2, 5, "old props");
+  views_.prepare(SURFACE_ID, 2, 6, "new props");
+
+  EXPECT_EQ(views_.take(2), std::optional<std::string>("new props"));
+}
+
+TEST_F(PreparedEnteringViewsTest, clearsValuesOfCoalescedCommits) {
+  // Commits creating revisions 5 and 6 are mounted by one transaction, which
+  // (like every transaction) has its own number unrelated to the revisions
+  views_.prepare(SURFACE_ID, 2, 5, "first commit");
+  views_.prepare(SURFACE_ID, 4, 6, "second commit");
+  // Committed while the transaction was being mounted
+  views_.prepare(SURFACE_ID, 6, 7, "next commit");
+
+  views_.clearMounted(SURFACE_ID, 6);
+
+  EXPECT_EQ(views_.size(), 1);
+  EXPECT_EQ(views_.take(2), std::nullopt);
+  EXPECT_EQ(views_.take(4), std::nullopt);
+  EXPECT_EQ(views_.take(6), std::optional<std::string>("next commit"));
+}
+
+TEST_F(PreparedEnteringViewsTest, clearsOnlyValuesOfMountedSurface) {
+  views_.prepare(SURFACE_ID, 2, 5, "props");
+  views_.prepare(OTHER_SURFACE_ID, 12, 2, "other props");
+
+  views_.clearMounted(SURFACE_ID, 5);
+
+  EXPECT_EQ(views_.take(2), std::nullopt);
+  EXPECT_EQ(views_.take(12), std::optional<std::string>("other props"));
+}
+
+} // namespace reanimated
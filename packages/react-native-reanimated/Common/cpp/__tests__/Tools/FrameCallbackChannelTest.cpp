@@ -0,0 +1,118 @@
+#include <reanimated/Tools/FrameCallbackChannel.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+// Stands in for the platform: counts frame requests and lets the test decide
+// when the frame is delivered
+class FakeFrameSource {
+ public:
+  FrameCallbackChannel::RequestPlatformFrameFunction requestFunction() {
+    return [this]() { requestedFramesCount++; };
+  }
+
+  size_t requestedFramesCount = 0;
+};
+
+} // namespace
+
+TEST(FrameCallbackChannelTest, coalescesRequestsIntoSinglePlatformFrame) {
+  FakeFrameSource frameSource;
+  FrameCallbackChannel channel(frameSource.requestFunction());
+
+  std::vector<double> timestamps;
+  for (int i = 0; i < 3; ++i) {
+    channel.requestFrame([&](double ts) { timestamps.push_back(ts); });
+  }
+  EXPECT_EQ(frameSource.requestedFramesCount, 1);
+
+  channel.onFrame(16);
+  EXPECT_EQ(timestamps, (std::vector<double>{16, 16, 16}));
+
+  // The channel is empty again, so the next request asks for a new frame
+  channel.requestFrame([](double) {});
+  EXPECT_EQ(frameSource.requestedFramesCount, 2);
+}
+
+TEST(FrameCallbackChannelTest, runsCallbacksInOrderOfRequests) {
+  FakeFrameSource frameSource;
+  FrameCallbackChannel channel(frameSource.requestFunction());
+
+  std::vector<int> order;
+  for (int i = 0; i < 5; ++i) {
+    channel.requestFrame([&order, i](double) { order.push_back(i); });
+  }
+  channel.onFrame(16);
+
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(FrameCallbackChannelTest, runsCallbacksRequestedDuringFrameInNextFrame) {
+  FakeFrameSource frameSource;
+  FrameCallbackChannel channel(frameSource.requestFunction());
+
+  std::vector<double> timestamps;
+  channel.requestFrame([&](double ts) {
+    timestamps.push_back(ts);
+    channel.requestFrame([&](double ts) { timestamps.push_back(ts); });
+  });
+
+  channel.onFrame(16);
+  EXPECT_EQ(timestamps, (std::vector<double>{16}));
+  EXPECT_EQ(frameSource.requestedFramesCount, 2);
+
+  channel.onFrame(32);
+  EXPECT_EQ(timestamps, (std::vector<double>{16, 32}));
+
+  // Nothing is pending, so an empty frame runs nothing
+  channel.onFrame(48);
+  EXPECT_EQ(timestamps, (std::vector<double>{16, 32}));
+  EXPECT_EQ(frameSource.requestedFramesCount, 2);
+}
+
+TEST(FrameCallbackChannelTest, releasesPendingCallbacksWhenDestroyed) {
+  FakeFrameSource frameSource;
+  auto captured = std::make_shared<int>(0);
+  {
+    FrameCallbackChannel channel(frameSource.requestFunction());
+    channel.requestFrame([captured](double) {});
+    channel.requestFrame([captured](double) {});
+    EXPECT_EQ(captured.use_count(), 3);
+  }
+  EXPECT_EQ(captured.use_count(), 1);
+}
+
+TEST(FrameCallbackChannelTest, acceptsRequestsFromManyThreads) {
+  FakeFrameSource frameSource;
+  FrameCallbackChannel channel(frameSource.requestFunction());
+
+  constexpr int THREADS_COUNT = 4;
+  constexpr int REQUESTS_PER_THREAD = 1000;
+  std::atomic<int> runCount = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < THREADS_COUNT; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < REQUESTS_PER_THREAD; ++j) {
+        channel.requestFrame([&](double) { runCount++; });
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  channel.onFrame(16);
+  EXPECT_EQ(runCount, THREADS_COUNT * REQUESTS_PER_THREAD);
+  EXPECT_EQ(frameSource.requestedFramesCount, 1);
+}
+
+} // namespace reanimated
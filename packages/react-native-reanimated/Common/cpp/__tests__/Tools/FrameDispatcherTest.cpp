@@ -0,0 +1,219 @@
+#include <reanimated/Tools/FrameDispatcher.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Stands in for the platform requestRender: keeps the requested frame
+// callbacks and lets the test decide when the frame is delivered
+class FakeRenderer {
+ public:
+  FrameDispatcher::RequestRenderFunction requestFunction() {
+    return [this](std::function<void(const double)> callback) {
+      frameCallbacks.push_back(std::move(callback));
+    };
+  }
+
+  void deliverFrame(const double timestampMs) {
+    auto callbacks = std::move(frameCallbacks);
+    frameCallbacks.clear();
+    for (const auto &callback : callbacks) {
+      callback(timestampMs);
+    }
+  }
+
+  std::vector<std::function<void(const double)>> frameCallbacks;
+};
+
+class FrameDispatcherTest : public ::testing::Test {
+ protected:
+  FakeRenderer renderer_;
+  std::shared_ptr<FrameDispatcher> dispatcher_ =
+      std::make_shared<FrameDispatcher>(renderer_.requestFunction());
+  std::vector<FramePhase> runPhases_;
+
+  void recordAllPhases() {
+    for (const auto phase :
+         {FramePhase::FrameCallbacks,
+          FramePhase::LayoutAnimations,
+          FramePhase::CSS,
+          FramePhase::Commit}) {
+      dispatcher_->setPhaseCallback(
+          phase, [this, phase](double) { runPhases_.push_back(phase); });
+    }
+  }
+};
+
+} // namespace
+
+TEST_F(FrameDispatcherTest, runsRequestedPhasesInFixedOrder) {
+  recordAllPhases();
+  dispatcher_->requestPhase(FramePhase::Commit);
+  dispatcher_->requestPhase(FramePhase::CSS);
+  dispatcher_->requestPhase(FramePhase::LayoutAnimations);
+  dispatcher_->requestPhase(FramePhase::FrameCallbacks);
+
+  renderer_.deliverFrame(16);
+
+  EXPECT_EQ(
+      runPhases_,
+      (std::vector<FramePhase>{
+          FramePhase::FrameCallbacks,
+          FramePhase::LayoutAnimations,
+          FramePhase::CSS,
+          FramePhase::Commit}));
+}
+
+TEST_F(FrameDispatcherTest, runsOnlyRequestedPhases) {
+  recordAllPhases();
+  dispatcher_->requestPhase(FramePhase::CSS);
+
+  renderer_.deliverFrame(16);
+
+  EXPECT_EQ(runPhases_, std::vector<FramePhase>{FramePhase::CSS});
+}
+
+TEST_F(FrameDispatcherTest, passesFrameTimestampToPhases) {
+  double timestamp = 0;
+  dispatcher_->setPhaseCallback(
+      FramePhase::FrameCallbacks, [&](const double ts) { timestamp = ts; });
+  dispatcher_->requestPhase(FramePhase::FrameCallbacks);
+
+  renderer_.deliverFrame(123.5);
+
+  EXPECT_EQ(timestamp, 123.5);
+}
+
+TEST_F(FrameDispatcherTest, mergesRequestsIntoSinglePlatformFrame) {
+  recordAllPhases();
+  dispatcher_->requestPhase(FramePhase::FrameCallbacks);
+  dispatcher_->requestPhase(FramePhase::CSS);
+  dispatcher_->requestPhase(FramePhase::CSS);
+  dispatcher_->requestFrame();
+
+  EXPECT_EQ(renderer_.frameCallbacks.size(), 1);
+  const auto stats = dispatcher_->getStats();
+  EXPECT_EQ(stats.framesCount, 1);
+  EXPECT_EQ(stats.mergedRequestsCount, 3);
+
+  renderer_.deliverFrame(16);
+  EXPECT_EQ(runPhases_.size(), 2);
+}
+
+TEST_F(FrameDispatcherTest, runsPhasesRequestedDuringFrameInNextFrame) {
+  int cssRunsCount = 0;
+  dispatcher_->setPhaseCallback(FramePhase::CSS, [&](double) {
+    cssRunsCount++;
+    // Loops request their next frame from their phase callback
+    dispatcher_->requestPhase(FramePhase::CSS);
+  });
+  dispatcher_->requestPhase(FramePhase::CSS);
+
+  renderer_.deliverFrame(16);
+  EXPECT_EQ(cssRunsCount, 1);
+  EXPECT_EQ(renderer_.frameCallbacks.size(), 1);
+
+  renderer_.deliverFrame(32);
+  EXPECT_EQ(cssRunsCount, 2);
+  const auto stats = dispatcher_->getStats();
+  // The second frame requested the third one
+  EXPECT_EQ(stats.framesCount, 3);
+  EXPECT_EQ(stats.mergedRequestsCount, 0);
+  EXPECT_EQ(stats.css.runsCount, 2);
+}
+
+TEST_F(FrameDispatcherTest, recordsDurationsOfPhases) {
+  dispatcher_->setPhaseCallback(
+      FramePhase::LayoutAnimations,
+      [](double) { std::this_thread::sleep_for(2ms); });
+
+  for (int i = 0; i < 3; ++i) {
+    dispatcher_->requestPhase(FramePhase::LayoutAnimations);
+    renderer_.deliverFrame(16 * (i + 1));
+  }
+
+  const auto stats = dispatcher_->getStats().layoutAnimations;
+  EXPECT_EQ(stats.runsCount, 3);
+  EXPECT_GE(stats.lastDurationMs, 2);
+  EXPECT_GE(stats.maxDurationMs, stats.lastDurationMs);
+  EXPECT_GE(stats.totalDurationMs, 6);
+  EXPECT_EQ(dispatcher_->getStats().css.runsCount, 0);
+}
+
+TEST_F(FrameDispatcherTest, attributesCommitToCommitPhaseOfLastFrame) {
+  dispatcher_->setPhaseCallback(
+      FramePhase::Commit, [](double) { std::this_thread::sleep_for(2ms); });
+  dispatcher_->requestPhase(FramePhase::Commit);
+  renderer_.deliverFrame(16);
+
+  // The commit phase isn't recorded until the commit runs
+  EXPECT_EQ(dispatcher_->getStats().commit.runsCount, 0);
+
+  bool committed = false;
+  dispatcher_->runCommit([&]() {
+    committed = true;
+    std::this_thread::sleep_for(2ms);
+  });
+
+  EXPECT_TRUE(committed);
+  const auto stats = dispatcher_->getStats().commit;
+  EXPECT_EQ(stats.runsCount, 1);
+  // Both the phase callback and the commit are accounted
+  EXPECT_GE(stats.lastDurationMs, 4);
+}
+
+TEST_F(FrameDispatcherTest, doesNotRecordCommitsOutsideOfFrames) {
+  int commitsCount = 0;
+  dispatcher_->runCommit([&]() { commitsCount++; });
+
+  // Only the first commit after a frame belongs to it
+  dispatcher_->requestFrame();
+  renderer_.deliverFrame(16);
+  dispatcher_->runCommit([&]() { commitsCount++; });
+  dispatcher_->runCommit([&]() { commitsCount++; });
+
+  EXPECT_EQ(commitsCount, 3);
+  EXPECT_EQ(dispatcher_->getStats().commit.runsCount, 1);
+}
+
+TEST_F(FrameDispatcherTest, ignoresFramesDeliveredAfterDestruction) {
+  bool called = false;
+  dispatcher_->setPhaseCallback(
+      FramePhase::FrameCallbacks, [&](double) { called = true; });
+  dispatcher_->requestPhase(FramePhase::FrameCallbacks);
+
+  dispatcher_.reset();
+  renderer_.deliverFrame(16);
+
+  EXPECT_FALSE(called);
+}
+
+#ifndef NDEBUG
+
+TEST(FrameDispatcherDeathTest, assertsUseOnSingleThread) {
+  ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+  EXPECT_DEATH(
+      {
+        FakeRenderer renderer;
+        const auto dispatcher =
+            std::make_shared<FrameDispatcher>(renderer.requestFunction());
+        dispatcher->requestFrame();
+        std::thread([&]() { dispatcher->requestFrame(); }).join();
+      },
+      "must be used on the UI thread");
+}
+
+#endif // NDEBUG
+
+} // namespace reanimated
@@ -0,0 +1,57 @@
+#include <reanimated/Tools/GroupByKey.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace reanimated {
+
+TEST(GroupByKeyTest, groupsEntriesInAscendingOrderOfKeys) {
+  std::vector<std::pair<int, std::string>> entries = {
+      {3, "a"}, {1, "b"}, {3, "c"}, {2, "d"}, {1, "e"}, {3, "f"}};
+  std::vector<std::pair<int, std::vector<std::string>>> groups;
+
+  forEachGroupByKey(entries, [&](const int key, auto begin, const auto end) {
+    auto &group = groups.emplace_back(key, std::vector<std::string>{}).second;
+    for (; begin != end; ++begin) {
+      group.push_back(begin->second);
+    }
+  });
+
+  const std::vector<std::pair<int, std::vector<std::string>>> expected = {
+      {1, {"b", "e"}}, {2, {"d"}}, {3, {"a", "c", "f"}}};
+  EXPECT_EQ(groups, expected);
+}
+
+TEST(GroupByKeyTest, allowsMovingValuesOutOfGroups) {
+  std::vector<std::pair<int, std::unique_ptr<int>>> entries;
+  entries.emplace_back(2, std::make_unique<int>(20));
+  entries.emplace_back(1, std::make_unique<int>(10));
+  entries.emplace_back(2, std::make_unique<int>(21));
+  std::vector<std::unique_ptr<int>> values;
+
+  forEachGroupByKey(entries, [&](int, auto begin, const auto end) {
+    for (; begin != end; ++begin) {
+      values.push_back(std::move(begin->second));
+    }
+  });
+
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(*values[0], 10);
+  EXPECT_EQ(*values[1], 20);
+  EXPECT_EQ(*values[2], 21);
+}
+
+TEST(GroupByKeyTest, doesNothingForNoEntries) {
+  std::vector<std::pair<int, int>> entries;
+  int groupsCount = 0;
+
+  forEachGroupByKey(entries, [&](int, auto, auto) { ++groupsCount; });
+
+  EXPECT_EQ(groupsCount, 0);
+}
+
+} // namespace reanimated
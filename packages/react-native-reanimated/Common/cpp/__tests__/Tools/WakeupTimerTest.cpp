@@ -0,0 +1,122 @@
+#include <reanimated/Tools/WakeupTimer.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+namespace reanimated {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr auto SHORT_DELAY = 20ms;
+// Generous, so that the tests don't flake on loaded machines
+constexpr auto TIMEOUT = 5s;
+
+} // namespace
+
+TEST(WakeupTimerTest, runsCallbackAfterDeadline) {
+  WakeupTimer timer;
+  std::promise<WakeupTimer::Clock::time_point> fired;
+
+  const auto deadline = WakeupTimer::Clock::now() + SHORT_DELAY;
+  timer.arm(deadline, [&]() { fired.set_value(WakeupTimer::Clock::now()); });
+  EXPECT_TRUE(timer.isArmed());
+
+  auto firedFuture = fired.get_future();
+  ASSERT_EQ(firedFuture.wait_for(TIMEOUT), std::future_status::ready);
+  EXPECT_GE(firedFuture.get(), deadline);
+  EXPECT_FALSE(timer.isArmed());
+}
+
+TEST(WakeupTimerTest, rearmingReplacesPreviousWakeup) {
+  WakeupTimer timer;
+  std::atomic_int replacedRuns = 0;
+  std::promise<void> fired;
+
+  timer.arm(
+      WakeupTimer::Clock::now() + SHORT_DELAY, [&]() { ++replacedRuns; });
+  // Both an earlier and a later deadline replace the armed one
+  timer.arm(WakeupTimer::Clock::now() + 1h, [&]() { ++replacedRuns; });
+  timer.arm(
+      WakeupTimer::Clock::now() + 2 * SHORT_DELAY,
+      [&]() { fired.set_value(); });
+
+  ASSERT_EQ(
+      fired.get_future().wait_for(TIMEOUT), std::future_status::ready);
+  EXPECT_EQ(replacedRuns, 0);
+}
+
+TEST(WakeupTimerTest, cancelPreventsCallback) {
+  WakeupTimer timer;
+  std::atomic_int runs = 0;
+
+  timer.arm(WakeupTimer::Clock::now() + SHORT_DELAY, [&]() { ++runs; });
+  EXPECT_TRUE(timer.cancel());
+  EXPECT_FALSE(timer.isArmed());
+  // Nothing is armed anymore
+  EXPECT_FALSE(timer.cancel());
+
+  std::this_thread::sleep_for(3 * SHORT_DELAY);
+  EXPECT_EQ(runs, 0);
+}
+
+TEST(WakeupTimerTest, canBeArmedAgainFromCallback) {
+  WakeupTimer timer;
+  std::atomic_int runs = 0;
+  std::promise<void> firedTwice;
+
+  timer.arm(WakeupTimer::Clock::now(), [&]() {
+    ++runs;
+    timer.arm(WakeupTimer::Clock::now() + SHORT_DELAY, [&]() {
+      ++runs;
+      firedTwice.set_value();
+    });
+  });
+
+  ASSERT_EQ(
+      firedTwice.get_future().wait_for(TIMEOUT), std::future_status::ready);
+  EXPECT_EQ(runs, 2);
+}
+
+TEST(WakeupTimerTest, destructorDoesNotWaitForArmedWakeup) {
+  std::atomic_int runs = 0;
+  const auto start = WakeupTimer::Clock::now();
+  {
+    WakeupTimer timer;
+    timer.arm(start + 1h, [&]() { ++runs; });
+  }
+
+  EXPECT_LT(WakeupTimer::Clock::now() - start, TIMEOUT);
+  EXPECT_EQ(runs, 0);
+}
+
+TEST(WakeupTimerTest, destructorJoinsThreadRunningCallback) {
+  std::promise<void> started;
+  std::atomic_bool finished = false;
+  {
+    WakeupTimer timer;
+    timer.arm(WakeupTimer::Clock::now(), [&]() {
+      started.set_value();
+      std::this_thread::sleep_for(2 * SHORT_DELAY);
+      finished = true;
+    });
+    ASSERT_EQ(
+        started.get_future().wait_for(TIMEOUT), std::future_status::ready);
+  }
+
+  EXPECT_TRUE(finished);
+}
+
+TEST(WakeupTimerTest, canBeDestroyedWithoutArming) {
+  const auto timer = std::make_unique<WakeupTimer>();
+  EXPECT_FALSE(timer->isArmed());
+  EXPECT_FALSE(timer->cancel());
+}
+
+} // namespace reanimated
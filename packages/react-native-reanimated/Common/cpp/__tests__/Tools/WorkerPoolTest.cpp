@@ -0,0 +1,87 @@
+#include <reanimated/Tools/WorkerPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace reanimated {
+
+TEST(WorkerPoolTest, runsEveryTaskOnce) {
+  WorkerPool pool(4);
+  std::vector<std::atomic_int> runs(100);
+
+  pool.run(runs.size(), [&](const size_t taskIndex) { ++runs[taskIndex]; });
+
+  for (const auto &count : runs) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+TEST(WorkerPoolTest, canBeReusedForManyRuns) {
+  WorkerPool pool(3);
+  std::atomic_int total = 0;
+
+  for (int i = 0; i < 1000; ++i) {
+    pool.run(5, [&](size_t) { ++total; });
+  }
+
+  EXPECT_EQ(total, 5000);
+}
+
+TEST(WorkerPoolTest, rethrowsExceptionOfTask) {
+  WorkerPool pool(2);
+  std::atomic_int finished = 0;
+
+  EXPECT_THROW(
+      pool.run(
+          10,
+          [&](const size_t taskIndex) {
+            if (taskIndex == 3) {
+              throw std::runtime_error("task failed");
+            }
+            ++finished;
+          }),
+      std::runtime_error);
+  EXPECT_EQ(finished, 9);
+}
+
+TEST(WorkerPoolTest, splitsItemsIntoContiguousChunks) {
+  WorkerPool pool(4);
+  std::vector<std::atomic_int> runs(10);
+
+  pool.runInChunks(
+      runs.size(), [&](size_t, const size_t begin, const size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          ++runs[i];
+        }
+      });
+
+  EXPECT_EQ(pool.getChunksCount(runs.size()), 4);
+  for (const auto &count : runs) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+TEST(WorkerPoolTest, createsNoMoreChunksThanItems) {
+  WorkerPool pool(8);
+
+  EXPECT_EQ(pool.getChunksCount(3), 3);
+  EXPECT_EQ(pool.getChunksCount(0), 0);
+}
+
+TEST(WorkerPoolTest, runsOnCallingThreadWithSingleThread) {
+  WorkerPool pool(1);
+  const auto callingThread = std::this_thread::get_id();
+  bool ranOnCallingThread = true;
+
+  pool.run(4, [&](size_t) {
+    ranOnCallingThread &= std::this_thread::get_id() == callingThread;
+  });
+
+  EXPECT_EQ(pool.getThreadsCount(), 1);
+  EXPECT_TRUE(ranOnCallingThread);
+}
+
+} // namespace reanimated
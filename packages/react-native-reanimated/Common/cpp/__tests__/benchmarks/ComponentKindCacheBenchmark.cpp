@@ -0,0 +1,101 @@
+#include <reanimated/LayoutAnimations/ComponentKindCache.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+// Stands in for the ShadowView of a removed view
+struct RemovedView {
+  ComponentKindCache::ComponentHandle componentHandle;
+  const char *componentName;
+};
+
+const ComponentKindCache::ComponentHandle ROOT_HANDLE = 1;
+
+// Component types are identified by their index (shifted past the root
+// handle). Views are mostly of the first type and the other 1 in 4 views is
+// of any type, similarly to removed subtrees, which mostly consist of runs of
+// Views.
+std::vector<RemovedView> createRemovedViews(
+    const std::vector<std::string> &componentNames,
+    const int viewsCount) {
+  std::vector<RemovedView> views;
+  views.reserve(viewsCount);
+  for (int i = 0; i < viewsCount; ++i) {
+    const auto typeIndex =
+        i % 4 == 3 ? (i * 7919) % static_cast<int>(componentNames.size()) : 0;
+    views.push_back(
+        {.componentHandle = typeIndex + 2,
+         .componentName = componentNames[typeIndex].c_str()});
+  }
+  return views;
+}
+
+std::vector<std::string> createComponentNames(const int typesCount) {
+  std::vector<std::string> names{"View"};
+  for (int i = 1; i < typesCount; ++i) {
+    names.push_back("Component" + std::to_string(i));
+  }
+  return names;
+}
+
+// Arguments: removed views count, component types count
+void BM_GetComponentKindByName(benchmark::State &state) {
+  const auto names = createComponentNames(static_cast<int>(state.range(1)));
+  const auto views =
+      createRemovedViews(names, static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    // How startAnimationsRecursively checked every removed view before
+    int screensCount = 0;
+    for (const auto &view : views) {
+      if (view.componentHandle != ROOT_HANDLE &&
+          ComponentKindCache::getKindByName(view.componentName) ==
+              ComponentKind::RNSScreen) {
+        screensCount++;
+      }
+    }
+    benchmark::DoNotOptimize(screensCount);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Arguments: removed views count, component types count
+void BM_GetComponentKindFromCache(benchmark::State &state) {
+  const auto names = createComponentNames(static_cast<int>(state.range(1)));
+  const auto views =
+      createRemovedViews(names, static_cast<int>(state.range(0)));
+  // The cache lives as long as the layout animations proxy, so it is warm
+  ComponentKindCache cache(ROOT_HANDLE);
+
+  for (auto _ : state) {
+    int screensCount = 0;
+    for (const auto &view : views) {
+      if (cache.get(view.componentHandle, view.componentName) ==
+          ComponentKind::RNSScreen) {
+        screensCount++;
+      }
+    }
+    benchmark::DoNotOptimize(screensCount);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_GetComponentKindByName)
+    ->ArgsProduct({{10000}, {8, 32, 128}})
+    ->ArgNames({"views", "types"})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_GetComponentKindFromCache)
+    ->ArgsProduct({{10000}, {8, 32, 128}})
+    ->ArgNames({"views", "types"})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace reanimated
@@ -0,0 +1,107 @@
+#include <reanimated/Tools/GroupByKey.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+// Stands in for the MutationNode of a removed view
+struct RemovedNode {
+  int tag;
+  std::vector<std::shared_ptr<RemovedNode>> children;
+};
+
+using RemovedNodes = std::vector<std::shared_ptr<RemovedNode>>;
+
+// Removed views are spread evenly over the parents. A single parent is a list
+// whose children are all removed, many parents are a popped screen.
+RemovedNodes createRemovedNodes(const int nodesCount) {
+  RemovedNodes nodes;
+  nodes.reserve(nodesCount);
+  for (int tag = 0; tag < nodesCount; ++tag) {
+    nodes.push_back(std::make_shared<RemovedNode>(RemovedNode{tag, {}}));
+  }
+  return nodes;
+}
+
+// Scatters the views over the parents, as removals of views with different
+// parents are interleaved in mutation lists
+int getParentTag(const int tag, const int parentsCount) {
+  return (tag * 7919) % parentsCount;
+}
+
+// Arguments: removed views count, parents count
+void BM_GroupRemovedViewsWithHashMap(benchmark::State &state) {
+  const auto nodes = createRemovedNodes(static_cast<int>(state.range(0)));
+  const auto parentsCount = static_cast<int>(state.range(1));
+  std::vector<RemovedNode> parents(parentsCount);
+
+  for (auto _ : state) {
+    // How parseRemoveMutations grouped the views before - one hash map for
+    // the parents and one for the unflattened parents
+    std::unordered_map<int, RemovedNodes> childrenForTag,
+        unflattenedChildrenForTag;
+    for (const auto &node : nodes) {
+      const auto parentTag = getParentTag(node->tag, parentsCount);
+      childrenForTag[parentTag].push_back(node);
+      unflattenedChildrenForTag[parentTag].push_back(node);
+    }
+    for (auto &[parentTag, children] : childrenForTag) {
+      parents[parentTag].children = std::move(children);
+    }
+    for (auto &[parentTag, children] : unflattenedChildrenForTag) {
+      benchmark::DoNotOptimize(children.data());
+    }
+    benchmark::DoNotOptimize(parents.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Arguments: removed views count, parents count
+void BM_GroupRemovedViewsWithFlatVector(benchmark::State &state) {
+  const auto nodes = createRemovedNodes(static_cast<int>(state.range(0)));
+  const auto parentsCount = static_cast<int>(state.range(1));
+  std::vector<RemovedNode> parents(parentsCount);
+
+  for (auto _ : state) {
+    std::vector<std::pair<int, std::shared_ptr<RemovedNode>>> removedChildren;
+    removedChildren.reserve(nodes.size());
+    for (const auto &node : nodes) {
+      removedChildren.emplace_back(getParentTag(node->tag, parentsCount), node);
+    }
+    forEachGroupByKey(
+        removedChildren,
+        [&](const int parentTag, const auto groupBegin, const auto groupEnd) {
+          RemovedNodes children;
+          children.reserve(groupEnd - groupBegin);
+          for (auto it = groupBegin; it != groupEnd; ++it) {
+            children.push_back(std::move(it->second));
+          }
+          auto unflattenedChildren = children;
+          parents[parentTag].children = std::move(children);
+          benchmark::DoNotOptimize(unflattenedChildren.data());
+        });
+    benchmark::DoNotOptimize(parents.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_GroupRemovedViewsWithHashMap)
+    ->ArgsProduct({{10000}, {1, 100, 10000}})
+    ->ArgNames({"views", "parents"})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_GroupRemovedViewsWithFlatVector)
+    ->ArgsProduct({{10000}, {1, 100, 10000}})
+    ->ArgNames({"views", "parents"})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace reanimated
@@ -0,0 +1,49 @@
+#include <reanimated/Tools/WorkerPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace reanimated {
+
+namespace {
+
+// Stands in for the update of the animations of a single view, i.e. the
+// interpolation of a few properties
+double updateView(const size_t viewIndex) {
+  double value = static_cast<double>(viewIndex);
+  for (int i = 0; i < 200; ++i) {
+    value = std::sin(value) + 1.0;
+  }
+  return value;
+}
+
+// Arguments: pool threads count, animated views count
+void BM_WorkerPoolUpdate(benchmark::State &state) {
+  WorkerPool pool(static_cast<size_t>(state.range(0)));
+  const auto viewsCount = static_cast<size_t>(state.range(1));
+  std::vector<double> results(viewsCount);
+
+  for (auto _ : state) {
+    pool.runInChunks(
+        viewsCount, [&](size_t, const size_t begin, const size_t end) {
+          for (auto i = begin; i < end; ++i) {
+            results[i] = updateView(i);
+          }
+        });
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(viewsCount));
+}
+
+} // namespace
+
+BENCHMARK(BM_WorkerPoolUpdate)
+    ->ArgsProduct({{1, 2, 4, 8}, {64, 256, 1024}})
+    ->ArgNames({"threads", "views"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace reanimated
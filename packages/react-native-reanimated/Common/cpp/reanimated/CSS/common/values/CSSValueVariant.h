@@ -147,6 +147,24 @@ class CSSValueVariant final : public CSSValue {
     return std::visit([](const auto &v) { return v.toString(); }, storage_);
   }
 
+  /**
+   * Returns true if the stored value has to be resolved relative to the view
+   * (or its parent) dimensions before it can be used
+   */
+  bool isRelative() const {
+    return std::visit(
+        [](const auto &v) {
+          if constexpr (requires {
+                          { v.isRelative } -> std::convertible_to<bool>;
+                        }) {
+            return static_cast<bool>(v.isRelative);
+          } else {
+            return false;
+          }
+        },
+        storage_);
+  }
+
   /**
    * Interpolate (non-resolvable)
    */
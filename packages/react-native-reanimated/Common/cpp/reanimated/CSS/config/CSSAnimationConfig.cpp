@@ -62,11 +62,13 @@ CSSAnimationSettings parseCSSAnimationSettings(
   return {
       getDuration(rt, settingsObj),
       getTimingFunction(rt, settingsObj),
+      getTimingFunctionKey(rt, settingsObj),
       getDelay(rt, settingsObj),
       getIterationCount(rt, settingsObj),
       getDirection(rt, settingsObj),
       getFillMode(rt, settingsObj),
-      getPlayState(rt, settingsObj)};
+      getPlayState(rt, settingsObj),
+      getUpdateRate(rt, settingsObj)};
 }
 
 PartialCSSAnimationSettings parsePartialCSSAnimationSettings(
@@ -81,6 +83,7 @@ PartialCSSAnimationSettings parsePartialCSSAnimationSettings(
   }
   if (partialObj.hasProperty(rt, "timingFunction")) {
     result.easingFunction = getTimingFunction(rt, partialObj);
+    result.easingFunctionKey = getTimingFunctionKey(rt, partialObj);
   }
   if (partialObj.hasProperty(rt, "delay")) {
     result.delay = getDelay(rt, partialObj);
@@ -97,6 +100,9 @@ PartialCSSAnimationSettings parsePartialCSSAnimationSettings(
   if (partialObj.hasProperty(rt, "playState")) {
     result.playState = getPlayState(rt, partialObj);
   }
+  if (partialObj.hasProperty(rt, "updateRate")) {
+    result.updateRate = getUpdateRate(rt, partialObj);
+  }
 
   return result;
 }
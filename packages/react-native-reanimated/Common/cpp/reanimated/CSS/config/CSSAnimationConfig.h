@@ -20,21 +20,25 @@ enum class AnimationPlayState { Running, Paused };
 struct CSSAnimationSettings {
   double duration;
   EasingFunction easingFunction;
+  std::string easingFunctionKey;
   double delay;
   double iterationCount;
   AnimationDirection direction;
   AnimationFillMode fillMode;
   AnimationPlayState playState;
+  UpdateRate updateRate;
 };
 
 struct PartialCSSAnimationSettings {
   std::optional<double> duration;
   std::optional<EasingFunction> easingFunction;
+  std::optional<std::string> easingFunctionKey;
   std::optional<double> delay;
   std::optional<double> iterationCount;
   std::optional<AnimationDirection> direction;
   std::optional<AnimationFillMode> fillMode;
   std::optional<AnimationPlayState> playState;
+  std::optional<UpdateRate> updateRate;
 };
 
 using CSSAnimationSettingsMap =
@@ -40,12 +40,14 @@ std::shared_ptr<KeyframeEasingFunctions> getKeyframeTimingFunctions(
 CSSKeyframesConfig parseCSSAnimationKeyframesConfig(
     jsi::Runtime &rt,
     const jsi::Value &config,
-    const std::shared_ptr<ViewStylesRepository> &viewStylesRepository) {
+    const std::shared_ptr<ViewStylesRepository> &viewStylesRepository,
+    const BakedAnimationStylesCache::Scheduler &bakingScheduler) {
   const auto &configObj = config.asObject(rt);
 
   return {
       getStyleInterpolator(rt, configObj, viewStylesRepository),
-      getKeyframeTimingFunctions(rt, configObj)};
+      getKeyframeTimingFunctions(rt, configObj),
+      std::make_shared<BakedAnimationStylesCache>(bakingScheduler)};
 }
 
 } // namespace reanimated::css
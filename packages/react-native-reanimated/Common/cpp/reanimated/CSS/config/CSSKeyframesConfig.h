@@ -1,6 +1,7 @@
 #pragma once
 
 #include <reanimated/CSS/easing/EasingFunctions.h>
+#include <reanimated/CSS/interpolation/styles/BakedAnimationStyle.h>
 #include <reanimated/CSS/interpolation/styles/AnimationStyleInterpolator.h>
 #include <reanimated/CSS/misc/ViewStylesRepository.h>
 
@@ -14,6 +15,9 @@ using KeyframeEasingFunctions = std::unordered_map<double, EasingFunction>;
 struct CSSKeyframesConfig {
   std::shared_ptr<AnimationStyleInterpolator> styleInterpolator;
   std::shared_ptr<KeyframeEasingFunctions> keyframeEasingFunctions;
+  // Styles baked by animations using these keyframes (shared, as baking is
+  // expensive and the result depends only on the animation timing function)
+  std::shared_ptr<BakedAnimationStylesCache> bakedStyles;
 };
 
 std::shared_ptr<AnimationStyleInterpolator> getStyleInterpolator(
@@ -28,6 +32,7 @@ std::shared_ptr<KeyframeEasingFunctions> getKeyframeTimingFunctions(
 CSSKeyframesConfig parseCSSAnimationKeyframesConfig(
     jsi::Runtime &rt,
     const jsi::Value &config,
-    const std::shared_ptr<ViewStylesRepository> &viewStylesRepository);
+    const std::shared_ptr<ViewStylesRepository> &viewStylesRepository,
+    const BakedAnimationStylesCache::Scheduler &bakingScheduler);
 
 } // namespace reanimated::css
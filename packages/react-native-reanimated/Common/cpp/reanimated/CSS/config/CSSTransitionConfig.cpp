@@ -78,7 +78,8 @@ CSSTransitionConfig parseCSSTransitionConfig(
   return CSSTransitionConfig{
       getProperties(rt, configObj),
       parseCSSTransitionPropertiesSettings(
-          rt, configObj.getProperty(rt, "settings").asObject(rt))};
+          rt, configObj.getProperty(rt, "settings").asObject(rt)),
+      getUpdateRate(rt, configObj)};
 }
 
 PartialCSSTransitionConfig parsePartialCSSTransitionConfig(
@@ -95,6 +96,9 @@ PartialCSSTransitionConfig parsePartialCSSTransitionConfig(
     result.settings = parseCSSTransitionPropertiesSettings(
         rt, partialObj.getProperty(rt, "settings").asObject(rt));
   }
+  if (partialObj.hasProperty(rt, "updateRate")) {
+    result.updateRate = getUpdateRate(rt, partialObj);
+  }
 
   return result;
 }
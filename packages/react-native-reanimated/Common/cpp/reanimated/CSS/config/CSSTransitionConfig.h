@@ -22,11 +22,13 @@ using CSSTransitionPropertiesSettings =
 struct CSSTransitionConfig {
   TransitionProperties properties;
   CSSTransitionPropertiesSettings settings;
+  UpdateRate updateRate;
 };
 
 struct PartialCSSTransitionConfig {
   std::optional<TransitionProperties> properties;
   std::optional<CSSTransitionPropertiesSettings> settings;
+  std::optional<UpdateRate> updateRate;
 };
 
 std::optional<CSSTransitionPropertySettings> getTransitionPropertySettings(
@@ -10,8 +10,29 @@ EasingFunction getTimingFunction(jsi::Runtime &rt, const jsi::Object &config) {
   return createEasingFunction(rt, config.getProperty(rt, "timingFunction"));
 }
 
+std::string getTimingFunctionKey(
+    jsi::Runtime &rt,
+    const jsi::Object &config) {
+  return worklets::stringifyJSIValue(
+      rt, config.getProperty(rt, "timingFunction"));
+}
+
 double getDelay(jsi::Runtime &rt, const jsi::Object &config) {
   return config.getProperty(rt, "delay").asNumber();
 }
 
+UpdateRate parseUpdateRate(jsi::Runtime &rt, const jsi::Value &value) {
+  if (value.isUndefined()) {
+    return UpdateRate::full();
+  }
+  if (value.isNumber()) {
+    return reanimated::parseUpdateRate(value.asNumber());
+  }
+  return reanimated::parseUpdateRate(value.asString(rt).utf8(rt));
+}
+
+UpdateRate getUpdateRate(jsi::Runtime &rt, const jsi::Object &config) {
+  return parseUpdateRate(rt, config.getProperty(rt, "updateRate"));
+}
+
 } // namespace reanimated::css
@@ -1,13 +1,29 @@
 #pragma once
 
 #include <reanimated/CSS/easing/EasingFunctions.h>
+#include <reanimated/Fabric/updates/UpdateRate.h>
+#include <worklets/Tools/JSISerializer.h>
+
+#include <string>
 
 namespace reanimated::css {
 
 double getDuration(jsi::Runtime &rt, const jsi::Object &config);
 
 EasingFunction getTimingFunction(jsi::Runtime &rt, const jsi::Object &config);
+// Returns a string that is the same for equal timing function configs (it
+// allows to compare easing functions, which cannot be compared directly)
+std::string getTimingFunctionKey(
+    jsi::Runtime &rt,
+    const jsi::Object &config);
 
 double getDelay(jsi::Runtime &rt, const jsi::Object &config);
 
+// Accepts "full", "half" or a positive number of updates per second, and
+// returns the full rate for undefined
+UpdateRate parseUpdateRate(jsi::Runtime &rt, const jsi::Value &value);
+
+// The update rate is optional and defaults to the full rate
+UpdateRate getUpdateRate(jsi::Runtime &rt, const jsi::Object &config);
+
 } // namespace reanimated::css
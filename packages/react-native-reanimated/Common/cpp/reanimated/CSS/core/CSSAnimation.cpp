@@ -1,4 +1,5 @@
 #include <reanimated/CSS/core/CSSAnimation.h>
+#include <reanimated/CSS/progress/SampledProgressProvider.h>
 
 #include <utility>
 
@@ -6,7 +7,7 @@ namespace reanimated::css {
 
 CSSAnimation::CSSAnimation(
     jsi::Runtime &rt,
-    ShadowNode::Shared shadowNode,
+    ShadowNodeHandle shadowNode,
     std::string name,
     const CSSKeyframesConfig &keyframesConfig,
     const CSSAnimationSettings &settings,
@@ -14,6 +15,8 @@ CSSAnimation::CSSAnimation(
     : name_(std::move(name)),
       shadowNode_(std::move(shadowNode)),
       fillMode_(settings.fillMode),
+      easingFunctionKey_(settings.easingFunctionKey),
+      updateRate_(settings.updateRate),
       progressProvider_(std::make_shared<AnimationProgressProvider>(
           timestamp,
           settings.duration,
@@ -22,7 +25,11 @@ CSSAnimation::CSSAnimation(
           settings.direction,
           settings.easingFunction,
           keyframesConfig.keyframeEasingFunctions)),
-      styleInterpolator_(keyframesConfig.styleInterpolator) {
+      styleInterpolator_(keyframesConfig.styleInterpolator),
+      keyframeEasingFunctions_(keyframesConfig.keyframeEasingFunctions),
+      isViewDependent_(styleInterpolator_->isViewDependent()),
+      bakedStylesCache_(keyframesConfig.bakedStyles),
+      easingFunctionToBake_(settings.easingFunction) {
   if (settings.playState == AnimationPlayState::Paused) {
     progressProvider_->pause(timestamp);
   }
@@ -32,7 +39,7 @@ const std::string &CSSAnimation::getName() const {
   return name_;
 }
 
-ShadowNode::Shared CSSAnimation::getShadowNode() const {
+const ShadowNodeHandle &CSSAnimation::getShadowNode() const {
   return shadowNode_;
 }
 
@@ -61,7 +68,7 @@ bool CSSAnimation::hasBackwardsFillMode() const {
 }
 
 folly::dynamic CSSAnimation::getCurrentInterpolationStyle() const {
-  return styleInterpolator_->interpolate(shadowNode_, progressProvider_);
+  return interpolateStyle();
 }
 
 folly::dynamic CSSAnimation::getBackwardsFillStyle() const {
@@ -73,6 +80,14 @@ folly::dynamic CSSAnimation::getResetStyle() const {
   return styleInterpolator_->getResetStyle(shadowNode_);
 }
 
+const UpdateRate &CSSAnimation::getUpdateRate() const {
+  return updateRate_;
+}
+
+double CSSAnimation::getLastUpdateTimestamp() const {
+  return lastUpdateTimestamp_;
+}
+
 void CSSAnimation::run(const double timestamp) {
   if (progressProvider_->getState(timestamp) ==
       AnimationProgressState::Finished) {
@@ -82,18 +97,22 @@ void CSSAnimation::run(const double timestamp) {
 }
 
 folly::dynamic CSSAnimation::update(const double timestamp) {
-  progressProvider_->update(timestamp);
+  if (!updateProgress(timestamp)) {
+    return hasBackwardsFillMode() ? getBackwardsFillStyle() : folly::dynamic();
+  }
 
-  // Check if the animation has not started yet because of the delay
-  // (In general, it shouldn't be activated until the delay has passed but we
-  // add this check to make sure that animation doesn't start with the negative
-  // progress)
-  if (progressProvider_->getState(timestamp) ==
-      AnimationProgressState::Pending) {
+  return interpolateStyle();
+}
+
+folly::dynamic CSSAnimation::update(
+    const double timestamp,
+    SharedTimelines<folly::dynamic> &sharedTimelines) {
+  if (!updateProgress(timestamp)) {
     return hasBackwardsFillMode() ? getBackwardsFillStyle() : folly::dynamic();
   }
 
-  return styleInterpolator_->interpolate(shadowNode_, progressProvider_);
+  return sharedTimelines.getOrInterpolate(
+      getTimelineKey(), [this]() { return interpolateStyle(); });
 }
 
 void CSSAnimation::updateSettings(
@@ -108,6 +127,13 @@ void CSSAnimation::updateSettings(
     progressProvider_->setEasingFunction(
         updatedSettings.easingFunction.value());
   }
+  if (updatedSettings.easingFunctionKey.has_value()) {
+    easingFunctionKey_ = updatedSettings.easingFunctionKey.value();
+  }
+  if (updatedSettings.easingFunction.has_value()) {
+    bakedStyle_ = nullptr;
+    easingFunctionToBake_ = updatedSettings.easingFunction.value();
+  }
   if (updatedSettings.delay.has_value()) {
     progressProvider_->setDelay(updatedSettings.delay.value());
   }
@@ -121,6 +147,9 @@ void CSSAnimation::updateSettings(
   if (updatedSettings.fillMode.has_value()) {
     fillMode_ = updatedSettings.fillMode.value();
   }
+  if (updatedSettings.updateRate.has_value()) {
+    updateRate_ = updatedSettings.updateRate.value();
+  }
   if (updatedSettings.playState.has_value()) {
     if (updatedSettings.playState.value() == AnimationPlayState::Paused) {
       progressProvider_->pause(timestamp);
@@ -132,4 +161,75 @@ void CSSAnimation::updateSettings(
   progressProvider_->update(timestamp);
 }
 
+std::optional<AnimationTimelineKey> CSSAnimation::getTimelineKey() const {
+  if (isViewDependent_) {
+    return std::nullopt;
+  }
+  return AnimationTimelineKey{
+      .styleInterpolator = styleInterpolator_.get(),
+      .keyframeEasingFunctions = keyframeEasingFunctions_.get(),
+      .easingFunctionKey = easingFunctionKey_,
+      .progress = progressProvider_->getGlobalProgress()};
+}
+
+bool CSSAnimation::updateProgress(const double timestamp) {
+  maybeBakeStyle();
+  progressProvider_->update(timestamp);
+  lastUpdateTimestamp_ = timestamp;
+
+  // Check if the animation has not started yet because of the delay
+  // (In general, it shouldn't be activated until the delay has passed but we
+  // add this check to make sure that animation doesn't start with the negative
+  // progress)
+  return progressProvider_->getState(timestamp) !=
+      AnimationProgressState::Pending;
+}
+
+folly::dynamic CSSAnimation::interpolateStyle() const {
+  if (bakedStyle_) {
+    return bakedStyle_->evaluate(progressProvider_->getGlobalProgress());
+  }
+  return styleInterpolator_->interpolate(shadowNode_, progressProvider_);
+}
+
+void CSSAnimation::maybeBakeStyle() {
+  if (!easingFunctionToBake_.has_value()) {
+    return;
+  }
+
+  // The style is a pure function of the global progress only if it doesn't
+  // depend on the view
+  if (isViewDependent_ || !bakedStylesCache_) {
+    easingFunctionToBake_.reset();
+    return;
+  }
+
+  // Everything used by the bake function is captured by value, as it runs on
+  // the baking thread and may outlive the animation
+  auto bakedStyle = bakedStylesCache_->getOrScheduleBake(
+      easingFunctionKey_,
+      [styleInterpolator = styleInterpolator_,
+       keyframeEasingFunctions = keyframeEasingFunctions_,
+       shadowNode = shadowNode_,
+       easingFunction = easingFunctionToBake_.value()]() {
+        const auto progressProvider = std::make_shared<SampledProgressProvider>(
+            easingFunction, keyframeEasingFunctions);
+        return BakedAnimationStyle::bake(
+            [&](const double progress) {
+              progressProvider->setGlobalProgress(progress);
+              return styleInterpolator->interpolate(
+                  shadowNode, progressProvider);
+            },
+            [&](const BakedAnimationStyle::ValuePath &path) {
+              return styleInterpolator->isColorAt(path);
+            });
+      });
+  // The style is interpolated live until the baked one is ready
+  if (!bakedStyle.has_value()) {
+    return;
+  }
+  bakedStyle_ = std::move(bakedStyle.value());
+  easingFunctionToBake_.reset();
+}
+
 } // namespace reanimated::css
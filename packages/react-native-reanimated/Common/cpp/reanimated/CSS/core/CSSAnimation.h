@@ -4,8 +4,10 @@
 #include <reanimated/CSS/easing/EasingFunctions.h>
 #include <reanimated/CSS/interpolation/styles/AnimationStyleInterpolator.h>
 #include <reanimated/CSS/progress/AnimationProgressProvider.h>
+#include <reanimated/CSS/util/SharedTimelines.h>
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -16,14 +18,14 @@ class CSSAnimation {
  public:
   CSSAnimation(
       jsi::Runtime &rt,
-      ShadowNode::Shared shadowNode,
+      ShadowNodeHandle shadowNode,
       std::string name,
       const CSSKeyframesConfig &keyframesConfig,
       const CSSAnimationSettings &settings,
       double timestamp);
 
   const std::string &getName() const;
-  ShadowNode::Shared getShadowNode() const;
+  const ShadowNodeHandle &getShadowNode() const;
 
   double getStartTimestamp(double timestamp) const;
   AnimationProgressState getState(double timestamp) const;
@@ -36,19 +38,50 @@ class CSSAnimation {
   folly::dynamic getBackwardsFillStyle() const;
   folly::dynamic getResetStyle() const;
 
+  const UpdateRate &getUpdateRate() const;
+  // Timestamp of the last frame in which the animation progress was updated
+  double getLastUpdateTimestamp() const;
+
   void run(double timestamp);
   folly::dynamic update(double timestamp);
+  // Works like update(), but re-uses the style interpolated in the current
+  // frame by other animations on the same timeline (if the animation style
+  // doesn't depend on the view)
+  folly::dynamic update(
+      double timestamp,
+      SharedTimelines<folly::dynamic> &sharedTimelines);
   void updateSettings(
       const PartialCSSAnimationSettings &updatedSettings,
       double timestamp);
 
  private:
   const std::string name_;
-  const ShadowNode::Shared shadowNode_;
+  const ShadowNodeHandle shadowNode_;
   AnimationFillMode fillMode_;
+  std::string easingFunctionKey_;
+  UpdateRate updateRate_;
+  double lastUpdateTimestamp_ = NEVER_UPDATED_TIMESTAMP;
 
   std::shared_ptr<AnimationProgressProvider> progressProvider_;
   std::shared_ptr<AnimationStyleInterpolator> styleInterpolator_;
+  std::shared_ptr<KeyframeEasingFunctions> keyframeEasingFunctions_;
+  // Keyframes of the style interpolator never change, so we can check this
+  // only once
+  const bool isViewDependent_;
+  std::shared_ptr<BakedAnimationStylesCache> bakedStylesCache_;
+  // Used instead of the style interpolator if the style could be baked
+  std::shared_ptr<const BakedAnimationStyle> bakedStyle_;
+  // Set until the baked style is ready. Baking runs on the baking thread and
+  // the style is interpolated live in the meantime, so neither the JS thread
+  // nor the UI thread is blocked by it.
+  std::optional<EasingFunction> easingFunctionToBake_;
+
+  // Returns nullopt if the animation style depends on the view, so it can't
+  // be shared with other animations
+  std::optional<AnimationTimelineKey> getTimelineKey() const;
+  bool updateProgress(double timestamp);
+  folly::dynamic interpolateStyle() const;
+  void maybeBakeStyle();
 };
 
 } // namespace reanimated::css
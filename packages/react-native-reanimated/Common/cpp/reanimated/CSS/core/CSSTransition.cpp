@@ -3,21 +3,22 @@
 namespace reanimated::css {
 
 CSSTransition::CSSTransition(
-    ShadowNode::Shared shadowNode,
+    ShadowNodeHandle shadowNode,
     const CSSTransitionConfig &config,
     const std::shared_ptr<ViewStylesRepository> &viewStylesRepository)
     : shadowNode_(std::move(shadowNode)),
       viewStylesRepository_(viewStylesRepository),
       properties_(config.properties),
       settings_(config.settings),
+      updateRate_(config.updateRate),
       progressProvider_(TransitionProgressProvider()),
       styleInterpolator_(TransitionStyleInterpolator(viewStylesRepository)) {}
 
 Tag CSSTransition::getViewTag() const {
-  return shadowNode_->getTag();
+  return shadowNode_.getTag();
 }
 
-ShadowNode::Shared CSSTransition::getShadowNode() const {
+const ShadowNodeHandle &CSSTransition::getShadowNode() const {
   return shadowNode_;
 }
 
@@ -73,6 +74,14 @@ PropertyNames CSSTransition::getAllowedProperties(
   return {allAllowedProps.begin(), allAllowedProps.end()};
 }
 
+const UpdateRate &CSSTransition::getUpdateRate() const {
+  return updateRate_;
+}
+
+double CSSTransition::getLastUpdateTimestamp() const {
+  return lastUpdateTimestamp_;
+}
+
 void CSSTransition::updateSettings(const PartialCSSTransitionConfig &config) {
   if (config.properties.has_value()) {
     updateTransitionProperties(config.properties.value());
@@ -80,6 +89,9 @@ void CSSTransition::updateSettings(const PartialCSSTransitionConfig &config) {
   if (config.settings.has_value()) {
     settings_ = config.settings.value();
   }
+  if (config.updateRate.has_value()) {
+    updateRate_ = config.updateRate.value();
+  }
 }
 
 folly::dynamic CSSTransition::run(
@@ -98,6 +110,7 @@ folly::dynamic CSSTransition::run(
 
 folly::dynamic CSSTransition::update(const double timestamp) {
   progressProvider_.update(timestamp);
+  lastUpdateTimestamp_ = timestamp;
   auto result = styleInterpolator_.interpolate(shadowNode_, progressProvider_);
   // Remove interpolators for which interpolation has finished
   // (we won't need them anymore in the current transition)
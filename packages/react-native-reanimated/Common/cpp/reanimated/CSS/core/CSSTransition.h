@@ -15,12 +15,12 @@ namespace reanimated::css {
 class CSSTransition {
  public:
   CSSTransition(
-      ShadowNode::Shared shadowNode,
+      ShadowNodeHandle shadowNode,
       const CSSTransitionConfig &config,
       const std::shared_ptr<ViewStylesRepository> &viewStylesRepository);
 
   Tag getViewTag() const;
-  ShadowNode::Shared getShadowNode() const;
+  const ShadowNodeHandle &getShadowNode() const;
   double getMinDelay(double timestamp) const;
   TransitionProgressState getState() const;
   folly::dynamic getCurrentInterpolationStyle() const;
@@ -29,6 +29,10 @@ class CSSTransition {
       const folly::dynamic &oldProps,
       const folly::dynamic &newProps);
 
+  const UpdateRate &getUpdateRate() const;
+  // Timestamp of the last frame in which the transition was updated
+  double getLastUpdateTimestamp() const;
+
   void updateSettings(const PartialCSSTransitionConfig &config);
   folly::dynamic run(
       const ChangedProps &changedProps,
@@ -37,10 +41,12 @@ class CSSTransition {
   folly::dynamic update(double timestamp);
 
  private:
-  const ShadowNode::Shared shadowNode_;
+  const ShadowNodeHandle shadowNode_;
   const std::shared_ptr<ViewStylesRepository> viewStylesRepository_;
   TransitionProperties properties_;
   CSSTransitionPropertiesSettings settings_;
+  UpdateRate updateRate_;
+  double lastUpdateTimestamp_ = NEVER_UPDATED_TIMESTAMP;
   TransitionProgressProvider progressProvider_;
   TransitionStyleInterpolator styleInterpolator_;
 
@@ -10,6 +10,11 @@ PropertyInterpolator::PropertyInterpolator(
     : propertyPath_(std::move(propertyPath)),
       viewStylesRepository_(viewStylesRepository) {}
 
+bool PropertyInterpolator::isColorAt(
+    std::span<const folly::dynamic> /* path */) const {
+  return false;
+}
+
 bool PropertyInterpolatorFactory::isDiscreteProperty() const {
   return false;
 }
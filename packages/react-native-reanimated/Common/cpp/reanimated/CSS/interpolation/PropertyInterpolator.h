@@ -6,6 +6,7 @@
 #include <reanimated/CSS/progress/KeyframeProgressProvider.h>
 
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -19,13 +20,20 @@ class PropertyInterpolator {
       const std::shared_ptr<ViewStylesRepository> &viewStylesRepository);
 
   virtual folly::dynamic getStyleValue(
-      const ShadowNode::Shared &shadowNode) const = 0;
+      const ShadowNodeHandle &shadowNode) const = 0;
   virtual folly::dynamic getResetStyle(
-      const ShadowNode::Shared &shadowNode) const = 0;
+      const ShadowNodeHandle &shadowNode) const = 0;
   virtual folly::dynamic getFirstKeyframeValue() const = 0;
   virtual folly::dynamic getLastKeyframeValue() const = 0;
   virtual bool equalsReversingAdjustedStartValue(
       const folly::dynamic &propertyValue) const = 0;
+  // Returns true if the interpolation result depends on the view, e.g. when
+  // a missing keyframe value is read from the view style or when a relative
+  // value has to be resolved against the view (or its parent) dimensions
+  virtual bool isViewDependent() const = 0;
+  // Returns true if the value at the path (relative to the value returned by
+  // `interpolate`) is interpolated as a color
+  virtual bool isColorAt(std::span<const folly::dynamic> path) const;
 
   virtual void updateKeyframes(const folly::dynamic &keyframes) = 0;
   virtual void updateKeyframesFromStyleChange(
@@ -34,7 +42,7 @@ class PropertyInterpolator {
       const folly::dynamic &lastUpdateValue) = 0;
 
   virtual folly::dynamic interpolate(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::shared_ptr<KeyframeProgressProvider> &progressProvider)
       const = 0;
 
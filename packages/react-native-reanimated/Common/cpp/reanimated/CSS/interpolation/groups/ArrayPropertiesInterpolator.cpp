@@ -30,6 +30,19 @@ bool ArrayPropertiesInterpolator::equalsReversingAdjustedStartValue(
   return true;
 }
 
+bool ArrayPropertiesInterpolator::isColorAt(
+    std::span<const folly::dynamic> path) const {
+  if (path.empty() || !path.front().isInt()) {
+    return false;
+  }
+  const auto index = path.front().getInt();
+  if (index < 0 || static_cast<size_t>(index) >= interpolators_.size()) {
+    return false;
+  }
+  return interpolators_[static_cast<size_t>(index)]->isColorAt(
+      path.subspan(1));
+}
+
 void ArrayPropertiesInterpolator::updateKeyframes(
     const folly::dynamic &keyframes) {
   const size_t valuesCount = keyframes.size();
@@ -79,6 +92,13 @@ folly::dynamic ArrayPropertiesInterpolator::mapInterpolators(
   return result;
 }
 
+bool ArrayPropertiesInterpolator::anyInterpolator(
+    const std::function<bool(const PropertyInterpolator &)> &predicate) const {
+  return std::ranges::any_of(interpolators_, [&](const auto &interpolator) {
+    return predicate(*interpolator);
+  });
+}
+
 void ArrayPropertiesInterpolator::resizeInterpolators(size_t valuesCount) {
   // Remove excess interpolators if the array size has decreased
   if (interpolators_.size() > valuesCount) {
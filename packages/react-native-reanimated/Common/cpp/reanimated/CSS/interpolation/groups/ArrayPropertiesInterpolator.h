@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <span>
 
 namespace reanimated::css {
 
@@ -19,6 +20,8 @@ class ArrayPropertiesInterpolator : public GroupPropertiesInterpolator {
   bool equalsReversingAdjustedStartValue(
       const folly::dynamic &propertyValue) const override;
 
+  bool isColorAt(std::span<const folly::dynamic> path) const override;
+
   void updateKeyframes(const folly::dynamic &keyframes) override;
   void updateKeyframesFromStyleChange(
       const folly::dynamic &oldStyleValue,
@@ -29,6 +32,9 @@ class ArrayPropertiesInterpolator : public GroupPropertiesInterpolator {
   folly::dynamic mapInterpolators(
       const std::function<folly::dynamic(PropertyInterpolator &)> &callback)
       const override;
+  bool anyInterpolator(
+      const std::function<bool(const PropertyInterpolator &)> &predicate)
+      const override;
 
  private:
   const InterpolatorFactoriesArray &factories_;
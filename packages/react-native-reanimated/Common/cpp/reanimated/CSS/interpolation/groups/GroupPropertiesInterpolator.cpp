@@ -8,7 +8,7 @@ GroupPropertiesInterpolator::GroupPropertiesInterpolator(
     : PropertyInterpolator(propertyPath, viewStylesRepository) {}
 
 folly::dynamic GroupPropertiesInterpolator::getStyleValue(
-    const ShadowNode::Shared &shadowNode) const {
+    const ShadowNodeHandle &shadowNode) const {
   return mapInterpolators(
       [&](PropertyInterpolator &interpolator) -> folly::dynamic {
         return interpolator.getStyleValue(shadowNode);
@@ -16,7 +16,7 @@ folly::dynamic GroupPropertiesInterpolator::getStyleValue(
 }
 
 folly::dynamic GroupPropertiesInterpolator::getResetStyle(
-    const ShadowNode::Shared &shadowNode) const {
+    const ShadowNodeHandle &shadowNode) const {
   return mapInterpolators(
       [&](PropertyInterpolator &interpolator) -> folly::dynamic {
         return interpolator.getResetStyle(shadowNode);
@@ -37,8 +37,14 @@ folly::dynamic GroupPropertiesInterpolator::getLastKeyframeValue() const {
       });
 }
 
+bool GroupPropertiesInterpolator::isViewDependent() const {
+  return anyInterpolator([](const PropertyInterpolator &interpolator) {
+    return interpolator.isViewDependent();
+  });
+}
+
 folly::dynamic GroupPropertiesInterpolator::interpolate(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const std::shared_ptr<KeyframeProgressProvider> &progressProvider) const {
   return mapInterpolators(
       [&](PropertyInterpolator &interpolator) -> folly::dynamic {
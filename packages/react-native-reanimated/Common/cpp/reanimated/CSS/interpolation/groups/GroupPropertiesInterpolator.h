@@ -15,14 +15,15 @@ class GroupPropertiesInterpolator : public PropertyInterpolator {
       const std::shared_ptr<ViewStylesRepository> &viewStylesRepository);
 
   folly::dynamic getStyleValue(
-      const ShadowNode::Shared &shadowNode) const override;
+      const ShadowNodeHandle &shadowNode) const override;
   folly::dynamic getResetStyle(
-      const ShadowNode::Shared &shadowNode) const override;
+      const ShadowNodeHandle &shadowNode) const override;
   folly::dynamic getFirstKeyframeValue() const override;
   folly::dynamic getLastKeyframeValue() const override;
+  bool isViewDependent() const override;
 
   folly::dynamic interpolate(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::shared_ptr<KeyframeProgressProvider> &progressProvider)
       const override;
 
@@ -30,6 +31,9 @@ class GroupPropertiesInterpolator : public PropertyInterpolator {
   virtual folly::dynamic mapInterpolators(
       const std::function<folly::dynamic(PropertyInterpolator &)> &callback)
       const = 0;
+  virtual bool anyInterpolator(
+      const std::function<bool(const PropertyInterpolator &)> &predicate)
+      const = 0;
 };
 
 } // namespace reanimated::css
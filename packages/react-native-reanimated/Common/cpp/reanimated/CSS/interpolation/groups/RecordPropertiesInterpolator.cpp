@@ -19,6 +19,15 @@ bool RecordPropertiesInterpolator::equalsReversingAdjustedStartValue(
   });
 }
 
+bool RecordPropertiesInterpolator::isColorAt(
+    std::span<const folly::dynamic> path) const {
+  if (path.empty() || !path.front().isString()) {
+    return false;
+  }
+  const auto it = interpolators_.find(path.front().getString());
+  return it != interpolators_.end() && it->second->isColorAt(path.subspan(1));
+}
+
 void RecordPropertiesInterpolator::updateKeyframes(
     const folly::dynamic &keyframes) {
   // TODO - maybe add a possibility to remove interpolators that are no
@@ -78,6 +87,13 @@ folly::dynamic RecordPropertiesInterpolator::mapInterpolators(
   return result;
 }
 
+bool RecordPropertiesInterpolator::anyInterpolator(
+    const std::function<bool(const PropertyInterpolator &)> &predicate) const {
+  return std::ranges::any_of(interpolators_, [&](const auto &item) {
+    return predicate(*item.second);
+  });
+}
+
 void RecordPropertiesInterpolator::maybeCreateInterpolator(
     const std::string &propertyName) {
   if (interpolators_.find(propertyName) == interpolators_.end()) {
@@ -4,6 +4,7 @@
 #include <reanimated/CSS/util/interpolators.h>
 
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_set>
 
@@ -20,6 +21,8 @@ class RecordPropertiesInterpolator : public GroupPropertiesInterpolator {
   bool equalsReversingAdjustedStartValue(
       const folly::dynamic &propertyValue) const override;
 
+  bool isColorAt(std::span<const folly::dynamic> path) const override;
+
   void updateKeyframes(const folly::dynamic &keyframes) override;
   void updateKeyframesFromStyleChange(
       const folly::dynamic &oldStyleValue,
@@ -30,6 +33,9 @@ class RecordPropertiesInterpolator : public GroupPropertiesInterpolator {
   folly::dynamic mapInterpolators(
       const std::function<folly::dynamic(PropertyInterpolator &)> &callback)
       const override;
+  bool anyInterpolator(
+      const std::function<bool(const PropertyInterpolator &)> &predicate)
+      const override;
 
   void maybeCreateInterpolator(const std::string &propertyName);
 
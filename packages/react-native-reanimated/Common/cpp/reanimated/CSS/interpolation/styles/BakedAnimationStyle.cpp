@@ -0,0 +1,424 @@
+#include <reanimated/CSS/interpolation/styles/BakedAnimationStyle.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace reanimated::css {
+
+std::shared_ptr<const BakedAnimationStyle> BakedAnimationStyle::bake(
+    const InterpolateFunction &interpolate,
+    const IsColorFunction &isColor) {
+  for (size_t intervalsCount = INITIAL_INTERVALS_COUNT;
+       intervalsCount <= MAX_INTERVALS_COUNT;
+       intervalsCount *= 2) {
+    auto bakedStyle = std::make_shared<BakedAnimationStyle>();
+    if (!bakedStyle->sample(interpolate, isColor, intervalsCount)) {
+      // The structure of the style changes during the animation
+      return nullptr;
+    }
+
+    double maxNumberError = 0;
+    double maxColorError = 0;
+    bool hasDiscreteMismatch = false;
+    if (!bakedStyle->measureError(
+            interpolate, maxNumberError, maxColorError, hasDiscreteMismatch)) {
+      return nullptr;
+    }
+    if (maxNumberError <= NUMBER_TOLERANCE &&
+        maxColorError <= COLOR_CHANNEL_TOLERANCE && !hasDiscreteMismatch) {
+      bakedStyle->maxNumberError_ = maxNumberError;
+      return bakedStyle;
+    }
+  }
+
+  return nullptr;
+}
+
+folly::dynamic BakedAnimationStyle::evaluate(const double progress) const {
+  const double position =
+      std::clamp(progress, 0.0, 1.0) * static_cast<double>(intervalsCount_);
+  const auto fromRow = std::min(
+      static_cast<size_t>(std::floor(position)), intervalsCount_ - 1);
+  const auto toRow = fromRow + 1;
+  const double t = position - static_cast<double>(fromRow);
+
+  folly::dynamic result = skeleton_;
+
+  for (const auto &leaf : leaves_) {
+    folly::dynamic *target = &result;
+    for (const auto &key : leaf.path) {
+      target = &(*target)[key];
+    }
+
+    switch (leaf.type) {
+      case LeafType::Number:
+      case LeafType::Angle: {
+        const auto from = numbers_[fromRow * numbersColumns_ + leaf.column];
+        const auto to = numbers_[toRow * numbersColumns_ + leaf.column];
+        const auto value = from + (to - from) * t;
+        *target = leaf.type == LeafType::Number ? folly::dynamic(value)
+                                                : formatAngle(value);
+        break;
+      }
+      case LeafType::Color: {
+        const auto from = colors_[fromRow * colorsColumns_ + leaf.column];
+        const auto to = colors_[toRow * colorsColumns_ + leaf.column];
+        // Colors are stored in the same (signed) format as CSSColor returns
+        *target = static_cast<int32_t>(blendColors(from, to, t));
+        break;
+      }
+      case LeafType::Discrete: {
+        const auto row = t < 0.5 ? fromRow : toRow;
+        *target = discreteValues_[row * discreteColumns_ + leaf.column];
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+size_t BakedAnimationStyle::getIntervalsCount() const {
+  return intervalsCount_;
+}
+
+size_t BakedAnimationStyle::getRetainedBytes() const {
+  size_t bytes = sizeof(BakedAnimationStyle) +
+      numbers_.capacity() * sizeof(double) +
+      colors_.capacity() * sizeof(uint32_t) +
+      discreteValues_.capacity() * sizeof(folly::dynamic) +
+      leaves_.capacity() * sizeof(Leaf);
+  for (const auto &leaf : leaves_) {
+    bytes += leaf.path.capacity() * sizeof(folly::dynamic);
+  }
+  return bytes;
+}
+
+double BakedAnimationStyle::getMaxNumberError() const {
+  return maxNumberError_;
+}
+
+bool BakedAnimationStyle::sample(
+    const InterpolateFunction &interpolate,
+    const IsColorFunction &isColor,
+    const size_t intervalsCount) {
+  intervalsCount_ = intervalsCount;
+
+  for (size_t i = 0; i <= intervalsCount; ++i) {
+    const auto progress =
+        static_cast<double>(i) / static_cast<double>(intervalsCount);
+    const auto style = interpolate(progress);
+
+    if (i == 0) {
+      if (!style.isObject()) {
+        return false;
+      }
+      ValuePath path;
+      collectLeaves(style, isColor, path);
+      skeleton_ = style;
+      const auto rowsCount = intervalsCount + 1;
+      numbers_.reserve(rowsCount * numbersColumns_);
+      colors_.reserve(rowsCount * colorsColumns_);
+      discreteValues_.reserve(rowsCount * discreteColumns_);
+    }
+
+    if (!appendRow(style)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void BakedAnimationStyle::collectLeaves(
+    const folly::dynamic &value,
+    const IsColorFunction &isColor,
+    ValuePath &path) {
+  if (value.isObject() && !value.empty()) {
+    for (const auto &[key, item] : value.items()) {
+      path.push_back(key);
+      collectLeaves(item, isColor, path);
+      path.pop_back();
+    }
+    return;
+  }
+  if (value.isArray() && !value.empty()) {
+    for (size_t i = 0; i < value.size(); ++i) {
+      path.emplace_back(static_cast<int64_t>(i));
+      collectLeaves(value[i], isColor, path);
+      path.pop_back();
+    }
+    return;
+  }
+
+  if (value.isDouble()) {
+    leaves_.push_back({path, LeafType::Number, numbersColumns_++});
+  } else if (isAngle(value)) {
+    leaves_.push_back({path, LeafType::Angle, numbersColumns_++});
+  } else if (value.isInt() && isColor(path)) {
+    leaves_.push_back({path, LeafType::Color, colorsColumns_++});
+  } else {
+    leaves_.push_back({path, LeafType::Discrete, discreteColumns_++});
+  }
+}
+
+bool BakedAnimationStyle::appendRow(const folly::dynamic &style) {
+  // Every sampled style must have the same structure as the first one
+  if (countLeaves(style) != leaves_.size()) {
+    return false;
+  }
+
+  for (const auto &leaf : leaves_) {
+    const auto *value = getLeafValue(style, leaf.path);
+    if (!value) {
+      return false;
+    }
+
+    switch (leaf.type) {
+      case LeafType::Number:
+        if (!value->isDouble()) {
+          return false;
+        }
+        numbers_.push_back(value->getDouble());
+        break;
+      case LeafType::Angle:
+        if (!isAngle(*value)) {
+          return false;
+        }
+        numbers_.push_back(parseAngle(*value));
+        break;
+      case LeafType::Color:
+        if (!value->isInt()) {
+          return false;
+        }
+        colors_.push_back(static_cast<uint32_t>(value->getInt()));
+        break;
+      case LeafType::Discrete:
+        discreteValues_.push_back(*value);
+        break;
+    }
+  }
+
+  return true;
+}
+
+bool BakedAnimationStyle::measureError(
+    const InterpolateFunction &interpolate,
+    double &maxNumberError,
+    double &maxColorError,
+    bool &hasDiscreteMismatch) const {
+  // The error is checked at several points of every interval, not only at the
+  // midpoint, as easing functions (e.g. with overshoot) can deviate from the
+  // linear blend the most anywhere between the samples
+  for (size_t i = 0; i < intervalsCount_ * ERROR_CHECKS_COUNT; ++i) {
+    const auto row = i / ERROR_CHECKS_COUNT;
+    const auto offset = static_cast<double>(i % ERROR_CHECKS_COUNT + 1) /
+        static_cast<double>(ERROR_CHECKS_COUNT + 1);
+    const auto progress = (static_cast<double>(row) + offset) /
+        static_cast<double>(intervalsCount_);
+    const auto expected = interpolate(progress);
+    const auto actual = evaluate(progress);
+
+    for (const auto &leaf : leaves_) {
+      const auto *expectedValue = getLeafValue(expected, leaf.path);
+      const auto *actualValue = getLeafValue(actual, leaf.path);
+      if (!expectedValue || !actualValue) {
+        return false;
+      }
+
+      switch (leaf.type) {
+        case LeafType::Number:
+          if (!expectedValue->isDouble()) {
+            return false;
+          }
+          maxNumberError = std::max(
+              maxNumberError,
+              std::abs(expectedValue->getDouble() - actualValue->getDouble()));
+          break;
+        case LeafType::Angle:
+          if (!isAngle(*expectedValue)) {
+            return false;
+          }
+          maxNumberError = std::max(
+              maxNumberError,
+              std::abs(parseAngle(*expectedValue) - parseAngle(*actualValue)));
+          break;
+        case LeafType::Color: {
+          if (!expectedValue->isInt()) {
+            return false;
+          }
+          const auto expectedColor =
+              static_cast<uint32_t>(expectedValue->getInt());
+          const auto actualColor = static_cast<uint32_t>(actualValue->getInt());
+          for (int shift = 0; shift < 32; shift += 8) {
+            const auto expectedChannel =
+                static_cast<double>((expectedColor >> shift) & 0xFF);
+            const auto actualChannel =
+                static_cast<double>((actualColor >> shift) & 0xFF);
+            maxColorError = std::max(
+                maxColorError, std::abs(expectedChannel - actualChannel));
+          }
+          break;
+        }
+        case LeafType::Discrete: {
+          // The baked value is taken from one of the interval ends, so the
+          // live one must be equal to one of them as well (otherwise the value
+          // changes between samples more than once)
+          const auto &fromValue =
+              discreteValues_[row * discreteColumns_ + leaf.column];
+          const auto &toValue =
+              discreteValues_[(row + 1) * discreteColumns_ + leaf.column];
+          if (*expectedValue != fromValue && *expectedValue != toValue) {
+            hasDiscreteMismatch = true;
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+const folly::dynamic *BakedAnimationStyle::getLeafValue(
+    const folly::dynamic &style,
+    const ValuePath &path) {
+  const folly::dynamic *value = &style;
+  for (const auto &key : path) {
+    if (value->isObject() ? !key.isString()
+                          : (!value->isArray() || !key.isInt() ||
+                             static_cast<size_t>(key.getInt()) >=
+                                 value->size())) {
+      return nullptr;
+    }
+    value = value->get_ptr(key);
+    if (!value) {
+      return nullptr;
+    }
+  }
+  return value;
+}
+
+size_t BakedAnimationStyle::countLeaves(const folly::dynamic &value) {
+  if (value.isObject() && !value.empty()) {
+    size_t count = 0;
+    for (const auto &item : value.values()) {
+      count += countLeaves(item);
+    }
+    return count;
+  }
+  if (value.isArray() && !value.empty()) {
+    size_t count = 0;
+    for (const auto &item : value) {
+      count += countLeaves(item);
+    }
+    return count;
+  }
+  return 1;
+}
+
+bool BakedAnimationStyle::isAngle(const folly::dynamic &value) {
+  if (!value.isString()) {
+    return false;
+  }
+  // CSSAngle is always serialized to radians
+  const auto &str = value.getString();
+  return str.size() > 3 && str.ends_with("rad");
+}
+
+double BakedAnimationStyle::parseAngle(const folly::dynamic &value) {
+  return std::stod(value.getString());
+}
+
+folly::dynamic BakedAnimationStyle::formatAngle(const double radians) {
+  // The same format as CSSAngle::toString
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(4) << radians;
+  return stream.str() + "rad";
+}
+
+uint32_t BakedAnimationStyle::blendColors(
+    uint32_t from,
+    uint32_t to,
+    const double progress) {
+  // Samples are returned as they are (a transparent keyframe color must stay
+  // transparent and not become the transparent version of the other color)
+  if (progress <= 0) {
+    return from;
+  }
+  if (progress >= 1) {
+    return to;
+  }
+  // Match CSSColor::interpolate, which uses the rgb channels of the other
+  // color when interpolating from/to transparent
+  if (from == 0) {
+    from = to & 0x00FFFFFF;
+  } else if (to == 0) {
+    to = from & 0x00FFFFFF;
+  }
+
+  uint32_t result = 0;
+  for (int shift = 0; shift < 32; shift += 8) {
+    const auto fromChannel = static_cast<double>((from >> shift) & 0xFF);
+    const auto toChannel = static_cast<double>((to >> shift) & 0xFF);
+    const auto channel = static_cast<uint32_t>(std::round(std::clamp(
+        fromChannel + (toChannel - fromChannel) * progress, 0.0, 255.0)));
+    result |= channel << shift;
+  }
+  return result;
+}
+
+BakedAnimationStylesCache::BakedAnimationStylesCache(Scheduler scheduler)
+    : scheduler_(std::move(scheduler)) {}
+
+std::optional<std::shared_ptr<const BakedAnimationStyle>>
+BakedAnimationStylesCache::getOrScheduleBake(
+    const std::string &easingFunctionKey,
+    BakeFunction &&bake) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto [it, inserted] = styles_.try_emplace(
+        easingFunctionKey, Entry{.isReady = false, .style = nullptr});
+    if (!inserted) {
+      if (!it->second.isReady) {
+        return std::nullopt;
+      }
+      return it->second.style;
+    }
+  }
+
+  // Baking interpolates the style a few thousand times, so it runs outside of
+  // the lock (and, depending on the scheduler, outside of the calling thread)
+  scheduler_([weakThis = weak_from_this(),
+              easingFunctionKey,
+              bake = std::move(bake)]() {
+    auto bakedStyle = bake();
+    const auto strongThis = weakThis.lock();
+    if (!strongThis) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(strongThis->mutex_);
+    strongThis->styles_[easingFunctionKey] = {
+        .isReady = true, .style = std::move(bakedStyle)};
+  });
+  return std::nullopt;
+}
+
+size_t BakedAnimationStylesCache::getRetainedBytes() {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  size_t bytes = 0;
+  for (const auto &[easingFunctionKey, entry] : styles_) {
+    bytes += easingFunctionKey.capacity();
+    if (entry.style) {
+      bytes += entry.style->getRetainedBytes();
+    }
+  }
+  return bytes;
+}
+
+} // namespace reanimated::css
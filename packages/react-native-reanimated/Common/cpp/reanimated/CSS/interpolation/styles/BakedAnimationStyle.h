@@ -0,0 +1,139 @@
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace reanimated::css {
+
+// Keyframes style sampled at evenly spaced global progress values. It can be
+// used instead of the live interpolation if the style doesn't depend on the
+// view, as it is a pure function of the global progress then.
+//
+// Accuracy bounds (checked against the live interpolation at ERROR_CHECKS_COUNT
+// evenly spaced points inside every sampling interval; sampling is refined
+// until they are met):
+// - numbers and angles - absolute error <= NUMBER_TOLERANCE,
+// - colors - error of every channel <= COLOR_CHANNEL_TOLERANCE,
+// - discrete values (strings, booleans, integers) - the value switches at the
+//   nearest sample, so at most half of the sampling interval too early/late
+//   (the live value must always be one of the values of the nearest samples).
+// If the bounds cannot be met with MAX_INTERVALS_COUNT intervals (e.g. for
+// steps() easing), the style is not baked at all.
+class BakedAnimationStyle {
+ public:
+  using InterpolateFunction = std::function<folly::dynamic(double progress)>;
+  // Path of a value in the interpolated style (object keys and array indices)
+  using ValuePath = std::vector<folly::dynamic>;
+  // Tells if the value at the path is interpolated as a color (colors and
+  // integer properties, e.g. zIndex, are serialized in the same way)
+  using IsColorFunction = std::function<bool(const ValuePath &path)>;
+
+  static constexpr size_t INITIAL_INTERVALS_COUNT = 32;
+  static constexpr size_t MAX_INTERVALS_COUNT = 1024;
+  static constexpr double NUMBER_TOLERANCE = 1e-3;
+  static constexpr double COLOR_CHANNEL_TOLERANCE = 1;
+  static constexpr size_t ERROR_CHECKS_COUNT = 3;
+
+  // Returns nullptr if the style cannot be baked within the accuracy bounds
+  static std::shared_ptr<const BakedAnimationStyle> bake(
+      const InterpolateFunction &interpolate,
+      const IsColorFunction &isColor);
+
+  folly::dynamic evaluate(double progress) const;
+
+  size_t getIntervalsCount() const;
+  // Approximate number of bytes retained by the sampled tables
+  size_t getRetainedBytes() const;
+  // Max error of numeric values measured when the style was baked
+  double getMaxNumberError() const;
+
+ private:
+  enum class LeafType { Number, Angle, Color, Discrete };
+
+  struct Leaf {
+    ValuePath path;
+    LeafType type;
+    // Index of the leaf column in the table of its type
+    size_t column;
+  };
+
+  folly::dynamic skeleton_;
+  std::vector<Leaf> leaves_;
+  size_t intervalsCount_ = 0;
+  double maxNumberError_ = 0;
+
+  // Tables are stored row by row (all columns of one sample are contiguous)
+  std::vector<double> numbers_;
+  std::vector<uint32_t> colors_;
+  std::vector<folly::dynamic> discreteValues_;
+  size_t numbersColumns_ = 0;
+  size_t colorsColumns_ = 0;
+  size_t discreteColumns_ = 0;
+
+  bool sample(
+      const InterpolateFunction &interpolate,
+      const IsColorFunction &isColor,
+      size_t intervalsCount);
+  void collectLeaves(
+      const folly::dynamic &value,
+      const IsColorFunction &isColor,
+      ValuePath &path);
+  bool appendRow(const folly::dynamic &style);
+  bool measureError(
+      const InterpolateFunction &interpolate,
+      double &maxNumberError,
+      double &maxColorError,
+      bool &hasDiscreteMismatch) const;
+
+  static const folly::dynamic *getLeafValue(
+      const folly::dynamic &style,
+      const ValuePath &path);
+  static size_t countLeaves(const folly::dynamic &value);
+  static bool isAngle(const folly::dynamic &value);
+  static double parseAngle(const folly::dynamic &value);
+  static folly::dynamic formatAngle(double radians);
+  static uint32_t blendColors(uint32_t from, uint32_t to, double progress);
+};
+
+// Baked styles of the keyframes for different animation timing functions
+// (identified by the timing function key). Styles are baked by jobs passed to
+// the scheduler (e.g. run on a background thread), so that baking never
+// blocks the thread that requested it.
+class BakedAnimationStylesCache
+    : public std::enable_shared_from_this<BakedAnimationStylesCache> {
+ public:
+  using BakeFunction =
+      std::function<std::shared_ptr<const BakedAnimationStyle>()>;
+  using Scheduler = std::function<void(std::function<void()> &&job)>;
+
+  explicit BakedAnimationStylesCache(Scheduler scheduler);
+
+  // Returns std::nullopt if the style is still being baked (baking is
+  // scheduled on the first call for the key) and nullptr if the style
+  // couldn't be baked
+  std::optional<std::shared_ptr<const BakedAnimationStyle>> getOrScheduleBake(
+      const std::string &easingFunctionKey,
+      BakeFunction &&bake);
+  size_t getRetainedBytes();
+
+ private:
+  struct Entry {
+    bool isReady;
+    // nullptr for styles that couldn't be baked so that we don't retry
+    std::shared_ptr<const BakedAnimationStyle> style;
+  };
+
+  const Scheduler scheduler_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> styles_;
+};
+
+} // namespace reanimated::css
@@ -30,7 +30,7 @@ TransitionStyleInterpolator::getReversedPropertyNames(
 }
 
 folly::dynamic TransitionStyleInterpolator::interpolate(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const TransitionProgressProvider &transitionProgressProvider) const {
   return mapInterpolators(
       transitionProgressProvider,
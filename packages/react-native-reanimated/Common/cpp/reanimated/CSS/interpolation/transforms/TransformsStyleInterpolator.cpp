@@ -13,13 +13,13 @@ TransformsStyleInterpolator::TransformsStyleInterpolator(
       interpolators_(interpolators) {}
 
 folly::dynamic TransformsStyleInterpolator::getStyleValue(
-    const ShadowNode::Shared &shadowNode) const {
+    const ShadowNodeHandle &shadowNode) const {
   return viewStylesRepository_->getStyleProp(
-      shadowNode->getTag(), propertyPath_);
+      shadowNode.getTag(), propertyPath_);
 }
 
 folly::dynamic TransformsStyleInterpolator::getResetStyle(
-    const ShadowNode::Shared &shadowNode) const {
+    const ShadowNodeHandle &shadowNode) const {
   auto styleValue = getStyleValue(shadowNode);
 
   if (!styleValue.isArray()) {
@@ -67,8 +67,15 @@ bool TransformsStyleInterpolator::equalsReversingAdjustedStartValue(
   return true;
 }
 
+bool TransformsStyleInterpolator::isViewDependent() const {
+  return std::ranges::any_of(keyframes_, [](const auto &keyframe) {
+    return hasRelativeOperations(keyframe->fromOperations) ||
+        hasRelativeOperations(keyframe->toOperations);
+  });
+}
+
 folly::dynamic TransformsStyleInterpolator::interpolate(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const std::shared_ptr<KeyframeProgressProvider> &progressProvider) const {
   const auto currentIndex = getIndexOfCurrentKeyframe(progressProvider);
 
@@ -169,6 +176,30 @@ TransformsStyleInterpolator::parseTransformOperations(
   return transformOperations;
 }
 
+bool TransformsStyleInterpolator::hasRelativeOperations(
+    const std::optional<TransformOperations> &operations) {
+  // Missing operations are read from the view style
+  if (!operations.has_value()) {
+    return true;
+  }
+
+  return std::ranges::any_of(operations.value(), [](const auto &operation) {
+    if (operation->isRelative()) {
+      return true;
+    }
+    // Matrix created from other operations may contain relative operations
+    // that are resolved during interpolation
+    if (operation->type() == TransformOperationType::Matrix) {
+      const auto &value =
+          std::static_pointer_cast<MatrixOperation>(operation)->value;
+      if (std::holds_alternative<TransformOperations>(value)) {
+        return hasRelativeOperations(std::get<TransformOperations>(value));
+      }
+    }
+    return false;
+  });
+}
+
 std::shared_ptr<TransformKeyframe>
 TransformsStyleInterpolator::createTransformKeyframe(
     const double fromOffset,
@@ -335,7 +366,7 @@ size_t TransformsStyleInterpolator::getIndexOfCurrentKeyframe(
 }
 
 TransformOperations TransformsStyleInterpolator::getFallbackValue(
-    const ShadowNode::Shared &shadowNode) const {
+    const ShadowNodeHandle &shadowNode) const {
   const auto &styleValue = getStyleValue(shadowNode);
   return parseTransformOperations(styleValue).value_or(TransformOperations{});
 }
@@ -347,7 +378,7 @@ TransformsStyleInterpolator::getDefaultOperationOfType(
 }
 
 TransformOperations TransformsStyleInterpolator::interpolateOperations(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const double keyframeProgress,
     const TransformOperations &fromOperations,
     const TransformOperations &toOperations) const {
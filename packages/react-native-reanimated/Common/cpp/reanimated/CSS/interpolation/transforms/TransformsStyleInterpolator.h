@@ -31,16 +31,17 @@ class TransformsStyleInterpolator final : public PropertyInterpolator {
       const std::shared_ptr<ViewStylesRepository> &viewStylesRepository);
 
   folly::dynamic getStyleValue(
-      const ShadowNode::Shared &shadowNode) const override;
+      const ShadowNodeHandle &shadowNode) const override;
   folly::dynamic getResetStyle(
-      const ShadowNode::Shared &shadowNode) const override;
+      const ShadowNodeHandle &shadowNode) const override;
   folly::dynamic getFirstKeyframeValue() const override;
   folly::dynamic getLastKeyframeValue() const override;
   bool equalsReversingAdjustedStartValue(
       const folly::dynamic &propertyValue) const override;
+  bool isViewDependent() const override;
 
   folly::dynamic interpolate(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::shared_ptr<KeyframeProgressProvider> &progressProvider)
       const override;
 
@@ -59,6 +60,8 @@ class TransformsStyleInterpolator final : public PropertyInterpolator {
 
   static std::optional<TransformOperations> parseTransformOperations(
       const folly::dynamic &values);
+  static bool hasRelativeOperations(
+      const std::optional<TransformOperations> &operations);
   std::shared_ptr<TransformKeyframe> createTransformKeyframe(
       double fromOffset,
       double toOffset,
@@ -79,9 +82,9 @@ class TransformsStyleInterpolator final : public PropertyInterpolator {
   size_t getIndexOfCurrentKeyframe(
       const std::shared_ptr<KeyframeProgressProvider> &progressProvider) const;
   TransformOperations getFallbackValue(
-      const ShadowNode::Shared &shadowNode) const;
+      const ShadowNodeHandle &shadowNode) const;
   TransformOperations interpolateOperations(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       double keyframeProgress,
       const TransformOperations &fromOperations,
       const TransformOperations &toOperations) const;
@@ -89,7 +92,7 @@ class TransformsStyleInterpolator final : public PropertyInterpolator {
   static folly::dynamic convertResultToDynamic(
       const TransformOperations &operations);
   TransformInterpolatorUpdateContext createUpdateContext(
-      const ShadowNode::Shared &shadowNode) const;
+      const ShadowNodeHandle &shadowNode) const;
 };
 
 } // namespace reanimated::css
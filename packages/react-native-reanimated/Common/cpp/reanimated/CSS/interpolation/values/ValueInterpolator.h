@@ -1,17 +1,20 @@
 #pragma once
 
+#include <reanimated/CSS/common/values/CSSColor.h>
 #include <reanimated/CSS/common/values/CSSValueVariant.h>
 #include <reanimated/CSS/interpolation/PropertyInterpolator.h>
 #include <reanimated/CSS/util/keyframes.h>
 
+#include <algorithm>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace reanimated::css {
 
 struct ValueInterpolatorUpdateContext {
-  const ShadowNode::Shared &node;
+  const ShadowNodeHandle &node;
 };
 
 template <typename TValue>
@@ -42,13 +45,13 @@ class ValueInterpolator : public PropertyInterpolator {
   virtual ~ValueInterpolator() = default;
 
   folly::dynamic getStyleValue(
-      const ShadowNode::Shared &shadowNode) const override {
+      const ShadowNodeHandle &shadowNode) const override {
     return viewStylesRepository_->getStyleProp(
-        shadowNode->getTag(), propertyPath_);
+        shadowNode.getTag(), propertyPath_);
   }
 
   folly::dynamic getResetStyle(
-      const ShadowNode::Shared &shadowNode) const override {
+      const ShadowNodeHandle &shadowNode) const override {
     auto styleValue = getStyleValue(shadowNode);
 
     if (styleValue.isNull()) {
@@ -74,6 +77,16 @@ class ValueInterpolator : public PropertyInterpolator {
     return reversingAdjustedStartValue_.value() == ValueType(propertyValue);
   }
 
+  bool isViewDependent() const override {
+    return std::ranges::any_of(keyframes_, [](const KeyframeType &keyframe) {
+      return !keyframe.value.has_value() || keyframe.value->isRelative();
+    });
+  }
+
+  bool isColorAt(std::span<const folly::dynamic> path) const override {
+    return path.empty() && (std::is_same_v<AllowedTypes, CSSColor> || ...);
+  }
+
   void updateKeyframes(const folly::dynamic &keyframes) override {
     const auto parsedKeyframes = parseDynamicKeyframes(keyframes);
 
@@ -119,7 +132,7 @@ class ValueInterpolator : public PropertyInterpolator {
   }
 
   folly::dynamic interpolate(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::shared_ptr<KeyframeProgressProvider> &progressProvider)
       const override {
     const auto toIndex = getToKeyframeIndex(progressProvider);
@@ -171,7 +184,7 @@ class ValueInterpolator : public PropertyInterpolator {
   std::vector<ValueKeyframe<AllowedTypes...>> keyframes_;
   std::optional<ValueType> reversingAdjustedStartValue_;
 
-  ValueType getFallbackValue(const ShadowNode::Shared &shadowNode) const {
+  ValueType getFallbackValue(const ShadowNodeHandle &shadowNode) const {
     const auto styleValue = getStyleValue(shadowNode);
     return styleValue.isNull() ? defaultStyleValue_ : ValueType(styleValue);
   }
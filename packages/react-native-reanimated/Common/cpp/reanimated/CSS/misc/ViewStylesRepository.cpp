@@ -9,12 +9,51 @@ ViewStylesRepository::ViewStylesRepository(
       animatedPropsRegistry_(animatedPropsRegistry) {}
 
 jsi::Value ViewStylesRepository::getNodeProp(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const std::string &propName) {
-  int tag = shadowNode->getTag();
+  return getResolvedNodeProp(
+      shadowNode.getTag(),
+      shadowNode.resolve(uiManager_->getShadowTreeRegistry()),
+      propName);
+}
+
+jsi::Value ViewStylesRepository::getParentNodeProp(
+    const ShadowNodeHandle &shadowNode,
+    const std::string &propName) {
+  const auto surfaceId = shadowNode.getSurfaceId();
+  const auto &shadowTreeRegistry = uiManager_->getShadowTreeRegistry();
+
+  ShadowNode::Shared parentNode = nullptr;
+
+  shadowTreeRegistry.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+    const auto rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+    const auto ancestors = shadowNode.getFamily().getAncestors(*rootShadowNode);
+    if (ancestors.size() > 1) {
+      // The last ancestor is the parent itself, so its clone is taken from
+      // the children of the ancestor before it
+      const auto &[grandparentNode, index] = ancestors[ancestors.size() - 2];
+      parentNode = grandparentNode.get().getChildren()[index];
+    } else if (ancestors.size() == 1) {
+      parentNode = rootShadowNode;
+    }
+  });
 
+  if (!parentNode) {
+    return jsi::Value::undefined();
+  }
+
+  // The parent node comes from the current revision, so it is already the
+  // newest clone
+  return getResolvedNodeProp(parentNode->getTag(), parentNode, propName);
+}
+
+jsi::Value ViewStylesRepository::getResolvedNodeProp(
+    const Tag tag,
+    const ShadowNode::Shared &newestShadowNode,
+    const std::string &propName) {
+  std::lock_guard<std::mutex> lock(nodesCacheMutex_);
   auto &cachedNode = shadowNodeCache_[tag];
-  updateCacheIfNeeded(cachedNode, shadowNode);
+  updateCacheIfNeeded(cachedNode, newestShadowNode);
 
   if (propName == "width" || propName == "height" || propName == "top" ||
       propName == "left") {
@@ -45,27 +84,6 @@ jsi::Value ViewStylesRepository::getNodeProp(
   throw std::runtime_error("[Reanimated] Unsupported property: " + propName);
 }
 
-jsi::Value ViewStylesRepository::getParentNodeProp(
-    const ShadowNode::Shared &shadowNode,
-    const std::string &propName) {
-  const auto surfaceId = shadowNode->getSurfaceId();
-  const auto &shadowTreeRegistry = uiManager_->getShadowTreeRegistry();
-
-  ShadowNode::Shared parentNode = nullptr;
-
-  shadowTreeRegistry.visit(surfaceId, [&](ShadowTree const &shadowTree) {
-    auto currentRevision = shadowTree.getCurrentRevision();
-    parentNode =
-        dom::getParentNode(currentRevision.rootShadowNode, *shadowNode);
-  });
-
-  if (!parentNode) {
-    return jsi::Value::undefined();
-  }
-
-  return getNodeProp(parentNode, propName);
-}
-
 folly::dynamic ViewStylesRepository::getStyleProp(
     const Tag tag,
     const PropertyPath &propertyPath) {
@@ -79,30 +97,28 @@ folly::dynamic ViewStylesRepository::getStyleProp(
 }
 
 void ViewStylesRepository::clearNodesCache() {
+  std::lock_guard<std::mutex> lock(nodesCacheMutex_);
   shadowNodeCache_.clear();
 }
 
 void ViewStylesRepository::updateCacheIfNeeded(
     CachedShadowNode &cachedNode,
-    const ShadowNode::Shared &shadowNode) {
-  auto newestCloneOfShadowNode =
-      uiManager_->getNewestCloneOfShadowNode(*shadowNode);
-
-  // Check if newestCloneOfShadowNode is valid (is already mounted / not
-  // yet unmounted)
-  if (!newestCloneOfShadowNode) {
+    const ShadowNode::Shared &newestShadowNode) {
+  // Check if newestShadowNode is valid (is already mounted / not yet
+  // unmounted)
+  if (!newestShadowNode) {
     return;
   }
 
   auto layoutableShadowNode =
-      dynamic_cast<const LayoutableShadowNode *>(newestCloneOfShadowNode.get());
+      dynamic_cast<const LayoutableShadowNode *>(newestShadowNode.get());
   if (!layoutableShadowNode) {
     return;
   }
 
   cachedNode.layoutMetrics = layoutableShadowNode->layoutMetrics_;
-  cachedNode.viewProps = std::static_pointer_cast<const ViewProps>(
-      newestCloneOfShadowNode->getProps());
+  cachedNode.viewProps =
+      std::static_pointer_cast<const ViewProps>(newestShadowNode->getProps());
 }
 
 folly::dynamic ViewStylesRepository::getPropertyValue(
@@ -2,6 +2,7 @@
 
 #include <reanimated/CSS/common/definitions.h>
 #include <reanimated/CSS/registry/StaticPropsRegistry.h>
+#include <reanimated/Fabric/ShadowNodeHandle.h>
 #include <reanimated/Fabric/updates/AnimatedPropsRegistry.h>
 
 #include <react/renderer/components/view/ViewProps.h>
@@ -10,6 +11,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -36,10 +38,10 @@ class ViewStylesRepository {
   }
 
   jsi::Value getNodeProp(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::string &propName);
   jsi::Value getParentNodeProp(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::string &propName);
   folly::dynamic getStyleProp(Tag tag, const PropertyPath &propertyPath);
 
@@ -50,11 +52,18 @@ class ViewStylesRepository {
   std::shared_ptr<StaticPropsRegistry> staticPropsRegistry_;
   std::shared_ptr<AnimatedPropsRegistry> animatedPropsRegistry_;
 
+  // Guards the nodes cache, as styles can be interpolated by multiple threads
+  // when CSS registries are updated in parallel
+  std::mutex nodesCacheMutex_;
   std::unordered_map<int, CachedShadowNode> shadowNodeCache_;
 
+  jsi::Value getResolvedNodeProp(
+      Tag tag,
+      const ShadowNode::Shared &newestShadowNode,
+      const std::string &propName);
   void updateCacheIfNeeded(
       CachedShadowNode &cachedNode,
-      const ShadowNode::Shared &shadowNode);
+      const ShadowNode::Shared &newestShadowNode);
 
   static folly::dynamic getPropertyValue(
       const folly::dynamic &value,
@@ -0,0 +1,40 @@
+#include <reanimated/CSS/progress/SampledProgressProvider.h>
+
+#include <utility>
+
+namespace reanimated::css {
+
+SampledProgressProvider::SampledProgressProvider(
+    EasingFunction easingFunction,
+    std::shared_ptr<KeyframeEasingFunctions> keyframeEasingFunctions)
+    : easingFunction_(std::move(easingFunction)),
+      keyframeEasingFunctions_(std::move(keyframeEasingFunctions)) {}
+
+void SampledProgressProvider::setGlobalProgress(const double progress) {
+  progress_ = progress;
+}
+
+double SampledProgressProvider::getGlobalProgress() const {
+  return progress_;
+}
+
+double SampledProgressProvider::getKeyframeProgress(
+    const double fromOffset,
+    const double toOffset) const {
+  // Must match AnimationProgressProvider::getKeyframeProgress
+  if (fromOffset == toOffset) {
+    return 1;
+  }
+
+  const auto keyframeProgress =
+      (progress_ - fromOffset) / (toOffset - fromOffset);
+
+  const auto easingFunctionIt = keyframeEasingFunctions_->find(fromOffset);
+  if (easingFunctionIt != keyframeEasingFunctions_->end()) {
+    return easingFunctionIt->second(keyframeProgress);
+  }
+
+  return easingFunction_(keyframeProgress);
+}
+
+} // namespace reanimated::css
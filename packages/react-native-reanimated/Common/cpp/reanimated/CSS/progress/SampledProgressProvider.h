@@ -0,0 +1,31 @@
+#pragma once
+
+#include <reanimated/CSS/config/CSSKeyframesConfig.h>
+#include <reanimated/CSS/easing/EasingFunctions.h>
+#include <reanimated/CSS/progress/KeyframeProgressProvider.h>
+
+#include <memory>
+
+namespace reanimated::css {
+
+// Progress provider which global progress is set manually. It is used to
+// sample the keyframes interpolation outside of the animation timeline.
+class SampledProgressProvider final : public KeyframeProgressProvider {
+ public:
+  SampledProgressProvider(
+      EasingFunction easingFunction,
+      std::shared_ptr<KeyframeEasingFunctions> keyframeEasingFunctions);
+
+  void setGlobalProgress(double progress);
+
+  double getGlobalProgress() const override;
+  double getKeyframeProgress(double fromOffset, double toOffset) const override;
+
+ private:
+  const EasingFunction easingFunction_;
+  const std::shared_ptr<KeyframeEasingFunctions> keyframeEasingFunctions_;
+
+  double progress_ = 0;
+};
+
+} // namespace reanimated::css
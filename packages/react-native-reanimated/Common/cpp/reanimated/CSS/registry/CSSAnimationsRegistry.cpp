@@ -1,5 +1,7 @@
 #include <reanimated/CSS/registry/CSSAnimationsRegistry.h>
 
+#include <algorithm>
+
 namespace reanimated::css {
 
 bool CSSAnimationsRegistry::isEmpty() const {
@@ -13,9 +15,21 @@ bool CSSAnimationsRegistry::hasUpdates() const {
       !delayedAnimationsManager_.empty() || !animationsToRevertMap_.empty();
 }
 
+bool CSSAnimationsRegistry::hasActiveUpdates() const {
+  return !runningAnimationIndicesMap_.empty() ||
+      !animationsToRevertMap_.empty();
+}
+
+std::optional<double> CSSAnimationsRegistry::getNextDelayedTimestamp() const {
+  if (delayedAnimationsManager_.empty()) {
+    return std::nullopt;
+  }
+  return delayedAnimationsManager_.top().timestamp;
+}
+
 void CSSAnimationsRegistry::apply(
     jsi::Runtime &rt,
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const std::optional<std::vector<std::string>> &animationNames,
     const CSSAnimationsMap &newAnimations,
     const CSSAnimationSettingsUpdatesMap &settingsUpdates,
@@ -23,7 +37,7 @@ void CSSAnimationsRegistry::apply(
   const auto animationsVector =
       buildAnimationsVector(rt, shadowNode, animationNames, newAnimations);
 
-  const auto viewTag = shadowNode->getTag();
+  const auto viewTag = shadowNode.getTag();
   if (animationsVector.empty()) {
     remove(viewTag);
     return;
@@ -60,33 +74,75 @@ void CSSAnimationsRegistry::remove(const Tag viewTag) {
 }
 
 void CSSAnimationsRegistry::update(const double timestamp) {
+  updateRateClock_.advance(timestamp);
   // Activate all delayed animations that should start now
   activateDelayedAnimations(timestamp);
   // Update styles in the registry for views which animations were reverted
   handleAnimationsToRevert(timestamp);
 
-  // Iterate over active animations and update them
-  for (auto it = runningAnimationIndicesMap_.begin();
-       it != runningAnimationIndicesMap_.end();) {
-    const auto viewTag = it->first;
-    const std::vector<size_t> animationIndices = {
-        it->second.begin(), it->second.end()};
-    updateViewAnimations(viewTag, animationIndices, timestamp, true);
-
-    if (runningAnimationIndicesMap_[viewTag].empty()) {
-      it = runningAnimationIndicesMap_.erase(it);
-    } else {
-      ++it;
+  if (workerPool_ &&
+      runningAnimationIndicesMap_.size() >= PARALLEL_UPDATE_MIN_VIEWS_COUNT) {
+    updateViewsInParallel(timestamp);
+  } else {
+    // Iterate over active animations and update them
+    for (auto it = runningAnimationIndicesMap_.begin();
+         it != runningAnimationIndicesMap_.end();) {
+      const auto viewTag = it->first;
+      const std::vector<size_t> animationIndices = {
+          it->second.begin(), it->second.end()};
+      updateViewAnimations(viewTag, animationIndices, timestamp, true);
+
+      if (runningAnimationIndicesMap_[viewTag].empty()) {
+        it = runningAnimationIndicesMap_.erase(it);
+      } else {
+        ++it;
+      }
     }
   }
+
+  sharedTimelines_.finishFrame();
+  sharedTimelinesStats_ = sharedTimelines_.getStats();
+  for (auto &sharedTimelines : workerSharedTimelines_) {
+    sharedTimelines.finishFrame();
+    sharedTimelinesStats_.merge(sharedTimelines.getStats());
+  }
+}
+
+void CSSAnimationsRegistry::setWorkerPool(
+    const std::shared_ptr<WorkerPool> &workerPool) {
+  workerPool_ = workerPool;
+  workerSharedTimelines_.clear();
+}
+
+const SharedTimelinesStats &CSSAnimationsRegistry::getSharedTimelinesStats()
+    const {
+  return sharedTimelinesStats_;
+}
+
+void CSSAnimationsRegistry::addStats(RegistryStats &stats) const {
+  // Keyframes interpolators are owned by the keyframes registry, so only
+  // animation objects are counted here
+  for (const auto &[_, entry] : registry_) {
+    const auto animationsCount = entry.animationsVector.size();
+    stats.retainedBytes += sizeof(Registry::value_type) +
+        animationsCount *
+            (sizeof(CSSAnimation) + sizeof(std::shared_ptr<CSSAnimation>) +
+             sizeof(AnimationToIndexMap::value_type));
+  }
+  for (const auto &[_, indices] : runningAnimationIndicesMap_) {
+    stats.retainedBytes += sizeof(RunningAnimationIndicesMap::value_type) +
+        indices.size() * sizeof(size_t);
+    stats.runningCount += indices.size();
+  }
+  stats.delayedCount = delayedAnimationsManager_.size();
 }
 
 CSSAnimationsVector CSSAnimationsRegistry::buildAnimationsVector(
     jsi::Runtime &rt,
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const std::optional<std::vector<std::string>> &animationNames,
     const std::optional<CSSAnimationsMap> &newAnimations) const {
-  const auto registryIt = registry_.find(shadowNode->getTag());
+  const auto registryIt = registry_.find(shadowNode.getTag());
 
   // If animationNames has no value, that means no animations were added,
   // removed or reordered, so we can return the current animations vector from
@@ -172,12 +228,93 @@ void CSSAnimationsRegistry::updateViewAnimations(
     const std::vector<size_t> &animationIndices,
     const double timestamp,
     const bool addToBatch) {
+  applyViewAnimationsUpdate(computeViewAnimationsUpdate(
+      viewTag,
+      animationIndices,
+      timestamp,
+      addToBatch,
+      addToBatch ? &sharedTimelines_ : nullptr));
+}
+
+void CSSAnimationsRegistry::updateViewsInParallel(const double timestamp) {
+  std::vector<std::pair<Tag, std::vector<size_t>>> views;
+  views.reserve(runningAnimationIndicesMap_.size());
+  for (const auto &[viewTag, animationIndices] : runningAnimationIndicesMap_) {
+    views.emplace_back(
+        viewTag,
+        std::vector<size_t>{animationIndices.begin(), animationIndices.end()});
+  }
+
+  // Views are split into contiguous chunks, one per pool thread. Every chunk
+  // collects its results separately and they are merged on this thread, as
+  // only the merge modifies the registry and the updates batch.
+  const auto chunksCount = workerPool_->getChunksCount(views.size());
+  std::vector<std::vector<ViewAnimationsUpdate>> chunkUpdates(chunksCount);
+  if (workerSharedTimelines_.size() < chunksCount) {
+    workerSharedTimelines_.resize(chunksCount);
+  }
+
+  workerPool_->runInChunks(
+      views.size(),
+      [&](const size_t chunkIndex, const size_t begin, const size_t end) {
+        auto &updates = chunkUpdates[chunkIndex];
+        updates.reserve(end - begin);
+
+        for (size_t i = begin; i < end; ++i) {
+          updates.push_back(computeViewAnimationsUpdate(
+              views[i].first,
+              views[i].second,
+              timestamp,
+              true,
+              &workerSharedTimelines_[chunkIndex]));
+        }
+      });
+
+  for (auto &updates : chunkUpdates) {
+    for (auto &update : updates) {
+      applyViewAnimationsUpdate(std::move(update));
+    }
+  }
+
+  std::erase_if(runningAnimationIndicesMap_, [](const auto &item) {
+    return item.second.empty();
+  });
+}
+
+CSSAnimationsRegistry::ViewAnimationsUpdate
+CSSAnimationsRegistry::computeViewAnimationsUpdate(
+    const Tag viewTag,
+    const std::vector<size_t> &animationIndices,
+    const double timestamp,
+    const bool addToBatch,
+    SharedTimelines<folly::dynamic> *sharedTimelines) const {
+  ViewAnimationsUpdate viewUpdate{.viewTag = viewTag};
+
+  const auto registryIt = registry_.find(viewTag);
+  if (registryIt == registry_.end()) {
+    return viewUpdate;
+  }
+  const auto &animationsVector = registryIt->second.animationsVector;
+  if (addToBatch && !isViewUpdateDue(animationsVector, animationIndices)) {
+    return viewUpdate;
+  }
+  // Offscreen views aren't interpolated until one of their animations has to
+  // change its state. Progress is computed from the timestamp, so animations
+  // continue from the right place when the view becomes visible again.
+  if (addToBatch && isCulled(viewTag) &&
+      std::ranges::all_of(animationIndices, [&](const size_t index) {
+        return animationsVector[index]->getState(timestamp) ==
+            AnimationProgressState::Running;
+      })) {
+    return viewUpdate;
+  }
+
   folly::dynamic result = folly::dynamic::object;
-  ShadowNode::Shared shadowNode = nullptr;
+  ShadowNodeHandle shadowNode;
   bool hasUpdates = false;
 
   for (const auto animationIndex : animationIndices) {
-    const auto &animation = registry_[viewTag].animationsVector[animationIndex];
+    const auto &animation = animationsVector[animationIndex];
     if (!shadowNode) {
       shadowNode = animation->getShadowNode();
     }
@@ -186,7 +323,12 @@ void CSSAnimationsRegistry::updateViewAnimations(
     }
 
     bool updatesAddedToBatch = false;
-    const auto updates = animation->update(timestamp);
+    // Animations of many views are often running on the same timeline (e.g.
+    // skeleton loaders), so we interpolate their style only once per frame.
+    // Styles can be shared only within a single update() call.
+    const auto updates = sharedTimelines
+        ? animation->update(timestamp, *sharedTimelines)
+        : animation->update(timestamp);
     const auto newState = animation->getState(timestamp);
 
     if (newState == AnimationProgressState::Finished) {
@@ -205,7 +347,7 @@ void CSSAnimationsRegistry::updateViewAnimations(
         // by the next animation. Instead, we are creating the new style
         // object without reverted (finished without forwards fill mode)
         // animations.
-        animationsToRevertMap_[viewTag].insert(animationIndex);
+        viewUpdate.animationIndicesToRevert.push_back(animationIndex);
       }
     }
 
@@ -213,15 +355,45 @@ void CSSAnimationsRegistry::updateViewAnimations(
       hasUpdates = addStyleUpdates(result, updates, true) || hasUpdates;
     }
     if (newState != AnimationProgressState::Running) {
-      runningAnimationIndicesMap_[viewTag].erase(animationIndex);
+      viewUpdate.stoppedAnimationIndices.push_back(animationIndex);
     }
   }
 
+  viewUpdate.shadowNode = std::move(shadowNode);
   if (hasUpdates) {
-    addUpdatesToBatch(shadowNode, result);
+    viewUpdate.updates = std::move(result);
+  }
+  return viewUpdate;
+}
+
+void CSSAnimationsRegistry::applyViewAnimationsUpdate(
+    ViewAnimationsUpdate &&update) {
+  const auto viewTag = update.viewTag;
+
+  for (const auto animationIndex : update.animationIndicesToRevert) {
+    animationsToRevertMap_[viewTag].insert(animationIndex);
+  }
+  for (const auto animationIndex : update.stoppedAnimationIndices) {
+    runningAnimationIndicesMap_[viewTag].erase(animationIndex);
+  }
+  if (!update.updates.isNull()) {
+    addUpdatesToBatch(update.shadowNode, update.updates);
   }
 }
 
+bool CSSAnimationsRegistry::isViewUpdateDue(
+    const CSSAnimationsVector &animationsVector,
+    const std::vector<size_t> &animationIndices) const {
+  // Animations of the same view may override each other's props, so they are
+  // either all updated in the frame or all skipped. The view is updated at
+  // the highest update rate of its running animations.
+  return std::ranges::any_of(animationIndices, [&](const size_t index) {
+    const auto &animation = animationsVector[index];
+    return updateRateClock_.isDue(
+        animation->getUpdateRate(), animation->getLastUpdateTimestamp());
+  });
+}
+
 void CSSAnimationsRegistry::scheduleOrActivateAnimation(
     const size_t animationIndex,
     const std::shared_ptr<CSSAnimation> &animation,
@@ -239,7 +411,7 @@ void CSSAnimationsRegistry::scheduleOrActivateAnimation(
       delayedAnimationsManager_.add(startTimestamp, animation);
     }
   } else {
-    const auto viewTag = animation->getShadowNode()->getTag();
+    const auto viewTag = animation->getShadowNode().getTag();
     runningAnimationIndicesMap_[viewTag].insert(animationIndex);
   }
 }
@@ -267,7 +439,7 @@ void CSSAnimationsRegistry::applyViewAnimationsStyle(
   }
 
   folly::dynamic updatedStyle = folly::dynamic::object;
-  ShadowNode::Shared shadowNode = nullptr;
+  ShadowNodeHandle shadowNode;
 
   for (const auto &animation : it->second.animationsVector) {
     const auto startTimestamp = animation->getStartTimestamp(timestamp);
@@ -302,7 +474,7 @@ void CSSAnimationsRegistry::activateDelayedAnimations(const double timestamp) {
   while (!delayedAnimationsManager_.empty() &&
          delayedAnimationsManager_.top().timestamp <= timestamp) {
     const auto [_, animation] = delayedAnimationsManager_.pop();
-    const auto viewTag = animation->getShadowNode()->getTag();
+    const auto viewTag = animation->getShadowNode().getTag();
 
     // Add only these animations which weren't removed in the meantime
     if (registry_.find(viewTag) == registry_.end()) {
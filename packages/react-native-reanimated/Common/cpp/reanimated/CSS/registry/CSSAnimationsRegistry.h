@@ -3,10 +3,13 @@
 #include <reanimated/CSS/config/CSSAnimationConfig.h>
 #include <reanimated/CSS/core/CSSAnimation.h>
 #include <reanimated/CSS/util/DelayedItemsManager.h>
+#include <reanimated/CSS/util/SharedTimelines.h>
 #include <reanimated/CSS/util/props.h>
 #include <reanimated/Fabric/updates/UpdatesRegistry.h>
+#include <reanimated/Tools/WorkerPool.h>
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -29,10 +32,14 @@ class CSSAnimationsRegistry
 
   bool isEmpty() const override;
   bool hasUpdates() const;
+  // Whether there are updates other than waiting for delayed items to start
+  bool hasActiveUpdates() const;
+  // Timestamp at which the earliest delayed item starts (if there is any)
+  std::optional<double> getNextDelayedTimestamp() const;
 
   void apply(
       jsi::Runtime &rt,
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::optional<std::vector<std::string>> &animationNames,
       const CSSAnimationsMap &newAnimations,
       const CSSAnimationSettingsUpdatesMap &settingsUpdates,
@@ -40,6 +47,16 @@ class CSSAnimationsRegistry
   void remove(Tag viewTag) override;
 
   void update(double timestamp);
+  // Animations of different views are updated in parallel on the pool
+  // threads if there are enough running views (pass nullptr to disable)
+  void setWorkerPool(const std::shared_ptr<WorkerPool> &workerPool);
+
+  // Returns stats about animations that shared the interpolated style in the
+  // most recent update
+  const SharedTimelinesStats &getSharedTimelinesStats() const;
+
+ protected:
+  void addStats(RegistryStats &stats) const override;
 
  private:
   using AnimationToIndexMap =
@@ -51,6 +68,18 @@ class CSSAnimationsRegistry
     const CSSAnimationsVector animationsVector;
     const AnimationToIndexMap animationToIndexMap;
   };
+  // Result of the view animations update. It is computed without modifying
+  // the registry, so that views can be updated on different threads.
+  struct ViewAnimationsUpdate {
+    Tag viewTag;
+    ShadowNodeHandle shadowNode;
+    // Null if there are no updates to add to the batch
+    folly::dynamic updates;
+    std::vector<size_t> stoppedAnimationIndices;
+    std::vector<size_t> animationIndicesToRevert;
+  };
+
+  static constexpr size_t PARALLEL_UPDATE_MIN_VIEWS_COUNT = 64;
 
   using Registry = std::unordered_map<Tag, RegistryEntry>;
 
@@ -59,10 +88,16 @@ class CSSAnimationsRegistry
   RunningAnimationIndicesMap runningAnimationIndicesMap_;
   AnimationsToRevertMap animationsToRevertMap_;
   DelayedItemsManager<std::shared_ptr<CSSAnimation>> delayedAnimationsManager_;
+  SharedTimelines<folly::dynamic> sharedTimelines_;
+  SharedTimelinesStats sharedTimelinesStats_;
+
+  std::shared_ptr<WorkerPool> workerPool_;
+  std::vector<SharedTimelines<folly::dynamic>> workerSharedTimelines_;
+  UpdateRateClock updateRateClock_;
 
   CSSAnimationsVector buildAnimationsVector(
       jsi::Runtime &rt,
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const std::optional<std::vector<std::string>> &animationNames,
       const std::optional<CSSAnimationsMap> &newAnimations) const;
   AnimationToIndexMap buildAnimationToIndexMap(
@@ -77,6 +112,17 @@ class CSSAnimationsRegistry
       const std::vector<size_t> &animationIndices,
       double timestamp,
       bool addToBatch);
+  void updateViewsInParallel(double timestamp);
+  ViewAnimationsUpdate computeViewAnimationsUpdate(
+      Tag viewTag,
+      const std::vector<size_t> &animationIndices,
+      double timestamp,
+      bool addToBatch,
+      SharedTimelines<folly::dynamic> *sharedTimelines) const;
+  void applyViewAnimationsUpdate(ViewAnimationsUpdate &&update);
+  bool isViewUpdateDue(
+      const CSSAnimationsVector &animationsVector,
+      const std::vector<size_t> &animationIndices) const;
   void scheduleOrActivateAnimation(
       size_t animationIndex,
       const std::shared_ptr<CSSAnimation> &animation,
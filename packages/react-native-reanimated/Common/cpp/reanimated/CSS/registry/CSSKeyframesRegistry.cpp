@@ -23,4 +23,18 @@ void CSSKeyframesRegistry::remove(const std::string &animationName) {
   registry_.erase(animationName);
 }
 
+RegistryStats CSSKeyframesRegistry::getStats() const {
+  // Interpolators are not measured (their size depends on the interpolated
+  // properties), but baked styles, which usually dominate, are
+  RegistryStats stats{.entriesCount = registry_.size()};
+  for (const auto &[animationName, config] : registry_) {
+    stats.retainedBytes +=
+        sizeof(Registry::value_type) + animationName.capacity();
+    if (config.bakedStyles) {
+      stats.retainedBytes += config.bakedStyles->getRetainedBytes();
+    }
+  }
+  return stats;
+}
+
 } // namespace reanimated::css
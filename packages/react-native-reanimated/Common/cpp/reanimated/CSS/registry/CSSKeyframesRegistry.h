@@ -1,6 +1,7 @@
 #pragma once
 
 #include <reanimated/CSS/config/CSSKeyframesConfig.h>
+#include <reanimated/Tools/RegistryStats.h>
 
 #include <memory>
 #include <string>
@@ -14,9 +15,12 @@ class CSSKeyframesRegistry {
   const CSSKeyframesConfig &get(const std::string &animationName) const;
   void add(const std::string &animationName, CSSKeyframesConfig &&config);
   void remove(const std::string &animationName);
+  RegistryStats getStats() const;
 
  private:
-  std::unordered_map<std::string, CSSKeyframesConfig> registry_;
+  using Registry = std::unordered_map<std::string, CSSKeyframesConfig>;
+
+  Registry registry_;
 };
 
 } // namespace reanimated::css
@@ -18,10 +18,30 @@ bool CSSTransitionsRegistry::hasUpdates() const {
   return !runningTransitionTags_.empty() || !delayedTransitionsManager_.empty();
 }
 
+bool CSSTransitionsRegistry::hasActiveUpdates() const {
+  return !runningTransitionTags_.empty();
+}
+
+std::optional<double> CSSTransitionsRegistry::getNextDelayedTimestamp() const {
+  if (delayedTransitionsManager_.empty()) {
+    return std::nullopt;
+  }
+  return delayedTransitionsManager_.top().timestamp;
+}
+
+void CSSTransitionsRegistry::addStats(RegistryStats &stats) const {
+  const auto transitionBytes =
+      sizeof(Registry::value_type) + sizeof(CSSTransition);
+  stats.retainedBytes += registry_.size() * transitionBytes +
+      runningTransitionTags_.size() * sizeof(Tag);
+  stats.runningCount = runningTransitionTags_.size();
+  stats.delayedCount = delayedTransitionsManager_.size();
+}
+
 void CSSTransitionsRegistry::add(
     const std::shared_ptr<CSSTransition> &transition) {
   const auto &shadowNode = transition->getShadowNode();
-  const auto viewTag = shadowNode->getTag();
+  const auto viewTag = shadowNode.getTag();
 
   registry_.insert({viewTag, transition});
   PropsObserver observer = createPropsObserver(viewTag);
@@ -51,36 +71,91 @@ void CSSTransitionsRegistry::updateSettings(
 }
 
 void CSSTransitionsRegistry::update(const double timestamp) {
+  updateRateClock_.advance(timestamp);
   // Activate all delayed transitions that should start now
   activateDelayedTransitions(timestamp);
 
+  if (workerPool_ &&
+      runningTransitionTags_.size() >= PARALLEL_UPDATE_MIN_VIEWS_COUNT) {
+    updateTransitionsInParallel(timestamp);
+    return;
+  }
+
   // Iterate over active transitions and update them
   for (auto it = runningTransitionTags_.begin();
        it != runningTransitionTags_.end();) {
     const auto &viewTag = *it;
     const auto &transition = registry_[viewTag];
+    if (!isUpdateDue(transition)) {
+      ++it;
+      continue;
+    }
 
     const folly::dynamic &updates = transition->update(timestamp);
-    if (!updates.empty()) {
-      addUpdatesToBatch(transition->getShadowNode(), updates);
+    if (!handleTransitionUpdate(viewTag, transition, updates, timestamp)) {
+      it = runningTransitionTags_.erase(it);
+    } else {
+      ++it;
     }
+  }
+}
+
+void CSSTransitionsRegistry::setWorkerPool(
+    const std::shared_ptr<WorkerPool> &workerPool) {
+  workerPool_ = workerPool;
+}
 
-    // We remove transition from running and schedule it when animation of one
-    // of properties has finished and the other one is still delayed
-    const auto &minDelay = transition->getMinDelay(timestamp);
-    if (minDelay > 0) {
-      delayedTransitionsManager_.add(
-          timestamp + transition->getMinDelay(timestamp), viewTag);
+void CSSTransitionsRegistry::updateTransitionsInParallel(
+    const double timestamp) {
+  std::vector<std::shared_ptr<CSSTransition>> transitions;
+  transitions.reserve(runningTransitionTags_.size());
+  for (const auto viewTag : runningTransitionTags_) {
+    const auto &transition = registry_[viewTag];
+    if (isUpdateDue(transition)) {
+      transitions.push_back(transition);
     }
+  }
 
-    if (transition->getState() != TransitionProgressState::Running) {
-      it = runningTransitionTags_.erase(it);
-    } else {
-      ++it;
+  // Only interpolation runs on the pool threads. Results are merged into the
+  // updates batch on this thread, in the same order as the serial update.
+  std::vector<folly::dynamic> updates(transitions.size());
+  workerPool_->runInChunks(
+      transitions.size(),
+      [&](const size_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          updates[i] = transitions[i]->update(timestamp);
+        }
+      });
+
+  for (size_t i = 0; i < transitions.size(); ++i) {
+    const auto &transition = transitions[i];
+    const auto viewTag = transition->getShadowNode().getTag();
+    if (!handleTransitionUpdate(viewTag, transition, updates[i], timestamp)) {
+      runningTransitionTags_.erase(viewTag);
     }
   }
 }
 
+bool CSSTransitionsRegistry::handleTransitionUpdate(
+    const Tag viewTag,
+    const std::shared_ptr<CSSTransition> &transition,
+    const folly::dynamic &updates,
+    const double timestamp) {
+  if (!updates.empty()) {
+    addUpdatesToBatch(transition->getShadowNode(), updates);
+  }
+
+  // We remove transition from running and schedule it when animation of one
+  // of properties has finished and the other one is still delayed
+  const auto &minDelay = transition->getMinDelay(timestamp);
+  if (minDelay > 0) {
+    delayedTransitionsManager_.add(
+        timestamp + transition->getMinDelay(timestamp), viewTag);
+  }
+
+  return transition->getState() == TransitionProgressState::Running;
+}
+
 void CSSTransitionsRegistry::activateDelayedTransitions(
     const double timestamp) {
   while (!delayedTransitionsManager_.empty() &&
@@ -94,6 +169,12 @@ void CSSTransitionsRegistry::activateDelayedTransitions(
   }
 }
 
+bool CSSTransitionsRegistry::isUpdateDue(
+    const std::shared_ptr<CSSTransition> &transition) const {
+  return updateRateClock_.isDue(
+      transition->getUpdateRate(), transition->getLastUpdateTimestamp());
+}
+
 void CSSTransitionsRegistry::scheduleOrActivateTransition(
     const std::shared_ptr<CSSTransition> &transition) {
   const auto viewTag = transition->getViewTag();
@@ -135,7 +216,7 @@ PropsObserver CSSTransitionsRegistry::createPropsObserver(const Tag viewTag) {
 
       const auto &shadowNode = transition->getShadowNode();
       const auto &lastUpdates =
-          strongThis->getUpdatesFromRegistry(shadowNode->getTag());
+          strongThis->getUpdatesFromRegistry(shadowNode.getTag());
       const auto &transitionStartStyle = transition->run(
           changedProps, lastUpdates, strongThis->getCurrentTimestamp_());
       strongThis->updateInUpdatesRegistry(transition, transitionStartStyle);
@@ -148,7 +229,7 @@ void CSSTransitionsRegistry::updateInUpdatesRegistry(
     const std::shared_ptr<CSSTransition> &transition,
     const folly::dynamic &updates) {
   const auto &shadowNode = transition->getShadowNode();
-  const auto &lastUpdates = getUpdatesFromRegistry(shadowNode->getTag());
+  const auto &lastUpdates = getUpdatesFromRegistry(shadowNode.getTag());
   const auto &transitionProperties = transition->getProperties();
 
   folly::dynamic filteredUpdates = folly::dynamic::object;
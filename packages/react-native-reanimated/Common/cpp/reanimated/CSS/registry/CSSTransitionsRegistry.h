@@ -6,8 +6,10 @@
 #include <reanimated/CSS/util/props.h>
 #include <reanimated/Fabric/updates/UpdatesRegistry.h>
 #include <reanimated/Tools/PlatformDepMethodsHolder.h>
+#include <reanimated/Tools/WorkerPool.h>
 
 #include <memory>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -26,16 +28,28 @@ class CSSTransitionsRegistry
 
   bool isEmpty() const override;
   bool hasUpdates() const;
+  // Whether there are updates other than waiting for delayed items to start
+  bool hasActiveUpdates() const;
+  // Timestamp at which the earliest delayed item starts (if there is any)
+  std::optional<double> getNextDelayedTimestamp() const;
 
   void add(const std::shared_ptr<CSSTransition> &transition);
   void updateSettings(Tag viewTag, const PartialCSSTransitionConfig &config);
   void remove(Tag viewTag) override;
 
   void update(double timestamp);
+  // Transitions of different views are updated in parallel on the pool
+  // threads if there are enough running views (pass nullptr to disable)
+  void setWorkerPool(const std::shared_ptr<WorkerPool> &workerPool);
+
+ protected:
+  void addStats(RegistryStats &stats) const override;
 
  private:
   using Registry = std::unordered_map<Tag, std::shared_ptr<CSSTransition>>;
 
+  static constexpr size_t PARALLEL_UPDATE_MIN_VIEWS_COUNT = 64;
+
   const GetAnimationTimestampFunction &getCurrentTimestamp_;
   const std::shared_ptr<StaticPropsRegistry> staticPropsRegistry_;
 
@@ -43,8 +57,19 @@ class CSSTransitionsRegistry
 
   std::unordered_set<Tag> runningTransitionTags_;
   DelayedItemsManager<Tag> delayedTransitionsManager_;
+  std::shared_ptr<WorkerPool> workerPool_;
+  UpdateRateClock updateRateClock_;
 
   void activateDelayedTransitions(double timestamp);
+  // Transitions with a reduced update rate are skipped on off-frames
+  bool isUpdateDue(const std::shared_ptr<CSSTransition> &transition) const;
+  void updateTransitionsInParallel(double timestamp);
+  // Returns false if the transition is no longer running
+  bool handleTransitionUpdate(
+      Tag viewTag,
+      const std::shared_ptr<CSSTransition> &transition,
+      const folly::dynamic &updates,
+      double timestamp);
   void scheduleOrActivateTransition(
       const std::shared_ptr<CSSTransition> &transition);
   PropsObserver createPropsObserver(Tag viewTag);
@@ -37,6 +37,17 @@ bool StaticPropsRegistry::isEmpty() const {
   return registry_.empty() && observers_.empty();
 }
 
+RegistryStats StaticPropsRegistry::getStats() const {
+  RegistryStats stats{.entriesCount = registry_.size()};
+  for (const auto &[_, props] : registry_) {
+    stats.retainedBytes += sizeof(std::pair<const Tag, folly::dynamic>) +
+        getRetainedBytes(props) - sizeof(folly::dynamic);
+  }
+  stats.retainedBytes +=
+      observers_.size() * sizeof(std::pair<const Tag, PropsObserver>);
+  return stats;
+}
+
 bool StaticPropsRegistry::hasObservers(const Tag viewTag) const {
   return observers_.find(viewTag) != observers_.end();
 }
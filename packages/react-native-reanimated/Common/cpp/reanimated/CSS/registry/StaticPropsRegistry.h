@@ -1,5 +1,7 @@
 #pragma once
 
+#include <reanimated/Tools/RegistryStats.h>
+
 #include <react/renderer/core/ShadowNode.h>
 
 #include <unordered_map>
@@ -21,6 +23,7 @@ class StaticPropsRegistry {
   bool has(Tag viewTag) const;
   void remove(Tag viewTag);
   bool isEmpty() const;
+  RegistryStats getStats() const;
 
   bool hasObservers(Tag viewTag) const;
   void setObserver(Tag viewTag, PropsObserver observer);
@@ -0,0 +1,28 @@
+#include <reanimated/CSS/util/SharedTimelines.h>
+
+#include <algorithm>
+
+namespace reanimated::css {
+
+size_t AnimationTimelineKeyHash::operator()(
+    const AnimationTimelineKey &key) const {
+  size_t hash = std::hash<const void *>{}(key.styleInterpolator);
+  const auto combine = [&hash](const size_t value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+
+  combine(std::hash<const void *>{}(key.keyframeEasingFunctions));
+  combine(std::hash<std::string_view>{}(key.easingFunctionKey));
+  combine(std::hash<double>{}(key.progress));
+  return hash;
+}
+
+void SharedTimelinesStats::merge(const SharedTimelinesStats &other) {
+  sharedTimelinesCount += other.sharedTimelinesCount;
+  sharedAnimationsCount += other.sharedAnimationsCount;
+  largestTimelineSize =
+      std::max(largestTimelineSize, other.largestTimelineSize);
+  exclusiveAnimationsCount += other.exclusiveAnimationsCount;
+}
+
+} // namespace reanimated::css
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace reanimated::css {
+
+// Identifies the point of the animation timeline for which the interpolated
+// style was computed. Animations that use the same keyframes and easing and
+// are at the same global progress produce the same (view-independent) style.
+struct AnimationTimelineKey {
+  // Identities of the keyframes style interpolator and of the keyframe
+  // easing functions (only compared, never dereferenced)
+  const void *styleInterpolator;
+  const void *keyframeEasingFunctions;
+  std::string_view easingFunctionKey;
+  // Compared exactly, as the style is shared only if it would be the same
+  double progress;
+
+  bool operator==(const AnimationTimelineKey &other) const = default;
+};
+
+struct AnimationTimelineKeyHash {
+  size_t operator()(const AnimationTimelineKey &key) const;
+};
+
+struct SharedTimelinesStats {
+  // Number of timelines shared by at least 2 animations
+  size_t sharedTimelinesCount = 0;
+  // Number of animations that re-used the style of a shared timeline
+  size_t sharedAnimationsCount = 0;
+  size_t largestTimelineSize = 0;
+  // Number of animations which style was interpolated on their own (because
+  // they depend on the view or no other animation shared their timeline)
+  size_t exclusiveAnimationsCount = 0;
+
+  // Combines stats collected by different threads in the same frame
+  void merge(const SharedTimelinesStats &other);
+};
+
+// Per-frame cache of interpolated animation styles. Styles are reused only
+// within a single frame - the cache is cleared by the finishFrame() call.
+template <typename TStyle>
+class SharedTimelines {
+ public:
+  // Returns the style interpolated in this frame for the same timeline key or
+  // interpolates it. Animations without a key (which style depends on the
+  // view) always interpolate their own style.
+  TStyle getOrInterpolate(
+      const std::optional<AnimationTimelineKey> &key,
+      const std::function<TStyle()> &interpolate) {
+    if (!key.has_value()) {
+      exclusiveAnimationsCount_++;
+      return interpolate();
+    }
+
+    auto it = timelines_.find(key.value());
+    if (it == timelines_.end()) {
+      it = timelines_.emplace(key.value(), TimelineEntry{interpolate(), 0})
+               .first;
+    }
+    it->second.animationsCount++;
+    return it->second.style;
+  }
+
+  void finishFrame() {
+    stats_ = {.exclusiveAnimationsCount = exclusiveAnimationsCount_};
+
+    for (const auto &[_, entry] : timelines_) {
+      if (entry.animationsCount < 2) {
+        stats_.exclusiveAnimationsCount++;
+        continue;
+      }
+      stats_.sharedTimelinesCount++;
+      stats_.sharedAnimationsCount += entry.animationsCount;
+      stats_.largestTimelineSize =
+          std::max(stats_.largestTimelineSize, entry.animationsCount);
+    }
+
+    timelines_.clear();
+    exclusiveAnimationsCount_ = 0;
+  }
+
+  // Returns stats from the most recently finished frame
+  const SharedTimelinesStats &getStats() const {
+    return stats_;
+  }
+
+ private:
+  struct TimelineEntry {
+    TStyle style;
+    size_t animationsCount;
+  };
+
+  std::unordered_map<
+      AnimationTimelineKey,
+      TimelineEntry,
+      AnimationTimelineKeyHash>
+      timelines_;
+  size_t exclusiveAnimationsCount_ = 0;
+  SharedTimelinesStats stats_;
+};
+
+} // namespace reanimated::css
@@ -49,8 +49,8 @@ void ReanimatedCommitHook::maybeInitializeLayoutAnimations(
 }
 
 RootShadowNode::Unshared ReanimatedCommitHook::shadowTreeWillCommit(
-    ShadowTree const &,
-    RootShadowNode::Shared const &,
+    ShadowTree const &shadowTree,
+    RootShadowNode::Shared const &oldRootShadowNode,
     RootShadowNode::Unshared const &newRootShadowNode
 #if REACT_NATIVE_MINOR_VERSION >= 80
     ,
@@ -81,10 +81,17 @@ RootShadowNode::Unshared ReanimatedCommitHook::shadowTreeWillCommit(
   {
     auto lock = updatesRegistryManager_->lock();
 
-    PropsMap propsMap = updatesRegistryManager_->collectProps();
-    updatesRegistryManager_->cancelCommitAfterPause();
+    // Only views re-created by this commit lose their animated props, so we
+    // don't have to clone the whole set of animated views on every commit
+    PropsMap propsMap = updatesRegistryManager_->collectPropsToReapply(
+        *oldRootShadowNode, *rootNode);
 
-    rootNode = cloneShadowTreeWithNewProps(*rootNode, propsMap);
+    if (!propsMap.empty()) {
+      rootNode = cloneShadowTreeWithNewProps(*rootNode, propsMap);
+    }
+    // Pending updates of the surface are applied by this commit, but they
+    // are considered committed only once the tree is mounted
+    updatesRegistryManager_->setReappliedRoot(*rootNode);
     // If the commit comes from React Native then pause commits from
     // Reanimated since the ShadowTree to be committed by Reanimated may not
     // include the new changes from React Native yet and all changes of animated
@@ -102,6 +109,18 @@ RootShadowNode::Unshared ReanimatedCommitHook::shadowTreeWillCommit(
 #endif
   }
 
+  // Props of views that start entering animations are cloned here, on the
+  // commit thread, instead of while the transaction is mounted. Hooks are run
+  // before the new revision is created, so its number is the one that follows
+  // the current revision (if the commit fails, the prepared views are cleared
+  // once the revision of the competing commit is mounted).
+  if (layoutAnimationsProxy_) {
+    layoutAnimationsProxy_->prepareEnteringViews(
+        *oldRootShadowNode,
+        *rootNode,
+        shadowTree.getCurrentRevision().number + 1);
+  }
+
   return rootNode;
 }
 
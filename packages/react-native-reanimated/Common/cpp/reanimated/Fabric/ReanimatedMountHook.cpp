@@ -1,16 +1,23 @@
 #include <reanimated/Fabric/ReanimatedCommitShadowNode.h>
 #include <reanimated/Fabric/ReanimatedMountHook.h>
+#include <reanimated/Tools/FeatureFlags.h>
 #include <reanimated/Tools/ReanimatedSystraceSection.h>
 
+#include <limits>
+
 namespace reanimated {
 
 ReanimatedMountHook::ReanimatedMountHook(
     const std::shared_ptr<UIManager> &uiManager,
     const std::shared_ptr<UpdatesRegistryManager> &updatesRegistryManager,
-    const std::function<void()> &requestFlush)
+    const std::shared_ptr<LayoutAnimationsProxy> &layoutAnimationsProxy,
+    const std::function<void()> &requestFlush,
+    const std::function<void()> &onReactNativeMount)
     : uiManager_(uiManager),
       updatesRegistryManager_(updatesRegistryManager),
-      requestFlush_(requestFlush) {
+      layoutAnimationsProxy_(layoutAnimationsProxy),
+      requestFlush_(requestFlush),
+      onReactNativeMount_(onReactNativeMount) {
   uiManager_->registerMountHook(*this);
 }
 
@@ -23,6 +30,13 @@ void ReanimatedMountHook::shadowTreeDidMount(
     double) noexcept {
   ReanimatedSystraceSection s("ReanimatedMountHook::shadowTreeDidMount");
 
+  // Views removed by the next transaction are measured in the mounted tree,
+  // which includes changes committed by Reanimated
+  if (layoutAnimationsProxy_) {
+    layoutAnimationsProxy_->setMountedRoot(rootShadowNode);
+    clearPreparedEnteringViews(rootShadowNode->getSurfaceId());
+  }
+
   auto reaShadowNode =
       std::reinterpret_pointer_cast<ReanimatedCommitShadowNode>(
           std::const_pointer_cast<RootShadowNode>(rootShadowNode));
@@ -39,6 +53,12 @@ void ReanimatedMountHook::shadowTreeDidMount(
   {
     auto lock = updatesRegistryManager_->lock();
     updatesRegistryManager_->handleNodeRemovals(*rootShadowNode);
+    updatesRegistryManager_->handleMountedRoot(*rootShadowNode);
+    // Pending updates were applied by React Native commits, but there may
+    // still be other surfaces that have to be flushed after the pause
+    if (!updatesRegistryManager_->hasOutOfSyncSurfaces()) {
+      updatesRegistryManager_->cancelCommitAfterPause();
+    }
 
     // When commit from React Native has finished, we reset the skip commit flag
     // in order to allow Reanimated to commit its tree
@@ -47,6 +67,29 @@ void ReanimatedMountHook::shadowTreeDidMount(
       requestFlush_();
     }
   }
+
+  onReactNativeMount_();
+}
+
+void ReanimatedMountHook::clearPreparedEnteringViews(
+    const SurfaceId surfaceId) const {
+  if constexpr (StaticFeatureFlags::getFlag(
+                    "PREPARE_LAYOUT_ANIMATIONS_ON_COMMIT")) {
+    // A single transaction can mount several commits, so the views are
+    // cleared by the mounted revision, which is the base revision of the
+    // mounting coordinator. It may already be a newer one, pulled in the
+    // meantime, but its views were taken when it was pulled. Views of
+    // stopped surfaces won't be mounted anymore.
+    auto mountedRevision =
+        std::numeric_limits<ShadowTreeRevision::Number>::max();
+    uiManager_->getShadowTreeRegistry().visit(
+        surfaceId, [&](const ShadowTree &shadowTree) {
+          mountedRevision =
+              shadowTree.getMountingCoordinator()->getBaseRevision().number;
+        });
+    layoutAnimationsProxy_->clearPreparedEnteringViews(
+        surfaceId, mountedRevision);
+  }
 }
 
 } // namespace reanimated
@@ -2,9 +2,11 @@
 
 #include <reanimated/Fabric/ShadowTreeCloner.h>
 #include <reanimated/Fabric/updates/UpdatesRegistryManager.h>
+#include <reanimated/LayoutAnimations/LayoutAnimationsProxy.h>
 
 #include <react/renderer/uimanager/UIManagerMountHook.h>
 
+#include <functional>
 #include <memory>
 
 namespace reanimated {
@@ -16,7 +18,9 @@ class ReanimatedMountHook : public UIManagerMountHook {
   ReanimatedMountHook(
       const std::shared_ptr<UIManager> &uiManager,
       const std::shared_ptr<UpdatesRegistryManager> &updatesRegistryManager,
-      const std::function<void()> &requestFlush);
+      const std::shared_ptr<LayoutAnimationsProxy> &layoutAnimationsProxy,
+      const std::function<void()> &requestFlush,
+      const std::function<void()> &onReactNativeMount);
   ~ReanimatedMountHook() noexcept override;
 
   void shadowTreeDidMount(
@@ -24,9 +28,15 @@ class ReanimatedMountHook : public UIManagerMountHook {
       double mountTime) noexcept override;
 
  private:
+  // Clears entering views that were prepared by commits included in the
+  // mounted revision of the surface
+  void clearPreparedEnteringViews(SurfaceId surfaceId) const;
+
   const std::shared_ptr<UIManager> uiManager_;
   const std::shared_ptr<UpdatesRegistryManager> updatesRegistryManager_;
+  const std::shared_ptr<LayoutAnimationsProxy> layoutAnimationsProxy_;
   const std::function<void()> requestFlush_;
+  const std::function<void()> onReactNativeMount_;
 };
 
 } // namespace reanimated
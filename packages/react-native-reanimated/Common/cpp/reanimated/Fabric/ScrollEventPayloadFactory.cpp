@@ -0,0 +1,63 @@
+#include <reanimated/Fabric/ScrollEventPayloadFactory.h>
+
+#include <react/renderer/components/scrollview/ScrollEvent.h>
+
+#include <typeinfo>
+#include <utility>
+
+namespace reanimated {
+
+std::optional<jsi::Value> ScrollEventPayloadFactory::create(
+    jsi::Runtime &rt,
+    const uint64_t runtimeGeneration,
+    const EventPayload &payload) {
+  if (payload.getType() != EventPayloadType::ScrollEvent ||
+      typeid(payload) != typeid(ScrollEvent)) {
+    return std::nullopt;
+  }
+  const auto &scrollEvent = static_cast<const ScrollEvent &>(payload);
+
+  const auto setNumber = [&](jsi::Object &object,
+                             const char *name,
+                             const double value) {
+    object.setProperty(
+        rt, propertyNames_.get(rt, runtimeGeneration, name), value);
+  };
+  const auto setObject = [&](jsi::Object &object,
+                             const char *name,
+                             const jsi::Object &value) {
+    object.setProperty(
+        rt, propertyNames_.get(rt, runtimeGeneration, name), value);
+  };
+
+  auto result = jsi::Object(rt);
+
+  auto contentOffset = jsi::Object(rt);
+  setNumber(contentOffset, "x", scrollEvent.contentOffset.x);
+  setNumber(contentOffset, "y", scrollEvent.contentOffset.y);
+  setObject(result, "contentOffset", contentOffset);
+
+  auto contentInset = jsi::Object(rt);
+  setNumber(contentInset, "top", scrollEvent.contentInset.top);
+  setNumber(contentInset, "left", scrollEvent.contentInset.left);
+  setNumber(contentInset, "bottom", scrollEvent.contentInset.bottom);
+  setNumber(contentInset, "right", scrollEvent.contentInset.right);
+  setObject(result, "contentInset", contentInset);
+
+  auto contentSize = jsi::Object(rt);
+  setNumber(contentSize, "width", scrollEvent.contentSize.width);
+  setNumber(contentSize, "height", scrollEvent.contentSize.height);
+  setObject(result, "contentSize", contentSize);
+
+  auto layoutMeasurement = jsi::Object(rt);
+  setNumber(layoutMeasurement, "width", scrollEvent.containerSize.width);
+  setNumber(layoutMeasurement, "height", scrollEvent.containerSize.height);
+  setObject(result, "layoutMeasurement", layoutMeasurement);
+
+  setNumber(result, "zoomScale", scrollEvent.zoomScale);
+  setNumber(result, "timestamp", scrollEvent.timestamp * 1000);
+
+  return jsi::Value(std::move(result));
+}
+
+} // namespace reanimated
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <worklets/Tools/RuntimeStringCache.h>
+
+#include <jsi/jsi.h>
+#include <react/renderer/core/EventPayload.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace reanimated {
+
+using namespace facebook;
+using namespace react;
+using namespace worklets;
+
+// Typed fast path for the payloads of scroll events, which are dispatched on
+// every frame while scrolling. The payload object is built the same way as
+// `ScrollEvent::asJSIValue` does it, but the property names are created once
+// per runtime instead of for every event. A new object is created for every
+// event, as handlers may keep a reference to it.
+class ScrollEventPayloadFactory {
+ public:
+  // Returns std::nullopt for payloads other than `ScrollEvent` (including its
+  // subclasses, which add their own fields)
+  std::optional<jsi::Value> create(
+      jsi::Runtime &rt,
+      uint64_t runtimeGeneration,
+      const EventPayload &payload);
+
+ private:
+  RuntimeStringCache propertyNames_;
+};
+
+} // namespace reanimated
@@ -0,0 +1,39 @@
+#include <reanimated/Fabric/ShadowNodeHandle.h>
+
+namespace reanimated {
+
+ShadowNodeHandle::ShadowNodeHandle(const ShadowNode &shadowNode)
+    : family_(shadowNode.getFamilyShared()) {}
+
+Tag ShadowNodeHandle::getTag() const {
+  return family_->getTag();
+}
+
+SurfaceId ShadowNodeHandle::getSurfaceId() const {
+  return family_->getSurfaceId();
+}
+
+const ShadowNodeFamily &ShadowNodeHandle::getFamily() const {
+  return *family_;
+}
+
+ShadowNode::Shared ShadowNodeHandle::resolve(
+    const ShadowTreeRegistry &shadowTreeRegistry) const {
+  ShadowNode::Shared shadowNode = nullptr;
+  shadowTreeRegistry.visit(getSurfaceId(), [&](const ShadowTree &shadowTree) {
+    shadowNode = resolve(*shadowTree.getCurrentRevision().rootShadowNode);
+  });
+  return shadowNode;
+}
+
+ShadowNode::Shared ShadowNodeHandle::resolve(
+    const RootShadowNode &rootShadowNode) const {
+  const auto ancestors = family_->getAncestors(rootShadowNode);
+  if (ancestors.empty()) {
+    return nullptr;
+  }
+  const auto &[parentNode, index] = ancestors.back();
+  return parentNode.get().getChildren()[index];
+}
+
+} // namespace reanimated
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+#include <memory>
+
+namespace reanimated {
+
+using namespace facebook;
+using namespace react;
+
+// Reference to a view that doesn't keep any revision of its shadow tree alive.
+// Holding ShadowNode::Shared retains the node, its props and state (and,
+// through its children, the whole subtree) long after React has replaced
+// them, so only the family (shared by all clones of the node) is stored and
+// the newest clone is looked up when it is needed.
+class ShadowNodeHandle {
+ public:
+  ShadowNodeHandle() = default;
+  explicit ShadowNodeHandle(const ShadowNode &shadowNode);
+
+  Tag getTag() const;
+  SurfaceId getSurfaceId() const;
+  const ShadowNodeFamily &getFamily() const;
+
+  explicit operator bool() const {
+    return family_ != nullptr;
+  }
+
+  // Returns the node from the current revision of the shadow tree or nullptr
+  // if the view is not mounted
+  ShadowNode::Shared resolve(
+      const ShadowTreeRegistry &shadowTreeRegistry) const;
+  ShadowNode::Shared resolve(const RootShadowNode &rootShadowNode) const;
+
+ private:
+  ShadowNodeFamily::Shared family_;
+};
+
+} // namespace reanimated
@@ -1,4 +1,5 @@
 #include <reanimated/Fabric/ShadowTreeCloner.h>
+#include <reanimated/Fabric/updates/PropsUpdates.h>
 #include <reanimated/Tools/ReanimatedSystraceSection.h>
 
 #include <ranges>
@@ -21,26 +22,20 @@ Props::Shared mergeProps(
   PropsParserContext propsParserContext{
       shadowNode.getSurfaceId(), *shadowNode.getContextContainer()};
   const auto &propsVector = it->second;
-  auto newProps = shadowNode.getProps();
-
-#ifdef ANDROID
-  if (propsVector.size() > 1) {
-    folly::dynamic newPropsDynamic = folly::dynamic::object;
-    for (const auto &props : propsVector) {
-      newPropsDynamic = folly::dynamic::merge(
-          props.operator folly::dynamic(), newPropsDynamic);
-    }
-    return shadowNode.getComponentDescriptor().cloneProps(
-        propsParserContext, newProps, RawProps(newPropsDynamic));
-  }
-#endif
 
-  for (const auto &props : propsVector) {
-    newProps = shadowNode.getComponentDescriptor().cloneProps(
-        propsParserContext, newProps, RawProps(props));
+  if (propsVector.size() == 1) {
+    return shadowNode.getComponentDescriptor().cloneProps(
+        propsParserContext,
+        shadowNode.getProps(),
+        RawProps(propsVector.front()));
   }
 
-  return newProps;
+  // Updates from all registries are merged first, so that props of the view
+  // are parsed and cloned only once, no matter how many registries animate it
+  return shadowNode.getComponentDescriptor().cloneProps(
+      propsParserContext,
+      shadowNode.getProps(),
+      RawProps(mergePropsUpdates(propsVector)));
 }
 
 ShadowNode::Unshared cloneShadowTreeWithNewPropsRecursive(
@@ -14,8 +14,10 @@ using namespace react;
 
 namespace reanimated {
 
+// Props updates of every family, in the order of priority of registries
+// they come from (later updates override earlier ones)
 using PropsMap =
-    std::unordered_map<const ShadowNodeFamily *, std::vector<RawProps>>;
+    std::unordered_map<const ShadowNodeFamily *, std::vector<folly::dynamic>>;
 using ChildrenMap =
     std::unordered_map<const ShadowNodeFamily *, std::unordered_set<int>>;
 
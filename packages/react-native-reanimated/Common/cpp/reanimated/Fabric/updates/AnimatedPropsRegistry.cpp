@@ -12,15 +12,95 @@ void AnimatedPropsRegistry::update(
   for (size_t i = 0, length = operationsArray.size(rt); i < length; ++i) {
     auto item = operationsArray.getValueAtIndex(rt, i).asObject(rt);
     auto shadowNodeWrapper = item.getProperty(rt, "shadowNodeWrapper");
-    auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
+    const ShadowNodeHandle shadowNode(
+        *shadowNodeFromValue(rt, shadowNodeWrapper));
 
     const jsi::Value &updates = item.getProperty(rt, "updates");
-    addUpdatesToBatch(shadowNode, jsi::dynamicFromValue(rt, updates));
+    auto props = jsi::dynamicFromValue(rt, updates);
+
+    const auto throttledIt = throttledViews_.find(shadowNode.getTag());
+    if (throttledIt == throttledViews_.end()) {
+      addUpdatesToBatch(shadowNode, props);
+      continue;
+    }
+
+    auto &throttledView = throttledIt->second;
+    throttledView.shadowNode = shadowNode;
+    if (throttledView.pendingUpdates.isNull()) {
+      throttledView.pendingUpdates = std::move(props);
+    } else {
+      throttledView.pendingUpdates.update(props);
+    }
   }
 }
 
 void AnimatedPropsRegistry::remove(const Tag tag) {
   updatesRegistry_.erase(tag);
+  throttledViews_.erase(tag);
+}
+
+void AnimatedPropsRegistry::setUpdateRate(
+    const Tag tag,
+    const UpdateRate &updateRate) {
+  const auto it = throttledViews_.find(tag);
+
+  if (updateRate.isFull()) {
+    if (it == throttledViews_.end()) {
+      return;
+    }
+    // Don't lose props that were held back before the rate was changed
+    if (!it->second.pendingUpdates.isNull()) {
+      addUpdatesToBatch(it->second.shadowNode, it->second.pendingUpdates);
+    }
+    throttledViews_.erase(it);
+    return;
+  }
+
+  if (it == throttledViews_.end()) {
+    throttledViews_.emplace(tag, ThrottledView{.updateRate = updateRate});
+  } else {
+    it->second.updateRate = updateRate;
+  }
+}
+
+void AnimatedPropsRegistry::releaseThrottledUpdates(const double timestamp) {
+  if (throttledViews_.empty()) {
+    return;
+  }
+
+  updateRateClock_.advance(timestamp);
+
+  for (auto &[_, throttledView] : throttledViews_) {
+    if (throttledView.pendingUpdates.isNull() ||
+        !updateRateClock_.isDue(
+            throttledView.updateRate, throttledView.lastUpdateTimestamp)) {
+      continue;
+    }
+
+    addUpdatesToBatch(throttledView.shadowNode, throttledView.pendingUpdates);
+    throttledView.pendingUpdates = nullptr;
+    throttledView.lastUpdateTimestamp = timestamp;
+  }
+}
+
+void AnimatedPropsRegistry::addStats(RegistryStats &stats) const {
+  for (const auto &[_, throttledView] : throttledViews_) {
+    stats.retainedBytes += sizeof(std::pair<const Tag, ThrottledView>) +
+        getRetainedBytes(throttledView.pendingUpdates) - sizeof(folly::dynamic);
+    // Held back props are waiting for the frame in which they are due
+    if (!throttledView.pendingUpdates.isNull()) {
+      stats.delayedCount++;
+    }
+  }
+}
+
+bool AnimatedPropsRegistry::hasThrottledUpdates() const {
+  for (const auto &[_, throttledView] : throttledViews_) {
+    if (!throttledView.pendingUpdates.isNull()) {
+      return true;
+    }
+  }
+  return false;
 }
 
 } // namespace reanimated
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <reanimated/Fabric/updates/UpdateRate.h>
 #include <reanimated/Fabric/updates/UpdatesRegistry.h>
 
 #include <react/renderer/uimanager/UIManager.h>
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace reanimated {
@@ -14,6 +16,29 @@ class AnimatedPropsRegistry : public UpdatesRegistry {
  public:
   void update(jsi::Runtime &rt, const jsi::Value &operations);
   void remove(Tag tag) override;
+
+  // Props of views with a reduced update rate are held back until the frame
+  // in which they are due (only the most recent values are kept)
+  void setUpdateRate(Tag tag, const UpdateRate &updateRate);
+  // Adds held back props that are due in the current frame to the batch.
+  // Must be called once per frame, before updates are flushed.
+  void releaseThrottledUpdates(double timestamp);
+  bool hasThrottledUpdates() const;
+
+ protected:
+  void addStats(RegistryStats &stats) const override;
+
+ private:
+  struct ThrottledView {
+    UpdateRate updateRate;
+    double lastUpdateTimestamp = NEVER_UPDATED_TIMESTAMP;
+    ShadowNodeHandle shadowNode;
+    // Null if there are no props waiting for the next update
+    folly::dynamic pendingUpdates;
+  };
+
+  std::unordered_map<Tag, ThrottledView> throttledViews_;
+  UpdateRateClock updateRateClock_;
 };
 
 } // namespace reanimated
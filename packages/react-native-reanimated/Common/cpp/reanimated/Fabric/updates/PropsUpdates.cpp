@@ -0,0 +1,13 @@
+#include <reanimated/Fabric/updates/PropsUpdates.h>
+
+namespace reanimated {
+
+folly::dynamic mergePropsUpdates(const std::vector<folly::dynamic> &updates) {
+  folly::dynamic mergedProps = folly::dynamic::object;
+  for (const auto &props : updates) {
+    mergedProps.update(props);
+  }
+  return mergedProps;
+}
+
+} // namespace reanimated
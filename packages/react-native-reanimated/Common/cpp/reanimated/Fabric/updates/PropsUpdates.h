@@ -0,0 +1,16 @@
+#pragma once
+
+#include <folly/dynamic.h>
+
+#include <vector>
+
+namespace reanimated {
+
+// Merges props updates of a view coming from different registries into a
+// single update. Updates are passed in the order of priority of registries
+// they come from, so later updates override props of earlier ones. Props are
+// overridden as a whole (e.g. a transform is never combined from a few
+// updates).
+folly::dynamic mergePropsUpdates(const std::vector<folly::dynamic> &updates);
+
+} // namespace reanimated
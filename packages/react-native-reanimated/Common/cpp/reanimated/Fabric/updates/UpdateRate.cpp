@@ -0,0 +1,87 @@
+#include <reanimated/Fabric/updates/UpdateRate.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace reanimated {
+
+UpdateRate UpdateRate::full() {
+  return {.type = Type::Full};
+}
+
+UpdateRate UpdateRate::half() {
+  return {.type = Type::Half};
+}
+
+UpdateRate UpdateRate::fixed(const double fps) {
+  return {.type = Type::Fixed, .fps = fps};
+}
+
+bool UpdateRate::isFull() const {
+  return type == Type::Full;
+}
+
+UpdateRate parseUpdateRate(const std::string &str) {
+  if (str == "full") {
+    return UpdateRate::full();
+  }
+  if (str == "half") {
+    return UpdateRate::half();
+  }
+  throw std::invalid_argument("[Reanimated] Invalid update rate: " + str);
+}
+
+UpdateRate parseUpdateRate(const double fps) {
+  if (!(fps > 0)) {
+    throw std::invalid_argument(
+        "[Reanimated] Update rate must be a positive number, received: " +
+        std::to_string(fps));
+  }
+  return UpdateRate::fixed(fps);
+}
+
+void UpdateRateClock::advance(const double timestamp) {
+  if (previousTimestamp_.has_value()) {
+    const auto intervalMs = timestamp - previousTimestamp_.value();
+    if (intervalMs > 0 && intervalMs < MAX_FRAME_INTERVAL_MS) {
+      // Frame timestamps jitter, so the interval is smoothed to keep slots of
+      // consecutive frames consistent
+      frameIntervalMs_ +=
+          (intervalMs - frameIntervalMs_) * FRAME_INTERVAL_SMOOTHING;
+    }
+  }
+  previousTimestamp_ = timestamp;
+  timestamp_ = timestamp;
+}
+
+double UpdateRateClock::getTimestamp() const {
+  return timestamp_;
+}
+
+bool UpdateRateClock::isDue(
+    const UpdateRate &updateRate,
+    const double lastUpdateTimestamp) const {
+  if (updateRate.isFull() || lastUpdateTimestamp == NEVER_UPDATED_TIMESTAMP) {
+    return true;
+  }
+
+  const auto periodMs = updateRate.type == UpdateRate::Type::Half
+      ? 2 * frameIntervalMs_
+      : 1000 / updateRate.fps;
+  if (periodMs <= frameIntervalMs_) {
+    return true;
+  }
+
+  return getSlot(timestamp_, periodMs) !=
+      getSlot(lastUpdateTimestamp, periodMs);
+}
+
+double UpdateRateClock::getSlot(const double timestamp, const double periodMs)
+    const {
+  // Frame timestamps jitter, so the slot is picked based on the nearest frame
+  // boundary rather than the exact timestamp
+  return std::floor((timestamp + frameIntervalMs_ / 2) / periodMs);
+}
+
+} // namespace reanimated
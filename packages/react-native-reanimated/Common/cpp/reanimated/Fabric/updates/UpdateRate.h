@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+
+namespace reanimated {
+
+// How often updates of an animation are evaluated and committed. Decorative
+// animations (e.g. spinners or shimmers) usually don't need to be updated at
+// the display refresh rate.
+struct UpdateRate {
+  enum class Type : uint8_t { Full, Half, Fixed };
+
+  Type type = Type::Full;
+  // Updates per second (used only by the Fixed type)
+  double fps = 0;
+
+  static UpdateRate full();
+  static UpdateRate half();
+  static UpdateRate fixed(double fps);
+
+  bool isFull() const;
+  bool operator==(const UpdateRate &other) const = default;
+};
+
+// Accepts "full" or "half"
+UpdateRate parseUpdateRate(const std::string &str);
+// Accepts a positive number of updates per second
+UpdateRate parseUpdateRate(double fps);
+
+inline constexpr double NEVER_UPDATED_TIMESTAMP =
+    -std::numeric_limits<double>::infinity();
+
+// Tracks frames in which a registry is updated and decides whether updates
+// with a reduced rate are due in the current frame. Updates are aligned to
+// the same time slots, so all updates with the same rate land in the same
+// frames (and in the same commit).
+class UpdateRateClock {
+ public:
+  // Must be called once per frame, before isDue() is used
+  void advance(double timestamp);
+
+  double getTimestamp() const;
+  bool isDue(const UpdateRate &updateRate, double lastUpdateTimestamp) const;
+
+ private:
+  // Longer intervals are treated as pauses between frames and are not used
+  // to estimate the frame interval
+  static constexpr double MAX_FRAME_INTERVAL_MS = 100;
+  // Weight of the latest interval in the estimated frame interval
+  static constexpr double FRAME_INTERVAL_SMOOTHING = 0.125;
+
+  double timestamp_ = 0;
+  std::optional<double> previousTimestamp_;
+  double frameIntervalMs_ = 1000.0 / 60;
+
+  double getSlot(double timestamp, double periodMs) const;
+};
+
+} // namespace reanimated
@@ -20,6 +20,23 @@ folly::dynamic UpdatesRegistry::get(const Tag tag) const {
   return it->second.second;
 }
 
+RegistryStats UpdatesRegistry::getStats() const {
+  std::lock_guard<std::mutex> lock{mutex_};
+
+  RegistryStats stats{.entriesCount = updatesRegistry_.size()};
+  for (const auto &[_, pair] : updatesRegistry_) {
+    stats.retainedBytes += sizeof(RegistryMap::value_type) +
+        getRetainedBytes(pair.second) - sizeof(folly::dynamic);
+  }
+  for (const auto &[_, props] : updatesBatch_) {
+    stats.retainedBytes += sizeof(UpdatesBatch::value_type) +
+        getRetainedBytes(props) - sizeof(folly::dynamic);
+  }
+  addStats(stats);
+
+  return stats;
+}
+
 void UpdatesRegistry::flushUpdates(UpdatesBatch &updatesBatch) {
   auto copiedUpdatesBatch = std::move(updatesBatch_);
   updatesBatch_.clear();
@@ -28,6 +45,11 @@ void UpdatesRegistry::flushUpdates(UpdatesBatch &updatesBatch) {
   flushUpdatesToRegistry(copiedUpdatesBatch);
   // Flush the updates to the updatesBatch used to apply current changes
   for (auto &[shadowNode, props] : copiedUpdatesBatch) {
+    const auto tag = shadowNode.getTag();
+    if (isCulled(tag)) {
+      viewportCuller_->holdBackUpdates(tag);
+      continue;
+    }
     updatesBatch.emplace_back(shadowNode, std::move(props));
   }
 }
@@ -35,32 +57,65 @@ void UpdatesRegistry::flushUpdates(UpdatesBatch &updatesBatch) {
 void UpdatesRegistry::collectProps(PropsMap &propsMap) {
   std::lock_guard<std::mutex> lock{mutex_};
 
-  auto copiedRegistry = updatesRegistry_;
-  for (const auto &[tag, pair] : copiedRegistry) {
+  for (const auto &[tag, pair] : updatesRegistry_) {
     const auto &[shadowNode, props] = pair;
-    auto &family = shadowNode->getFamily();
-    auto it = propsMap.find(&family);
+    propsMap[&shadowNode.getFamily()].push_back(props);
+  }
+}
 
-    if (it == propsMap.cend()) {
-      auto propsVector = std::vector<RawProps>{};
-      propsVector.emplace_back(RawProps(props));
-      propsMap.emplace(&family, propsVector);
-    } else {
-      it->second.push_back(RawProps(props));
+void UpdatesRegistry::collectProps(
+    PropsMap &propsMap,
+    const SurfaceId surfaceId,
+    const std::function<bool(const ShadowNodeFamily &)> &shouldCollect) {
+  std::lock_guard<std::mutex> lock{mutex_};
+
+  for (const auto &[tag, pair] : updatesRegistry_) {
+    const auto &[shadowNode, props] = pair;
+    const auto &family = shadowNode.getFamily();
+    if (family.getSurfaceId() != surfaceId || !shouldCollect(family)) {
+      continue;
     }
+    propsMap[&family].emplace_back(props);
   }
 }
 
+void UpdatesRegistry::collectShadowNodes(
+    std::unordered_map<Tag, ShadowNodeHandle> &shadowNodes) const {
+  std::lock_guard<std::mutex> lock{mutex_};
+
+  for (const auto &[tag, pair] : updatesRegistry_) {
+    shadowNodes.emplace(tag, pair.first);
+  }
+}
+
+void UpdatesRegistry::collectUpdates(
+    const std::unordered_set<Tag> &tags,
+    UpdatesBatch &updatesBatch) const {
+  std::lock_guard<std::mutex> lock{mutex_};
+
+  for (const auto tag : tags) {
+    const auto it = updatesRegistry_.find(tag);
+    if (it != updatesRegistry_.cend()) {
+      updatesBatch.emplace_back(it->second.first, it->second.second);
+    }
+  }
+}
+
+void UpdatesRegistry::setViewportCuller(
+    const std::shared_ptr<ViewportCuller> &culler) {
+  viewportCuller_ = culler;
+}
+
 void UpdatesRegistry::addUpdatesToBatch(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const folly::dynamic &props) {
   updatesBatch_.emplace_back(shadowNode, props);
 }
 
 void UpdatesRegistry::setInUpdatesRegistry(
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const folly::dynamic &props) {
-  const auto tag = shadowNode->getTag();
+  const auto tag = shadowNode.getTag();
 #ifdef ANDROID
   updatePropsToRevert(tag, &props);
 #endif
@@ -82,9 +137,13 @@ void UpdatesRegistry::removeFromUpdatesRegistry(const Tag tag) {
   updatesRegistry_.erase(tag);
 }
 
+bool UpdatesRegistry::isCulled(const Tag tag) const {
+  return viewportCuller_ && viewportCuller_->isCulled(tag);
+}
+
 void UpdatesRegistry::flushUpdatesToRegistry(const UpdatesBatch &updatesBatch) {
   for (auto &[shadowNode, props] : updatesBatch) {
-    const auto tag = shadowNode->getTag();
+    const auto tag = shadowNode.getTag();
     auto it = updatesRegistry_.find(tag);
 
     if (it == updatesRegistry_.cend()) {
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <reanimated/Fabric/ShadowNodeHandle.h>
 #include <reanimated/Fabric/ShadowTreeCloner.h>
+#include <reanimated/Fabric/updates/ViewportCuller.h>
+#include <reanimated/Tools/RegistryStats.h>
 
 #include <react/renderer/core/ShadowNode.h>
 
 #include <jsi/jsi.h>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -17,13 +21,13 @@ namespace reanimated {
 using namespace facebook;
 using namespace react;
 
-using UpdatesBatch = std::vector<std::pair<ShadowNode::Shared, folly::dynamic>>;
+using UpdatesBatch = std::vector<std::pair<ShadowNodeHandle, folly::dynamic>>;
 using RegistryMap =
-    std::unordered_map<Tag, std::pair<ShadowNode::Shared, folly::dynamic>>;
+    std::unordered_map<Tag, std::pair<ShadowNodeHandle, folly::dynamic>>;
 
 #ifdef ANDROID
 struct PropsToRevert {
-  ShadowNode::Shared shadowNode;
+  ShadowNodeHandle shadowNode;
   std::unordered_set<std::string> props;
 };
 
@@ -39,6 +43,7 @@ class UpdatesRegistry {
   virtual bool isEmpty() const;
   folly::dynamic get(Tag tag) const;
   virtual void remove(Tag tag) = 0;
+  RegistryStats getStats() const;
 
 #ifdef ANDROID
   bool hasPropsToRevert() const;
@@ -47,22 +52,45 @@ class UpdatesRegistry {
 
   void flushUpdates(UpdatesBatch &updatesBatch);
   void collectProps(PropsMap &propsMap);
+  // Collects props only of views from the given surface for which
+  // shouldCollect returns true
+  void collectProps(
+      PropsMap &propsMap,
+      SurfaceId surfaceId,
+      const std::function<bool(const ShadowNodeFamily &)> &shouldCollect);
+  // Collects handles of all views that have updates stored in the registry
+  void collectShadowNodes(
+      std::unordered_map<Tag, ShadowNodeHandle> &shadowNodes) const;
+  // Adds updates stored in the registry for the given views to the batch
+  void collectUpdates(
+      const std::unordered_set<Tag> &tags,
+      UpdatesBatch &updatesBatch) const;
+
+  // Updates of views culled by the viewport culler are stored in the
+  // registry, but aren't added to the batch passed to flushUpdates
+  void setViewportCuller(const std::shared_ptr<ViewportCuller> &culler);
 
  protected:
   mutable std::mutex mutex_;
   RegistryMap updatesRegistry_;
 
   void addUpdatesToBatch(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const folly::dynamic &props);
   folly::dynamic getUpdatesFromRegistry(const Tag tag) const;
   void setInUpdatesRegistry(
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const folly::dynamic &props);
   void removeFromUpdatesRegistry(Tag tag);
+  bool isCulled(Tag tag) const;
+
+  // Adds stats of data stored by the registry in addition to the updates
+  // (called with the registry lock held)
+  virtual void addStats(RegistryStats &stats) const {}
 
  private:
   UpdatesBatch updatesBatch_;
+  std::shared_ptr<ViewportCuller> viewportCuller_;
 
   void flushUpdatesToRegistry(const UpdatesBatch &updatesBatch);
 
@@ -43,8 +43,8 @@ bool UpdatesRegistryManager::shouldCommitAfterPause() {
 }
 
 void UpdatesRegistryManager::markNodeAsRemovable(
-    const ShadowNode::Shared &shadowNode) {
-  removableShadowNodes_[shadowNode->getTag()] = shadowNode;
+    const ShadowNodeHandle &shadowNode) {
+  removableShadowNodes_[shadowNode.getTag()] = shadowNode;
 }
 
 void UpdatesRegistryManager::unmarkNodeAsRemovable(Tag viewTag) {
@@ -56,7 +56,7 @@ void UpdatesRegistryManager::handleNodeRemovals(
   for (auto it = removableShadowNodes_.begin();
        it != removableShadowNodes_.end();) {
     const auto &shadowNode = it->second;
-    const auto &family = shadowNode->getFamily();
+    const auto &family = shadowNode.getFamily();
     const auto &ancestors = family.getAncestors(rootShadowNode);
 
     // Skip if the node hasn't been removed
@@ -65,7 +65,7 @@ void UpdatesRegistryManager::handleNodeRemovals(
       continue;
     }
 
-    const auto tag = shadowNode->getTag();
+    const auto tag = shadowNode.getTag();
     for (auto &registry : registries_) {
       registry->remove(tag);
     }
@@ -82,6 +82,126 @@ PropsMap UpdatesRegistryManager::collectProps() {
   return propsMap;
 }
 
+std::unordered_map<Tag, ShadowNodeHandle>
+UpdatesRegistryManager::collectShadowNodes() {
+  std::unordered_map<Tag, ShadowNodeHandle> shadowNodes;
+  for (auto &registry : registries_) {
+    registry->collectShadowNodes(shadowNodes);
+  }
+  return shadowNodes;
+}
+
+void UpdatesRegistryManager::collectUpdates(
+    const std::unordered_set<Tag> &tags,
+    UpdatesBatch &updatesBatch) {
+  for (auto &registry : registries_) {
+    registry->collectUpdates(tags, updatesBatch);
+  }
+}
+
+PropsMap UpdatesRegistryManager::collectPropsToReapply(
+    const RootShadowNode &oldRootShadowNode,
+    const RootShadowNode &newRootShadowNode) {
+  const auto surfaceId = newRootShadowNode.getSurfaceId();
+  const bool isOutOfSync = outOfSyncSurfaces_.contains(surfaceId);
+
+  // Nodes changed by the commit are found in a single walk over the changed
+  // part of the tree, instead of looking up every animated view in both trees
+  std::unordered_set<const ShadowNodeFamily *> changedFamilies;
+  if (!isOutOfSync) {
+    collectChangedFamilies(
+        &oldRootShadowNode, newRootShadowNode, changedFamilies);
+  }
+
+  const auto shouldReapply = [&](const ShadowNodeFamily &family) {
+    return isOutOfSync || changedFamilies.contains(&family);
+  };
+
+  PropsMap propsMap;
+  for (auto &registry : registries_) {
+    registry->collectProps(propsMap, surfaceId, shouldReapply);
+  }
+  return propsMap;
+}
+
+void UpdatesRegistryManager::markSurfaceAsOutOfSync(const SurfaceId surfaceId) {
+  outOfSyncSurfaces_[surfaceId] = ++outOfSyncGeneration_;
+}
+
+void UpdatesRegistryManager::markSurfaceAsInSync(const SurfaceId surfaceId) {
+  outOfSyncSurfaces_.erase(surfaceId);
+  reappliedRoots_.erase(surfaceId);
+}
+
+bool UpdatesRegistryManager::hasOutOfSyncSurfaces() const {
+  return !outOfSyncSurfaces_.empty();
+}
+
+void UpdatesRegistryManager::setReappliedRoot(
+    const RootShadowNode &rootShadowNode) {
+  const auto surfaceId = rootShadowNode.getSurfaceId();
+  const auto it = outOfSyncSurfaces_.find(surfaceId);
+  if (it == outOfSyncSurfaces_.end()) {
+    return;
+  }
+  reappliedRoots_[surfaceId] = ReappliedRoot{
+      .rootShadowNode = &rootShadowNode, .outOfSyncGeneration = it->second};
+}
+
+void UpdatesRegistryManager::handleMountedRoot(
+    const RootShadowNode &rootShadowNode) {
+  const auto surfaceId = rootShadowNode.getSurfaceId();
+  const auto reappliedIt = reappliedRoots_.find(surfaceId);
+  if (reappliedIt == reappliedRoots_.end() ||
+      reappliedIt->second.rootShadowNode != &rootShadowNode) {
+    return;
+  }
+
+  const auto outOfSyncIt = outOfSyncSurfaces_.find(surfaceId);
+  if (outOfSyncIt != outOfSyncSurfaces_.end() &&
+      outOfSyncIt->second == reappliedIt->second.outOfSyncGeneration) {
+    outOfSyncSurfaces_.erase(outOfSyncIt);
+  }
+  reappliedRoots_.erase(reappliedIt);
+}
+
+void UpdatesRegistryManager::collectChangedFamilies(
+    const ShadowNode *oldShadowNode,
+    const ShadowNode &newShadowNode,
+    std::unordered_set<const ShadowNodeFamily *> &changedFamilies) {
+  changedFamilies.insert(&newShadowNode.getFamily());
+
+  const auto &newChildren = newShadowNode.getChildren();
+  // Old children are indexed only if some child isn't at the same position
+  std::unordered_map<Tag, const ShadowNode *> oldChildrenByTag;
+
+  for (size_t i = 0; i < newChildren.size(); ++i) {
+    const auto &newChild = newChildren[i];
+    const ShadowNode *oldChild = nullptr;
+
+    if (oldShadowNode) {
+      const auto &oldChildren = oldShadowNode->getChildren();
+      if (i < oldChildren.size() && oldChildren[i] == newChild) {
+        // The whole subtree is shared with the old tree
+        continue;
+      }
+      if (oldChildrenByTag.empty()) {
+        for (const auto &child : oldChildren) {
+          oldChildrenByTag.emplace(child->getTag(), child.get());
+        }
+      }
+      const auto it = oldChildrenByTag.find(newChild->getTag());
+      if (it != oldChildrenByTag.end()) {
+        oldChild = it->second;
+      }
+    }
+
+    if (oldChild != newChild.get()) {
+      collectChangedFamilies(oldChild, *newChild, changedFamilies);
+    }
+  }
+}
+
 #ifdef ANDROID
 
 bool UpdatesRegistryManager::hasPropsToRevert() {
@@ -95,18 +215,9 @@ bool UpdatesRegistryManager::hasPropsToRevert() {
 
 void UpdatesRegistryManager::addToPropsMap(
     PropsMap &propsMap,
-    const ShadowNode::Shared &shadowNode,
+    const ShadowNodeHandle &shadowNode,
     const folly::dynamic &props) {
-  auto &family = shadowNode->getFamily();
-  auto it = propsMap.find(&family);
-
-  if (it == propsMap.cend()) {
-    auto propsVector = std::vector<RawProps>{};
-    propsVector.emplace_back(props);
-    propsMap.emplace(&family, propsVector);
-  } else {
-    it->second.emplace_back(props);
-  }
+  propsMap[&shadowNode.getFamily()].push_back(props);
 }
 
 void UpdatesRegistryManager::collectPropsToRevertBySurface(
@@ -134,7 +245,7 @@ void UpdatesRegistryManager::collectPropsToRevertBySurface(
       }
     }
 
-    const auto &surfaceId = shadowNode->getSurfaceId();
+    const auto &surfaceId = shadowNode.getSurfaceId();
     auto &propsMap = propsMapBySurface[surfaceId];
 
     addToPropsMap(propsMap, shadowNode, filteredStyle);
@@ -143,7 +254,7 @@ void UpdatesRegistryManager::collectPropsToRevertBySurface(
 
 void UpdatesRegistryManager::clearPropsToRevert(const SurfaceId surfaceId) {
   for (auto it = propsToRevertMap_.begin(); it != propsToRevertMap_.end();) {
-    if (it->second.shadowNode->getSurfaceId() == surfaceId) {
+    if (it->second.shadowNode.getSurfaceId() == surfaceId) {
       it = propsToRevertMap_.erase(it);
     } else {
       ++it;
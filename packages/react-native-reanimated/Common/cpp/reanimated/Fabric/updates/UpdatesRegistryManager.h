@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -32,10 +33,37 @@ class UpdatesRegistryManager {
   bool shouldCommitAfterPause();
   void cancelCommitAfterPause();
 
-  void markNodeAsRemovable(const ShadowNode::Shared &shadowNode);
+  void markNodeAsRemovable(const ShadowNodeHandle &shadowNode);
   void unmarkNodeAsRemovable(Tag viewTag);
   void handleNodeRemovals(const RootShadowNode &rootShadowNode);
   PropsMap collectProps();
+  // Views are collected from all registries (without duplicates)
+  std::unordered_map<Tag, ShadowNodeHandle> collectShadowNodes();
+  // Adds stored updates of the given views to the batch, in order of registry
+  // priorities
+  void collectUpdates(
+      const std::unordered_set<Tag> &tags,
+      UpdatesBatch &updatesBatch);
+  // Collects props that have to be applied again on top of the tree committed
+  // by React Native. Views that weren't re-created by the commit are the same
+  // nodes as in the mounted tree, so they already have their animated props,
+  // unless the surface is out of sync.
+  PropsMap collectPropsToReapply(
+      const RootShadowNode &oldRootShadowNode,
+      const RootShadowNode &newRootShadowNode);
+  // Marks the surface as having updates in registries that weren't committed
+  // (e.g. because Reanimated commits were paused), so the next React Native
+  // commit has to re-apply all animated props of the surface
+  void markSurfaceAsOutOfSync(SurfaceId surfaceId);
+  void markSurfaceAsInSync(SurfaceId surfaceId);
+  bool hasOutOfSyncSurfaces() const;
+  // Remembers that all animated props of an out of sync surface were
+  // re-applied to the given root. The surface stays out of sync until that
+  // root is mounted, because the commit may still fail.
+  void setReappliedRoot(const RootShadowNode &rootShadowNode);
+  // Marks the surface as in sync if the mounted root is the one with
+  // re-applied props and nothing was marked as out of sync since
+  void handleMountedRoot(const RootShadowNode &rootShadowNode);
 
 #ifdef ANDROID
   bool hasPropsToRevert();
@@ -48,16 +76,33 @@ class UpdatesRegistryManager {
   mutable std::mutex mutex_;
   std::atomic<bool> isPaused_;
   std::atomic<bool> shouldCommitAfterPause_;
-  std::unordered_map<Tag, ShadowNode::Shared> removableShadowNodes_;
+  std::unordered_map<Tag, ShadowNodeHandle> removableShadowNodes_;
   std::vector<std::shared_ptr<UpdatesRegistry>> registries_;
   const std::shared_ptr<StaticPropsRegistry> staticPropsRegistry_;
+  // Generation of the latest update that wasn't committed, per surface
+  std::unordered_map<SurfaceId, uint64_t> outOfSyncSurfaces_;
+  uint64_t outOfSyncGeneration_{0};
+
+  struct ReappliedRoot {
+    // Used only for comparison, as the root may be already destroyed
+    const RootShadowNode *rootShadowNode;
+    uint64_t outOfSyncGeneration;
+  };
+  std::unordered_map<SurfaceId, ReappliedRoot> reappliedRoots_;
+
+  // Collects families of nodes of the new tree that aren't shared with the
+  // old tree, i.e. the ones that were created or cloned by the commit
+  static void collectChangedFamilies(
+      const ShadowNode *oldShadowNode,
+      const ShadowNode &newShadowNode,
+      std::unordered_set<const ShadowNodeFamily *> &changedFamilies);
 
 #ifdef ANDROID
   PropsToRevertMap propsToRevertMap_;
 
   static void addToPropsMap(
       PropsMap &propsMap,
-      const ShadowNode::Shared &shadowNode,
+      const ShadowNodeHandle &shadowNode,
       const folly::dynamic &props);
 #endif
 };
@@ -0,0 +1,91 @@
+#include <reanimated/Fabric/updates/ViewportCuller.h>
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+
+#include <utility>
+
+namespace reanimated {
+
+bool ViewportCuller::isVisibilityUpdateDue(const double timestamp) const {
+  return !lastVisibilityUpdateTimestamp_.has_value() ||
+      timestamp - lastVisibilityUpdateTimestamp_.value() >=
+      VISIBILITY_UPDATE_INTERVAL_MS;
+}
+
+std::unordered_set<Tag> ViewportCuller::updateVisibility(
+    const ShadowTreeRegistry &shadowTreeRegistry,
+    const std::unordered_map<Tag, ShadowNodeHandle> &shadowNodes,
+    const double timestamp) {
+  lastVisibilityUpdateTimestamp_ = timestamp;
+  culledTags_.clear();
+
+  // Root nodes are looked up once per surface, as views of the same surface
+  // are measured against the same committed tree
+  std::unordered_map<SurfaceId, RootShadowNode::Shared> rootShadowNodes;
+  for (const auto &[tag, shadowNode] : shadowNodes) {
+    const auto surfaceId = shadowNode.getSurfaceId();
+    auto rootIt = rootShadowNodes.find(surfaceId);
+    if (rootIt == rootShadowNodes.end()) {
+      RootShadowNode::Shared rootShadowNode;
+      shadowTreeRegistry.visit(surfaceId, [&](const ShadowTree &shadowTree) {
+        rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+      });
+      rootIt = rootShadowNodes.emplace(surfaceId, std::move(rootShadowNode))
+                   .first;
+    }
+
+    if (rootIt->second &&
+        !isInViewport(shadowNode.getFamily(), *rootIt->second)) {
+      culledTags_.insert(tag);
+    }
+  }
+
+  std::unordered_set<Tag> visibleTags;
+  std::erase_if(heldBackTags_, [&](const Tag tag) {
+    if (culledTags_.contains(tag)) {
+      return false;
+    }
+    visibleTags.insert(tag);
+    return true;
+  });
+  return visibleTags;
+}
+
+bool ViewportCuller::isCulled(const Tag tag) const {
+  return culledTags_.contains(tag);
+}
+
+void ViewportCuller::holdBackUpdates(const Tag tag) {
+  heldBackTags_.insert(tag);
+}
+
+bool ViewportCuller::hasHeldBackUpdates() const {
+  return !heldBackTags_.empty();
+}
+
+void ViewportCuller::invalidateVisibility() {
+  lastVisibilityUpdateTimestamp_.reset();
+}
+
+bool ViewportCuller::isInViewport(
+    const ShadowNodeFamily &family,
+    const RootShadowNode &rootShadowNode) {
+  const auto layoutMetrics = LayoutableShadowNode::computeRelativeLayoutMetrics(
+      family, rootShadowNode, {/* .includeTransform = */ true});
+  // Views that aren't mounted or laid out yet can't be measured
+  if (layoutMetrics == EmptyLayoutMetrics) {
+    return true;
+  }
+
+  const auto &viewport = rootShadowNode.getLayoutMetrics().frame.size;
+  const auto marginX = viewport.width * VIEWPORT_MARGIN_RATIO;
+  const auto marginY = viewport.height * VIEWPORT_MARGIN_RATIO;
+  const auto &frame = layoutMetrics.frame;
+
+  return frame.origin.x + frame.size.width >= -marginX &&
+      frame.origin.x <= viewport.width + marginX &&
+      frame.origin.y + frame.size.height >= -marginY &&
+      frame.origin.y <= viewport.height + marginY;
+}
+
+} // namespace reanimated
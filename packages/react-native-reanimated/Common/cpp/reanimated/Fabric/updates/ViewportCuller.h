@@ -0,0 +1,61 @@
+#pragma once
+
+#include <reanimated/Fabric/ShadowNodeHandle.h>
+
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace reanimated {
+
+using namespace facebook;
+using namespace react;
+
+// Keeps track of animated views that lie outside of the viewport of their
+// surface (e.g. list items scrolled far away), so that registries can skip
+// their updates. Visibility is computed from the layout of the last committed
+// tree (which includes content offsets of scroll views) and views that
+// weren't checked yet are treated as visible. It is rechecked in frames with
+// updates and after trees are mounted, so that no frames are requested only
+// to check it. Must be used on the UI thread; isCulled may be called from
+// other threads while visibility isn't updated.
+class ViewportCuller {
+ public:
+  bool isVisibilityUpdateDue(double timestamp) const;
+  // Recomputes visibility of the given views and returns tags of views with
+  // held back updates that are no longer culled
+  std::unordered_set<Tag> updateVisibility(
+      const ShadowTreeRegistry &shadowTreeRegistry,
+      const std::unordered_map<Tag, ShadowNodeHandle> &shadowNodes,
+      double timestamp);
+
+  bool isCulled(Tag tag) const;
+  // Marks that updates of the culled view weren't committed, so they have to
+  // be applied once the view becomes visible again
+  void holdBackUpdates(Tag tag);
+  bool hasHeldBackUpdates() const;
+  // Makes the next update of visibility due regardless of the interval, e.g.
+  // after views were laid out or scrolled by a mounted tree
+  void invalidateVisibility();
+
+ private:
+  // Visibility changes only when views are scrolled or laid out again, so it
+  // doesn't have to be checked in every frame
+  static constexpr double VISIBILITY_UPDATE_INTERVAL_MS = 100;
+  // Views closer to the viewport than this fraction of its size are treated
+  // as visible, so that they are up to date before they are scrolled into it
+  static constexpr double VIEWPORT_MARGIN_RATIO = 0.5;
+
+  std::unordered_set<Tag> culledTags_;
+  std::unordered_set<Tag> heldBackTags_;
+  std::optional<double> lastVisibilityUpdateTimestamp_;
+
+  static bool isInViewport(
+      const ShadowNodeFamily &family,
+      const RootShadowNode &rootShadowNode);
+};
+
+} // namespace reanimated
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace reanimated {
+
+// Kinds of components that are handled specially while processing mutations
+enum class ComponentKind : uint8_t {
+  Other,
+  Root,
+  RNSScreen,
+};
+
+// Caches kinds of components by their handles, so that component names are
+// compared once per component type instead of once per mutation. Handles are
+// component handles of shadow views, which identify the component type.
+class ComponentKindCache {
+ public:
+  using ComponentHandle = int64_t;
+
+  explicit ComponentKindCache(const ComponentHandle rootHandle)
+      : rootHandle_(rootHandle) {}
+
+  ComponentKind get(const ComponentHandle handle, const char *componentName) {
+    // The handle of the root component is known upfront
+    if (handle == rootHandle_) {
+      return ComponentKind::Root;
+    }
+    if (handle == lastHandle_) {
+      return lastKind_;
+    }
+
+    auto it = kinds_.find(handle);
+    if (it == kinds_.end()) {
+      it = kinds_.emplace(handle, getKindByName(componentName)).first;
+    }
+
+    lastHandle_ = handle;
+    lastKind_ = it->second;
+    return lastKind_;
+  }
+
+  static ComponentKind getKindByName(const char *componentName) {
+    const auto isRNSScreen = !std::strcmp(componentName, "RNSScreenStack") ||
+        !std::strcmp(componentName, "RNSScreen") ||
+        !std::strcmp(componentName, "RNSModalScreen");
+    return isRNSScreen ? ComponentKind::RNSScreen : ComponentKind::Other;
+  }
+
+ private:
+  const ComponentHandle rootHandle_;
+  std::unordered_map<ComponentHandle, ComponentKind> kinds_;
+  // Removed subtrees mostly consist of runs of views of the same type, whose
+  // kind is returned without hashing the handle again
+  ComponentHandle lastHandle_ = 0;
+  ComponentKind lastKind_ = ComponentKind::Other;
+};
+
+} // namespace reanimated
@@ -0,0 +1,399 @@
+#include <reanimated/CSS/common/values/CSSNumber.h>
+#include <reanimated/CSS/easing/EasingFunctions.h>
+#include <reanimated/LayoutAnimations/LayoutAnimationPresets.h>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace reanimated {
+
+namespace {
+
+using PresetValue = std::optional<double> LayoutAnimationPresetValues::*;
+
+const std::array<std::pair<std::string_view, PresetValue>, 5> STYLE_VALUES = {{
+    {"opacity", &LayoutAnimationPresetValues::opacity},
+    {"originX", &LayoutAnimationPresetValues::originX},
+    {"originY", &LayoutAnimationPresetValues::originY},
+    {"width", &LayoutAnimationPresetValues::width},
+    {"height", &LayoutAnimationPresetValues::height},
+}};
+
+// In the order in which they are written by toDynamic, so that the transform
+// of the view is composed in the same way
+const std::array<std::pair<std::string_view, PresetValue>, 3>
+    TRANSFORM_VALUES = {{
+        {"translateX", &LayoutAnimationPresetValues::translateX},
+        {"translateY", &LayoutAnimationPresetValues::translateY},
+        {"scale", &LayoutAnimationPresetValues::scale},
+    }};
+
+bool parseTransformValues(
+    jsi::Runtime &rt,
+    const jsi::Value &transform,
+    LayoutAnimationPresetValues &values) {
+  if (!transform.isObject()) {
+    return false;
+  }
+  const auto transformObj = transform.asObject(rt);
+  if (!transformObj.isArray(rt)) {
+    return false;
+  }
+  const auto operations = transformObj.asArray(rt);
+  const auto operationsCount = operations.size(rt);
+  // An empty transform resets the transform of the view, which can't be
+  // expressed with the preset values
+  if (operationsCount == 0) {
+    return false;
+  }
+
+  size_t nextValueIndex = 0;
+  for (size_t i = 0; i < operationsCount; ++i) {
+    const auto operation = operations.getValueAtIndex(rt, i);
+    if (!operation.isObject()) {
+      return false;
+    }
+    const auto operationObj = operation.asObject(rt);
+    const auto names = operationObj.getPropertyNames(rt);
+    if (names.size(rt) != 1) {
+      return false;
+    }
+    const auto name = names.getValueAtIndex(rt, 0).asString(rt).utf8(rt);
+    const auto it = std::find_if(
+        TRANSFORM_VALUES.begin() + nextValueIndex,
+        TRANSFORM_VALUES.end(),
+        [&](const auto &entry) { return entry.first == name; });
+    if (it == TRANSFORM_VALUES.end()) {
+      return false;
+    }
+    const auto value = operationObj.getProperty(rt, name.c_str());
+    if (!value.isNumber()) {
+      return false;
+    }
+    values.*(it->second) = value.asNumber();
+    nextValueIndex = it - TRANSFORM_VALUES.begin() + 1;
+  }
+
+  return true;
+}
+
+const std::unordered_map<std::string, LayoutAnimationPresetName>
+    PRESET_NAMES = {
+        {"FadeIn", LayoutAnimationPresetName::FadeIn},
+        {"FadeInRight", LayoutAnimationPresetName::FadeInRight},
+        {"FadeInLeft", LayoutAnimationPresetName::FadeInLeft},
+        {"FadeInUp", LayoutAnimationPresetName::FadeInUp},
+        {"FadeInDown", LayoutAnimationPresetName::FadeInDown},
+        {"FadeOut", LayoutAnimationPresetName::FadeOut},
+        {"FadeOutRight", LayoutAnimationPresetName::FadeOutRight},
+        {"FadeOutLeft", LayoutAnimationPresetName::FadeOutLeft},
+        {"FadeOutUp", LayoutAnimationPresetName::FadeOutUp},
+        {"FadeOutDown", LayoutAnimationPresetName::FadeOutDown},
+        {"SlideInRight", LayoutAnimationPresetName::SlideInRight},
+        {"SlideInLeft", LayoutAnimationPresetName::SlideInLeft},
+        {"SlideInUp", LayoutAnimationPresetName::SlideInUp},
+        {"SlideInDown", LayoutAnimationPresetName::SlideInDown},
+        {"SlideOutRight", LayoutAnimationPresetName::SlideOutRight},
+        {"SlideOutLeft", LayoutAnimationPresetName::SlideOutLeft},
+        {"SlideOutUp", LayoutAnimationPresetName::SlideOutUp},
+        {"SlideOutDown", LayoutAnimationPresetName::SlideOutDown},
+        {"ZoomIn", LayoutAnimationPresetName::ZoomIn},
+        {"ZoomOut", LayoutAnimationPresetName::ZoomOut},
+        {"LinearTransition", LayoutAnimationPresetName::LinearTransition}};
+
+// Distance (in points) by which views are moved in Fade presets
+constexpr double FADE_TRANSLATION = 25;
+
+const std::unordered_map<std::string, ReduceMotion> REDUCE_MOTION_VALUES = {
+    {"system", ReduceMotion::System},
+    {"always", ReduceMotion::Always},
+    {"never", ReduceMotion::Never}};
+
+ReduceMotion parseReduceMotion(jsi::Runtime &rt, const jsi::Value &value) {
+  const auto reduceMotion = value.asString(rt).utf8(rt);
+  const auto it = REDUCE_MOTION_VALUES.find(reduceMotion);
+  if (it == REDUCE_MOTION_VALUES.end()) {
+    throw std::invalid_argument(
+        "[Reanimated] Invalid reduce motion value: " + reduceMotion);
+  }
+  return it->second;
+}
+
+std::optional<double> interpolate(
+    const std::optional<double> &from,
+    const std::optional<double> &to,
+    const double progress) {
+  if (!to.has_value()) {
+    return std::nullopt;
+  }
+  const css::CSSDouble toValue(to.value());
+  return css::CSSDouble(from.value_or(to.value()))
+      .interpolate(progress, toValue)
+      .value;
+}
+
+} // namespace
+
+std::shared_ptr<const LayoutAnimationPreset> parseLayoutAnimationPreset(
+    jsi::Runtime &rt,
+    const jsi::Value &presetConfig) {
+  const auto presetObj = presetConfig.asObject(rt);
+  const auto name = presetObj.getProperty(rt, "name").asString(rt).utf8(rt);
+
+  const auto it = PRESET_NAMES.find(name);
+  if (it == PRESET_NAMES.end()) {
+    throw std::invalid_argument(
+        "[Reanimated] Unknown native layout animation preset: " + name);
+  }
+
+  return std::make_shared<const LayoutAnimationPreset>(LayoutAnimationPreset{
+      .name = it->second,
+      .duration = presetObj.getProperty(rt, "duration").asNumber(),
+      .delay = presetObj.getProperty(rt, "delay").asNumber(),
+      .easing =
+          css::createEasingFunction(rt, presetObj.getProperty(rt, "easing")),
+      .reduceMotion =
+          parseReduceMotion(rt, presetObj.getProperty(rt, "reduceMotion"))});
+}
+
+std::optional<LayoutAnimationPresetValues> parseLayoutAnimationValues(
+    jsi::Runtime &rt,
+    const jsi::Object &style) {
+  LayoutAnimationPresetValues values;
+  const auto names = style.getPropertyNames(rt);
+
+  for (size_t i = 0, count = names.size(rt); i < count; ++i) {
+    const auto name = names.getValueAtIndex(rt, i).asString(rt).utf8(rt);
+    const auto value = style.getProperty(rt, name.c_str());
+
+    if (name == "transform") {
+      if (!parseTransformValues(rt, value, values)) {
+        return std::nullopt;
+      }
+      continue;
+    }
+
+    const auto it = std::find_if(
+        STYLE_VALUES.begin(), STYLE_VALUES.end(), [&](const auto &entry) {
+          return entry.first == name;
+        });
+    if (it == STYLE_VALUES.end() || !value.isNumber()) {
+      return std::nullopt;
+    }
+    values.*(it->second) = value.asNumber();
+  }
+
+  return values;
+}
+
+bool LayoutAnimationPresetValues::hasProps() const {
+  return opacity.has_value() || translateX.has_value() ||
+      translateY.has_value() || scale.has_value();
+}
+
+folly::dynamic LayoutAnimationPresetValues::toDynamic() const {
+  folly::dynamic result = folly::dynamic::object();
+
+  if (opacity.has_value()) {
+    result["opacity"] = opacity.value();
+  }
+
+  folly::dynamic transform = folly::dynamic::array();
+  if (translateX.has_value()) {
+    transform.push_back(folly::dynamic::object("translateX", *translateX));
+  }
+  if (translateY.has_value()) {
+    transform.push_back(folly::dynamic::object("translateY", *translateY));
+  }
+  if (scale.has_value()) {
+    transform.push_back(folly::dynamic::object("scale", *scale));
+  }
+  if (!transform.empty()) {
+    result["transform"] = std::move(transform);
+  }
+
+  return result;
+}
+
+Frame LayoutAnimationPresetValues::toFrame() const {
+  Frame frame;
+  frame.x = originX;
+  frame.y = originY;
+  frame.width = width;
+  frame.height = height;
+  return frame;
+}
+
+NativeLayoutAnimation::NativeLayoutAnimation(
+    const LayoutAnimationType type,
+    const std::shared_ptr<const LayoutAnimationPreset> &preset,
+    const std::optional<Snapshot> &current,
+    const std::optional<Snapshot> &target,
+    const bool isReducedMotion)
+    : type_(type),
+      preset_(preset),
+      reduceMotion_(
+          preset->reduceMotion == ReduceMotion::Always ||
+          (preset->reduceMotion == ReduceMotion::System && isReducedMotion)) {
+  initializeValues(current, target);
+}
+
+LayoutAnimationType NativeLayoutAnimation::getType() const {
+  return type_;
+}
+
+bool NativeLayoutAnimation::isFinished() const {
+  return finished_;
+}
+
+LayoutAnimationPresetValues NativeLayoutAnimation::update(
+    const double timestamp) {
+  if (!startTimestamp_.has_value()) {
+    startTimestamp_ = timestamp;
+  }
+
+  const auto duration = reduceMotion_ ? 0 : preset_->duration;
+  const auto delay = reduceMotion_ ? 0 : preset_->delay;
+  const auto elapsed = timestamp - startTimestamp_.value() - delay;
+  const auto rawProgress = duration > 0
+      ? std::clamp(elapsed / duration, 0.0, 1.0)
+      : (elapsed >= 0 ? 1.0 : 0.0);
+  finished_ = rawProgress >= 1;
+  const auto progress = preset_->easing(rawProgress);
+
+  return {
+      .opacity = interpolate(fromValues_.opacity, toValues_.opacity, progress),
+      .translateX =
+          interpolate(fromValues_.translateX, toValues_.translateX, progress),
+      .translateY =
+          interpolate(fromValues_.translateY, toValues_.translateY, progress),
+      .scale = interpolate(fromValues_.scale, toValues_.scale, progress),
+      .originX = interpolate(fromValues_.originX, toValues_.originX, progress),
+      .originY = interpolate(fromValues_.originY, toValues_.originY, progress),
+      .width = interpolate(fromValues_.width, toValues_.width, progress),
+      .height = interpolate(fromValues_.height, toValues_.height, progress)};
+}
+
+void NativeLayoutAnimation::initializeValues(
+    const std::optional<Snapshot> &current,
+    const std::optional<Snapshot> &target) {
+  // Entering animations have only the target snapshot and exiting ones only
+  // the current snapshot, so presets fall back to the one that exists
+  const auto &currentValues = current.has_value() ? *current : *target;
+  const auto &targetValues = target.has_value() ? *target : *current;
+
+  auto &from = fromValues_;
+  auto &to = toValues_;
+
+  switch (preset_->name) {
+    case LayoutAnimationPresetName::FadeIn:
+      from.opacity = 0;
+      to.opacity = 1;
+      break;
+    case LayoutAnimationPresetName::FadeInRight:
+    case LayoutAnimationPresetName::FadeInLeft:
+      from.opacity = 0;
+      to.opacity = 1;
+      from.translateX =
+          preset_->name == LayoutAnimationPresetName::FadeInRight
+          ? FADE_TRANSLATION
+          : -FADE_TRANSLATION;
+      to.translateX = 0;
+      break;
+    case LayoutAnimationPresetName::FadeInUp:
+    case LayoutAnimationPresetName::FadeInDown:
+      from.opacity = 0;
+      to.opacity = 1;
+      from.translateY = preset_->name == LayoutAnimationPresetName::FadeInDown
+          ? FADE_TRANSLATION
+          : -FADE_TRANSLATION;
+      to.translateY = 0;
+      break;
+    case LayoutAnimationPresetName::FadeOut:
+      from.opacity = 1;
+      to.opacity = 0;
+      break;
+    case LayoutAnimationPresetName::FadeOutRight:
+    case LayoutAnimationPresetName::FadeOutLeft:
+      from.opacity = 1;
+      to.opacity = 0;
+      from.translateX = 0;
+      to.translateX = preset_->name == LayoutAnimationPresetName::FadeOutRight
+          ? FADE_TRANSLATION
+          : -FADE_TRANSLATION;
+      break;
+    case LayoutAnimationPresetName::FadeOutUp:
+    case LayoutAnimationPresetName::FadeOutDown:
+      from.opacity = 1;
+      to.opacity = 0;
+      from.translateY = 0;
+      to.translateY = preset_->name == LayoutAnimationPresetName::FadeOutDown
+          ? FADE_TRANSLATION
+          : -FADE_TRANSLATION;
+      break;
+    case LayoutAnimationPresetName::SlideInRight:
+      from.originX = targetValues.x + targetValues.windowWidth;
+      to.originX = targetValues.x;
+      break;
+    case LayoutAnimationPresetName::SlideInLeft:
+      from.originX = targetValues.x - targetValues.windowWidth;
+      to.originX = targetValues.x;
+      break;
+    case LayoutAnimationPresetName::SlideInUp:
+      from.originY = -targetValues.windowHeight;
+      to.originY = targetValues.y;
+      break;
+    case LayoutAnimationPresetName::SlideInDown:
+      from.originY = targetValues.y + targetValues.windowHeight;
+      to.originY = targetValues.y;
+      break;
+    case LayoutAnimationPresetName::SlideOutRight:
+      from.originX = currentValues.x;
+      to.originX = std::max(
+          currentValues.x + currentValues.windowWidth,
+          currentValues.windowWidth);
+      break;
+    case LayoutAnimationPresetName::SlideOutLeft:
+      from.originX = currentValues.x;
+      to.originX = std::min(
+          currentValues.x - currentValues.windowWidth,
+          -currentValues.windowWidth);
+      break;
+    case LayoutAnimationPresetName::SlideOutUp:
+      from.originY = currentValues.y;
+      to.originY = std::min(
+          currentValues.y - currentValues.windowHeight,
+          -currentValues.windowHeight);
+      break;
+    case LayoutAnimationPresetName::SlideOutDown:
+      from.originY = currentValues.y;
+      to.originY = std::max(
+          currentValues.y + currentValues.windowHeight,
+          currentValues.windowHeight);
+      break;
+    case LayoutAnimationPresetName::ZoomIn:
+      from.scale = 0;
+      to.scale = 1;
+      break;
+    case LayoutAnimationPresetName::ZoomOut:
+      from.scale = 1;
+      to.scale = 0;
+      break;
+    case LayoutAnimationPresetName::LinearTransition:
+      from.originX = currentValues.x;
+      from.originY = currentValues.y;
+      from.width = currentValues.width;
+      from.height = currentValues.height;
+      to.originX = targetValues.x;
+      to.originY = targetValues.y;
+      to.width = targetValues.width;
+      to.height = targetValues.height;
+      break;
+  }
+}
+
+} // namespace reanimated
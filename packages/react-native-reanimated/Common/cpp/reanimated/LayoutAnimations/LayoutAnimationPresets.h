@@ -0,0 +1,118 @@
+#pragma once
+
+#include <reanimated/CSS/common/definitions.h>
+#include <reanimated/LayoutAnimations/LayoutAnimationType.h>
+#include <reanimated/LayoutAnimations/LayoutAnimationsUtils.h>
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace reanimated {
+
+using namespace facebook;
+
+// Layout animation presets that can be run natively, without calling the
+// animation worklet in every frame. Each of them mirrors the timing-based
+// version of the JS preset with the same name.
+enum class LayoutAnimationPresetName {
+  FadeIn,
+  FadeInRight,
+  FadeInLeft,
+  FadeInUp,
+  FadeInDown,
+  FadeOut,
+  FadeOutRight,
+  FadeOutLeft,
+  FadeOutUp,
+  FadeOutDown,
+  SlideInRight,
+  SlideInLeft,
+  SlideInUp,
+  SlideInDown,
+  SlideOutRight,
+  SlideOutLeft,
+  SlideOutUp,
+  SlideOutDown,
+  ZoomIn,
+  ZoomOut,
+  LinearTransition,
+};
+
+// Mirrors ReduceMotion of the JS config
+enum class ReduceMotion {
+  System,
+  Always,
+  Never,
+};
+
+struct LayoutAnimationPreset {
+  LayoutAnimationPresetName name;
+  double duration;
+  double delay;
+  css::EasingFunction easing;
+  ReduceMotion reduceMotion;
+};
+
+std::shared_ptr<const LayoutAnimationPreset> parseLayoutAnimationPreset(
+    jsi::Runtime &rt,
+    const jsi::Value &presetConfig);
+
+// Values of the properties animated by presets. Only values that are set are
+// applied to the view.
+struct LayoutAnimationPresetValues {
+  std::optional<double> opacity, translateX, translateY, scale;
+  std::optional<double> originX, originY, width, height;
+
+  // Whether any value other than the frame is set
+  bool hasProps() const;
+
+  folly::dynamic toDynamic() const;
+  Frame toFrame() const;
+};
+
+// Reads the style returned by a layout animation worklet if it consists only
+// of values that presets animate, with the transform operations in the order
+// of toDynamic. Returns nullopt for any other style, which then has to be
+// converted to RawProps.
+std::optional<LayoutAnimationPresetValues> parseLayoutAnimationValues(
+    jsi::Runtime &rt,
+    const jsi::Object &style);
+
+class NativeLayoutAnimation {
+ public:
+  // The current snapshot is required for exiting and layout animations, the
+  // target snapshot for entering and layout animations. isReducedMotion is
+  // the reduce motion setting at the time the animation starts.
+  NativeLayoutAnimation(
+      LayoutAnimationType type,
+      const std::shared_ptr<const LayoutAnimationPreset> &preset,
+      const std::optional<Snapshot> &current,
+      const std::optional<Snapshot> &target,
+      bool isReducedMotion);
+
+  LayoutAnimationType getType() const;
+  bool isFinished() const;
+
+  // The animation starts at the timestamp of the first update
+  LayoutAnimationPresetValues update(double timestamp);
+
+ private:
+  const LayoutAnimationType type_;
+  const std::shared_ptr<const LayoutAnimationPreset> preset_;
+  // Reduced animations jump to their final values in the first update
+  const bool reduceMotion_;
+  LayoutAnimationPresetValues fromValues_;
+  LayoutAnimationPresetValues toValues_;
+  std::optional<double> startTimestamp_;
+  bool finished_ = false;
+
+  void initializeValues(
+      const std::optional<Snapshot> &current,
+      const std::optional<Snapshot> &target);
+};
+
+} // namespace reanimated
@@ -9,16 +9,16 @@ namespace reanimated {
 void LayoutAnimationsManager::configureAnimationBatch(
     const std::vector<LayoutAnimationConfig> &layoutAnimationsBatch) {
   auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
-  for (auto layoutAnimationConfig : layoutAnimationsBatch) {
-    const auto &[tag, type, config] = layoutAnimationConfig;
+  for (const auto &layoutAnimationConfig : layoutAnimationsBatch) {
+    const auto &[tag, type, config, preset] = layoutAnimationConfig;
     if (type == ENTERING) {
-      enteringAnimationsForNativeID_[tag] = config;
+      enteringAnimationsForNativeID_[tag] = {config, preset};
       continue;
     }
-    if (config == nullptr) {
+    if (config == nullptr && preset == nullptr) {
       getConfigsForType(type).erase(tag);
     } else {
-      getConfigsForType(type)[tag] = config;
+      getConfigsForType(type)[tag] = {config, preset};
     }
   }
 }
@@ -46,6 +46,28 @@ bool LayoutAnimationsManager::hasLayoutAnimation(
   return getConfigsForType(type).contains(tag);
 }
 
+bool LayoutAnimationsManager::hasEnteringAnimations() const {
+  auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
+  return !enteringAnimations_.empty() ||
+      !enteringAnimationsForNativeID_.empty();
+}
+
+bool LayoutAnimationsManager::hasEnteringAnimationForNativeID(
+    const int nativeId) const {
+  auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
+  return enteringAnimationsForNativeID_.contains(nativeId);
+}
+
+std::shared_ptr<const LayoutAnimationPreset>
+LayoutAnimationsManager::getLayoutAnimationPreset(
+    const int tag,
+    const LayoutAnimationType type) {
+  auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
+  const auto &configs = getConfigsForType(type);
+  const auto it = configs.find(tag);
+  return it != configs.end() ? it->second.preset : nullptr;
+}
+
 void LayoutAnimationsManager::clearLayoutAnimationConfig(const int tag) {
   auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
   enteringAnimations_.erase(tag);
@@ -54,60 +76,102 @@ void LayoutAnimationsManager::clearLayoutAnimationConfig(const int tag) {
   shouldAnimateExitingForTag_.erase(tag);
 }
 
-void LayoutAnimationsManager::startLayoutAnimation(
+RegistryStats LayoutAnimationsManager::getStats() const {
+  auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
+  const auto configsCount = enteringAnimationsForNativeID_.size() +
+      enteringAnimations_.size() + exitingAnimations_.size() +
+      layoutAnimations_.size();
+
+  RegistryStats stats{.entriesCount = configsCount};
+  stats.retainedBytes =
+      configsCount * sizeof(ConfigsMap::value_type) +
+      shouldAnimateExitingForTag_.size() * sizeof(std::pair<const int, bool>);
+  return stats;
+}
+
+void LayoutAnimationsManager::startLayoutAnimations(
     jsi::Runtime &rt,
-    const int tag,
-    const LayoutAnimationType type,
-    const jsi::Object &values) {
-  std::shared_ptr<Shareable> config;
+    const std::vector<LayoutAnimationStart> &starts) {
+  std::vector<std::shared_ptr<Shareable>> configs;
+  configs.reserve(starts.size());
+  size_t startsCount = 0;
   {
     auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
-    if (!getConfigsForType(type).contains(tag)) {
-      return;
+    for (const auto &start : starts) {
+      const auto &configsForType = getConfigsForType(start.type);
+      const auto it = configsForType.find(start.tag);
+      // Native presets are started by LayoutAnimationsProxy
+      auto config = it == configsForType.end() ? nullptr : it->second.config;
+      if (start.type == LayoutAnimationType::EXITING) {
+        // The view is removed when the animation ends
+        clearLayoutAnimationConfig(start.tag);
+      }
+      if (config) {
+        startsCount++;
+      }
+      configs.emplace_back(std::move(config));
     }
-    config = getConfigsForType(type)[tag];
   }
-  // TODO: cache the following!!
-  jsi::Value layoutAnimationRepositoryAsValue =
-      rt.global()
-          .getPropertyAsObject(rt, "global")
-          .getProperty(rt, "LayoutAnimationsManager");
-  jsi::Function startAnimationForTag =
-      layoutAnimationRepositoryAsValue.getObject(rt).getPropertyAsFunction(
-          rt, "start");
-  startAnimationForTag.call(
-      rt,
-      jsi::Value(tag),
-      jsi::Value(static_cast<int>(type)),
-      values,
-      config->toJSValue(rt));
+  if (startsCount == 0) {
+    return;
+  }
+
+  jsi::Array batch(rt, startsCount);
+  size_t index = 0;
+  for (size_t i = 0; i < starts.size(); ++i) {
+    if (!configs[i]) {
+      continue;
+    }
+    const auto &start = starts[i];
+    jsi::Object item(rt);
+    item.setProperty(rt, "tag", start.tag);
+    item.setProperty(rt, "type", static_cast<int>(start.type));
+    item.setProperty(rt, "yogaValues", jsi::Value(rt, start.values));
+    item.setProperty(rt, "config", configs[i]->toJSValue(rt));
+    item.setProperty(rt, "skipped", start.skipped);
+    batch.setValueAtIndex(rt, index++, std::move(item));
+  }
+
+  getJSManagerFunction(rt, startBatchFunction_, "startBatch")
+      .call(rt, std::move(batch));
 }
 
 void LayoutAnimationsManager::cancelLayoutAnimation(
     jsi::Runtime &rt,
-    const int tag) const {
-  jsi::Value layoutAnimationRepositoryAsValue =
-      rt.global()
-          .getPropertyAsObject(rt, "global")
-          .getProperty(rt, "LayoutAnimationsManager");
-  jsi::Function cancelLayoutAnimation =
-      layoutAnimationRepositoryAsValue.getObject(rt).getPropertyAsFunction(
-          rt, "stop");
-  cancelLayoutAnimation.call(rt, jsi::Value(tag));
+    const int tag) {
+  getJSManagerFunction(rt, stopFunction_, "stop").call(rt, jsi::Value(tag));
+}
+
+void LayoutAnimationsManager::clearCachedFunctions() {
+  startBatchFunction_.reset();
+  stopFunction_.reset();
+}
+
+jsi::Function &LayoutAnimationsManager::getJSManagerFunction(
+    jsi::Runtime &rt,
+    std::optional<jsi::Function> &cachedFunction,
+    const char *name) {
+  if (!cachedFunction.has_value()) {
+    cachedFunction = rt.global()
+                         .getPropertyAsObject(rt, "global")
+                         .getPropertyAsObject(rt, "LayoutAnimationsManager")
+                         .getPropertyAsFunction(rt, name);
+  }
+  return cachedFunction.value();
 }
 
 void LayoutAnimationsManager::transferConfigFromNativeID(
     const int nativeId,
     const int tag) {
   auto lock = std::unique_lock<std::recursive_mutex>(animationsMutex_);
-  auto config = enteringAnimationsForNativeID_[nativeId];
-  if (config) {
-    enteringAnimations_.insert_or_assign(tag, config);
+  const auto &entry = enteringAnimationsForNativeID_[nativeId];
+  if (entry.config || entry.preset) {
+    enteringAnimations_.insert_or_assign(tag, entry);
   }
   enteringAnimationsForNativeID_.erase(nativeId);
 }
 
-std::unordered_map<int, std::shared_ptr<Shareable>> &
+LayoutAnimationsManager::ConfigsMap &
 LayoutAnimationsManager::getConfigsForType(const LayoutAnimationType type) {
   switch (type) {
     case ENTERING:
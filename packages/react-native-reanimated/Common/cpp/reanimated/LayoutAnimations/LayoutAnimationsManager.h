@@ -1,6 +1,7 @@
 #pragma once
 
 #include <reanimated/LayoutAnimations/LayoutAnimationType.h>
+#include <reanimated/Tools/RegistryStats.h>
 
 #include <worklets/SharedItems/Shareables.h>
 #include <worklets/Tools/JSLogger.h>
@@ -10,6 +11,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -20,10 +22,23 @@ namespace reanimated {
 using namespace facebook;
 using namespace worklets;
 
+struct LayoutAnimationPreset;
+
 struct LayoutAnimationConfig {
   int tag;
   LayoutAnimationType type;
   std::shared_ptr<Shareable> config;
+  // Set instead of the config for presets that are run natively
+  std::shared_ptr<const LayoutAnimationPreset> preset;
+};
+
+struct LayoutAnimationStart {
+  int tag;
+  LayoutAnimationType type;
+  jsi::Object values;
+  // The animation isn't run and only its callback is called with finished
+  // set to false (e.g. for views removed right away)
+  bool skipped = false;
 };
 
 class LayoutAnimationsManager {
@@ -35,27 +50,54 @@ class LayoutAnimationsManager {
   void setShouldAnimateExiting(const int tag, const bool value);
   bool shouldAnimateExiting(const int tag, const bool shouldAnimate);
   bool hasLayoutAnimation(const int tag, const LayoutAnimationType type);
-  void startLayoutAnimation(
+  // Whether there are entering animations of views that aren't mounted yet
+  // (configured by tag or by nativeID)
+  bool hasEnteringAnimations() const;
+  bool hasEnteringAnimationForNativeID(const int nativeId) const;
+  // Starts all animations with a single call to the JS animations manager.
+  // Views without a JS config (e.g. with native presets) are skipped. Configs
+  // of exiting views are cleared before calling into JS, so that they are
+  // dropped even if the call throws.
+  void startLayoutAnimations(
       jsi::Runtime &rt,
+      const std::vector<LayoutAnimationStart> &starts);
+  // Returns nullptr if the animation of the view is not a native preset
+  std::shared_ptr<const LayoutAnimationPreset> getLayoutAnimationPreset(
       const int tag,
-      const LayoutAnimationType type,
-      const jsi::Object &values);
+      const LayoutAnimationType type);
   void clearLayoutAnimationConfig(const int tag);
-  void cancelLayoutAnimation(jsi::Runtime &rt, const int tag) const;
+  void cancelLayoutAnimation(jsi::Runtime &rt, const int tag);
   void transferConfigFromNativeID(const int nativeId, const int tag);
+  // Configs are shareables owned by the JS side, so only registry entries are
+  // counted in retained bytes
+  RegistryStats getStats() const;
+  // Cached functions of the JS animations manager belong to the UI runtime,
+  // so they have to be released before the runtime is torn down
+  void clearCachedFunctions();
 
  private:
-  std::unordered_map<int, std::shared_ptr<Shareable>> &getConfigsForType(
-      const LayoutAnimationType type);
+  struct ConfigEntry {
+    std::shared_ptr<Shareable> config;
+    std::shared_ptr<const LayoutAnimationPreset> preset;
+  };
+  using ConfigsMap = std::unordered_map<int, ConfigEntry>;
+
+  ConfigsMap &getConfigsForType(const LayoutAnimationType type);
+  jsi::Function &getJSManagerFunction(
+      jsi::Runtime &rt,
+      std::optional<jsi::Function> &cachedFunction,
+      const char *name);
 
   std::shared_ptr<JSLogger> jsLogger_;
 
-  std::unordered_map<int, std::shared_ptr<Shareable>>
-      enteringAnimationsForNativeID_;
-  std::unordered_map<int, std::shared_ptr<Shareable>> enteringAnimations_;
-  std::unordered_map<int, std::shared_ptr<Shareable>> exitingAnimations_;
-  std::unordered_map<int, std::shared_ptr<Shareable>> layoutAnimations_;
+  ConfigsMap enteringAnimationsForNativeID_;
+  ConfigsMap enteringAnimations_;
+  ConfigsMap exitingAnimations_;
+  ConfigsMap layoutAnimations_;
   std::unordered_map<int, bool> shouldAnimateExitingForTag_;
+  // Used only on the UI thread
+  std::optional<jsi::Function> startBatchFunction_;
+  std::optional<jsi::Function> stopFunction_;
   mutable std::recursive_mutex
       animationsMutex_; // Protects `enteringAnimations_`, `exitingAnimations_`,
   // `layoutAnimations_` and `shouldAnimateExitingForTag_`.
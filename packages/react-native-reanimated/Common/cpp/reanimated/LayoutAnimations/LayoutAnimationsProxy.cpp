@@ -1,14 +1,112 @@
 #include <reanimated/LayoutAnimations/LayoutAnimationsProxy.h>
 #include <reanimated/NativeModules/ReanimatedModuleProxy.h>
+#include <reanimated/Tools/GroupByKey.h>
 
 #include <react/renderer/animations/utils.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/core/LayoutableShadowNode.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
 
-#include <set>
+#include <algorithm>
+#include <unordered_set>
 #include <utility>
 
 namespace reanimated {
 
+namespace {
+
+// Views closer to the window than this fraction of its size are treated as
+// visible (transforms of views aren't taken into account)
+constexpr double WINDOW_MARGIN_RATIO = 0.5;
+
+void collectOffscreenTags(
+    const ShadowNode &shadowNode,
+    const Point &origin,
+    const facebook::react::Rect &bounds,
+    std::unordered_set<Tag> &offscreenTags) {
+  for (const auto &child : shadowNode.getChildren()) {
+    const auto layoutableChild =
+        dynamic_cast<const LayoutableShadowNode *>(child.get());
+    if (!layoutableChild) {
+      continue;
+    }
+
+    const auto &frame = layoutableChild->getLayoutMetrics().frame;
+    const auto x = origin.x + frame.origin.x;
+    const auto y = origin.y + frame.origin.y;
+    if (x + frame.size.width < bounds.origin.x ||
+        x > bounds.origin.x + bounds.size.width ||
+        y + frame.size.height < bounds.origin.y ||
+        y > bounds.origin.y + bounds.size.height) {
+      offscreenTags.insert(child->getTag());
+    }
+
+    // Content of scroll views is shifted by their content offset
+    const auto contentOffset = layoutableChild->getContentOriginOffset(false);
+    collectOffscreenTags(
+        *child,
+        {x + contentOffset.x, y + contentOffset.y},
+        bounds,
+        offscreenTags);
+  }
+}
+
+// Collects nodes of the new tree that aren't in the old one. Subtrees shared
+// by both trees are skipped, so only the part changed by the commit is walked.
+void collectCreatedNodes(
+    const ShadowNode *oldNode,
+    const ShadowNode &newNode,
+    std::vector<const ShadowNode *> &createdNodes) {
+  if (oldNode == &newNode) {
+    return;
+  }
+
+  const auto &newChildren = newNode.getChildren();
+  std::unordered_map<Tag, const ShadowNode *> oldChildren;
+  if (oldNode) {
+    for (const auto &oldChild : oldNode->getChildren()) {
+      oldChildren.emplace(oldChild->getTag(), oldChild.get());
+    }
+  }
+
+  for (const auto &newChild : newChildren) {
+    const auto it = oldChildren.find(newChild->getTag());
+    if (it == oldChildren.end()) {
+      createdNodes.push_back(newChild.get());
+      collectCreatedNodes(nullptr, *newChild, createdNodes);
+    } else {
+      collectCreatedNodes(it->second, *newChild, createdNodes);
+    }
+  }
+}
+
+jsi::Object createExitingValues(jsi::Runtime &rt, const Snapshot &values) {
+  jsi::Object yogaValues(rt);
+  yogaValues.setProperty(rt, "currentOriginX", values.x);
+  yogaValues.setProperty(rt, "currentGlobalOriginX", values.x);
+  yogaValues.setProperty(rt, "currentOriginY", values.y);
+  yogaValues.setProperty(rt, "currentGlobalOriginY", values.y);
+  yogaValues.setProperty(rt, "currentWidth", values.width);
+  yogaValues.setProperty(rt, "currentHeight", values.height);
+  yogaValues.setProperty(rt, "windowWidth", values.windowWidth);
+  yogaValues.setProperty(rt, "windowHeight", values.windowHeight);
+  return yogaValues;
+}
+
+std::optional<int> parseNativeID(const std::string &nativeIdString) {
+  if (nativeIdString.empty()) {
+    return std::nullopt;
+  }
+  try {
+    return std::stoi(nativeIdString);
+  } catch (std::invalid_argument) {
+  } catch (std::out_of_range) {
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
 // We never modify the Shadow Tree, we just send some additional
 // mutations to the mounting layer.
 // When animations finish, the Host Tree will represent the most recent Shadow
@@ -26,21 +124,34 @@ std::optional<MountingTransaction> LayoutAnimationsProxy::pullTransaction(
   LOG(INFO) << "pullTransaction " << std::this_thread::get_id() << " "
             << surfaceId << std::endl;
 #endif
-  auto lock = std::unique_lock<std::recursive_mutex>(mutex);
-  PropsParserContext propsParserContext{surfaceId, *contextContainer_};
   ShadowViewMutationList filteredMutations;
+  {
+    auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+    PropsParserContext propsParserContext{surfaceId, *contextContainer_};
+
+    std::vector<std::shared_ptr<MutationNode>> roots;
+    std::unordered_map<Tag, Tag> movedViews;
 
-  std::vector<std::shared_ptr<MutationNode>> roots;
-  std::unordered_map<Tag, Tag> movedViews;
+    parseRemoveMutations(movedViews, mutations, roots);
 
-  parseRemoveMutations(movedViews, mutations, roots);
+    handleRemovals(filteredMutations, roots);
+    // Removals of the next transaction are measured in the tree mounted from
+    // this one
+    mountedRoots_.erase(surfaceId);
 
-  handleRemovals(filteredMutations, roots);
+    handleUpdatesAndEnterings(
+        filteredMutations,
+        movedViews,
+        mutations,
+        propsParserContext,
+        surfaceId);
 
-  handleUpdatesAndEnterings(
-      filteredMutations, movedViews, mutations, propsParserContext, surfaceId);
+    addOngoingAnimations(surfaceId, filteredMutations);
+  }
 
-  addOngoingAnimations(surfaceId, filteredMutations);
+  // Animations started in this transaction are passed to JS in one call,
+  // without holding the lock
+  flushAnimationStarts();
 
   return MountingTransaction{
       surfaceId, transactionNumber, std::move(filteredMutations), telemetry};
@@ -63,27 +174,116 @@ std::optional<SurfaceId> LayoutAnimationsProxy::progressLayoutAnimation(
 
   maybeRestoreOpacity(layoutAnimation, newStyle);
 
-  auto rawProps =
-      std::make_shared<RawProps>(uiRuntime_, jsi::Value(uiRuntime_, newStyle));
+  if (auto values = parseLayoutAnimationValues(uiRuntime_, newStyle)) {
+    updateLayoutAnimationValues(tag, layoutAnimation, std::move(*values));
+  } else {
+#ifdef LAYOUT_ANIMATIONS_LOGS
+    LOG(INFO) << "layout animation frame of tag " << tag
+              << " isn't supported by the fast path" << std::endl;
+#endif
+    updateLayoutAnimationProps(
+        tag,
+        layoutAnimation,
+        RawProps(uiRuntime_, jsi::Value(uiRuntime_, newStyle)),
+        Frame(uiRuntime_, newStyle));
+  }
 
+  return layoutAnimation.finalView->surfaceId;
+}
+
+std::vector<SurfaceId> LayoutAnimationsProxy::progressNativeLayoutAnimations(
+    const double timestamp) {
+  auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+  std::unordered_set<SurfaceId> surfaceIds;
+  std::vector<std::pair<Tag, bool>> finishedAnimations;
+
+  for (auto it = nativeLayoutAnimations_.begin();
+       it != nativeLayoutAnimations_.end();) {
+    const auto tag = it->first;
+    auto &nativeAnimation = it->second;
+    auto layoutAnimationIt = layoutAnimations_.find(tag);
+
+    if (layoutAnimationIt == layoutAnimations_.end()) {
+      // The animation was cancelled
+      it = nativeLayoutAnimations_.erase(it);
+      continue;
+    }
+    if (nativeAnimation.isFinished()) {
+      // The final values were applied in the previous frame, so the animation
+      // can be ended without dropping them
+      finishedAnimations.emplace_back(
+          tag, nativeAnimation.getType() == LayoutAnimationType::EXITING);
+      it = nativeLayoutAnimations_.erase(it);
+      continue;
+    }
+
+    auto &layoutAnimation = layoutAnimationIt->second;
+    auto values = nativeAnimation.update(timestamp);
+    if (layoutAnimation.opacity && !values.opacity.has_value()) {
+      values.opacity = *layoutAnimation.opacity;
+      layoutAnimation.opacity.reset();
+    }
+
+    updateLayoutAnimationValues(tag, layoutAnimation, std::move(values));
+    surfaceIds.insert(layoutAnimation.finalView->surfaceId);
+    it++;
+  }
+
+  for (const auto &[tag, shouldRemove] : finishedAnimations) {
+    if (const auto surfaceId = endLayoutAnimation(tag, shouldRemove)) {
+      surfaceIds.insert(*surfaceId);
+    }
+  }
+
+  return {surfaceIds.begin(), surfaceIds.end()};
+}
+
+bool LayoutAnimationsProxy::hasNativeLayoutAnimations() const {
+  auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+  return !nativeLayoutAnimations_.empty();
+}
+
+void LayoutAnimationsProxy::updateLayoutAnimationProps(
+    const int tag,
+    const LayoutAnimation &layoutAnimation,
+    RawProps &&rawProps,
+    Frame &&frame) const {
   PropsParserContext propsParserContext{
       layoutAnimation.finalView->surfaceId, *contextContainer_};
 #ifdef ANDROID
-  rawProps = std::make_shared<RawProps>(folly::dynamic::merge(
-      layoutAnimation.finalView->props->rawProps, (folly::dynamic)*rawProps));
+  rawProps = RawProps(folly::dynamic::merge(
+      layoutAnimation.finalView->props->rawProps, (folly::dynamic)rawProps));
 #endif
   auto newProps =
       getComponentDescriptorForShadowView(*layoutAnimation.finalView)
           .cloneProps(
               propsParserContext,
               layoutAnimation.finalView->props,
-              std::move(*rawProps));
+              std::move(rawProps));
   auto &updateMap =
       surfaceManager.getUpdateMap(layoutAnimation.finalView->surfaceId);
-  updateMap.insert_or_assign(
-      tag, UpdateValues{newProps, Frame(uiRuntime_, newStyle)});
+  updateMap.insert_or_assign(tag, UpdateValues{newProps, std::move(frame)});
+}
 
-  return layoutAnimation.finalView->surfaceId;
+void LayoutAnimationsProxy::updateLayoutAnimationValues(
+    const int tag,
+    const LayoutAnimation &layoutAnimation,
+    LayoutAnimationPresetValues &&values) const {
+  if (values.hasProps()) {
+    // The props are cloned by the component descriptor, so that they keep the
+    // concrete type of the props of the final view (e.g. ViewShadowNodeProps
+    // of a View or ParagraphProps of a Text). Only the animated values are
+    // parsed, as RawProps are created from them directly.
+    updateLayoutAnimationProps(
+        tag, layoutAnimation, RawProps(values.toDynamic()), values.toFrame());
+    return;
+  }
+
+  // Frames that only move or resize the view keep the props of the final view
+  auto &updateMap =
+      surfaceManager.getUpdateMap(layoutAnimation.finalView->surfaceId);
+  updateMap.insert_or_assign(
+      tag, UpdateValues{layoutAnimation.finalView->props, values.toFrame()});
 }
 
 std::optional<SurfaceId> LayoutAnimationsProxy::endLayoutAnimation(
@@ -136,10 +336,11 @@ void LayoutAnimationsProxy::parseRemoveMutations(
     std::unordered_map<Tag, Tag> &movedViews,
     ShadowViewMutationList &mutations,
     std::vector<std::shared_ptr<MutationNode>> &roots) const {
-  std::set<Tag> deletedViews;
-  std::unordered_map<Tag, std::vector<std::shared_ptr<MutationNode>>>
-      childrenForTag, unflattenedChildrenForTag;
-
+  std::unordered_set<Tag> deletedViews;
+  // Removed views paired with tags of their parents, grouped by the parent
+  // once all mutations are parsed (the unflattened parent is always the same
+  // as the parent for now, so the same groups are used for both trees)
+  std::vector<std::pair<Tag, std::shared_ptr<MutationNode>>> removedChildren;
   std::vector<std::shared_ptr<MutationNode>> mutationNodes;
 
   // iterate from the end, so that parents appear before children
@@ -156,19 +357,15 @@ void LayoutAnimationsProxy::parseRemoveMutations(
 #else
       auto parentTag = mutation.parentShadowView.tag;
 #endif // REACT_NATIVE_MINOR_VERSION >= 78
-      auto unflattenedParentTag = parentTag; // temporary
 
       std::shared_ptr<MutationNode> mutationNode;
-      std::shared_ptr<Node> node = nodeForTag_[tag],
-                            parent = nodeForTag_[parentTag],
-                            unflattenedParent =
-                                nodeForTag_[unflattenedParentTag];
+      const auto nodeIt = nodeForTag_.find(tag);
 
-      if (!node) {
+      if (nodeIt == nodeForTag_.end() || !nodeIt->second) {
         mutationNode = std::make_shared<MutationNode>(mutation);
       } else {
-        mutationNode =
-            std::make_shared<MutationNode>(mutation, std::move(*node));
+        mutationNode = std::make_shared<MutationNode>(
+            mutation, std::move(*nodeIt->second));
         for (auto &subNode : mutationNode->children) {
           subNode->parent = mutationNode;
         }
@@ -180,28 +377,17 @@ void LayoutAnimationsProxy::parseRemoveMutations(
         mutationNode->state = MOVED;
         movedViews.insert_or_assign(mutation.oldChildShadowView.tag, -1);
       }
-      nodeForTag_[tag] = mutationNode;
+      nodeForTag_.insert_or_assign(tag, mutationNode);
 
+      auto &parent = nodeForTag_[parentTag];
       if (!parent) {
         parent = std::make_shared<Node>(parentTag);
-        nodeForTag_[parentTag] = parent;
-      }
-
-      if (!unflattenedParent) {
-        if (parentTag == unflattenedParentTag) {
-          unflattenedParent = parent;
-        } else {
-          unflattenedParent = std::make_shared<Node>(unflattenedParentTag);
-          nodeForTag_[unflattenedParentTag] = unflattenedParent;
-        }
       }
 
       mutationNodes.push_back(mutationNode);
-
-      childrenForTag[parentTag].push_back(mutationNode);
-      unflattenedChildrenForTag[unflattenedParentTag].push_back(mutationNode);
+      removedChildren.emplace_back(parentTag, mutationNode);
       mutationNode->parent = parent;
-      mutationNode->unflattenedParent = unflattenedParent;
+      mutationNode->unflattenedParent = parent;
     }
     if (mutation.type == ShadowViewMutation::Update &&
         movedViews.contains(mutation.newChildShadowView.tag)) {
@@ -218,20 +404,25 @@ void LayoutAnimationsProxy::parseRemoveMutations(
     }
   }
 
-  for (auto &[parentTag, children] : childrenForTag) {
-    auto &parent = nodeForTag_[parentTag];
-    parent->insertChildren(children);
-    for (auto &child : children) {
-      child->parent = parent;
-    }
-  }
-  for (auto &[unflattenedParentTag, children] : unflattenedChildrenForTag) {
-    auto &unflattenedParent = nodeForTag_[unflattenedParentTag];
-    unflattenedParent->insertUnflattenedChildren(children);
-    for (auto &child : children) {
-      child->unflattenedParent = unflattenedParent;
-    }
-  }
+  // Children of the same parent stay in the parsing order, in which they are
+  // sorted by their indices
+  forEachGroupByKey(
+      removedChildren,
+      [this](const Tag parentTag, const auto groupBegin, const auto groupEnd) {
+        const auto &parent = nodeForTag_[parentTag];
+        std::vector<std::shared_ptr<MutationNode>> children;
+        children.reserve(groupEnd - groupBegin);
+        for (auto it = groupBegin; it != groupEnd; it++) {
+          auto &child = it->second;
+          child->parent = parent;
+          child->unflattenedParent = parent;
+          children.push_back(std::move(child));
+        }
+
+        auto unflattenedChildren = children;
+        parent->insertChildren(children);
+        parent->insertUnflattenedChildren(unflattenedChildren);
+      });
 
   for (auto &mutationNode : mutationNodes) {
     if (!mutationNode->unflattenedParent->isMutationMode()) {
@@ -270,6 +461,11 @@ void LayoutAnimationsProxy::handleRemovals(
     }
   }
   deadNodes.clear();
+
+  for (const auto &node : roots) {
+    maybeDropPlaceholder(node->unflattenedParent);
+  }
+  offscreenTags_.reset();
 }
 
 void LayoutAnimationsProxy::handleUpdatesAndEnterings(
@@ -451,6 +647,7 @@ void LayoutAnimationsProxy::maybeDropAncestors(
     ShadowViewMutationList &cleanupMutations) const {
   parent->removeChildFromUnflattenedTree(child);
   if (!parent->isMutationMode()) {
+    maybeDropPlaceholder(parent);
     return;
   }
 
@@ -469,6 +666,20 @@ void LayoutAnimationsProxy::maybeDropAncestors(
   }
 }
 
+void LayoutAnimationsProxy::maybeDropPlaceholder(
+    const std::shared_ptr<Node> &node) const {
+  if (node->isMutationMode() || !node->children.empty() ||
+      !node->unflattenedChildren.empty()) {
+    return;
+  }
+  // Placeholders without children don't affect indices of any mutations, so
+  // they don't have to be kept until their views are removed
+  const auto it = nodeForTag_.find(node->tag);
+  if (it != nodeForTag_.end() && it->second == node) {
+    nodeForTag_.erase(it);
+  }
+}
+
 const ComponentDescriptor &
 LayoutAnimationsProxy::getComponentDescriptorForShadowView(
     const ShadowView &shadowView) const {
@@ -481,7 +692,11 @@ bool LayoutAnimationsProxy::startAnimationsRecursively(
     bool shouldAnimate,
     bool isScreenPop,
     ShadowViewMutationList &mutations) const {
-  if (isRNSScreen(node)) {
+  const auto &oldView = node->mutation.oldChildShadowView;
+  // Views in a subtree of a screen don't need their component kind checked
+  if (!isScreenPop &&
+      componentKinds_.get(oldView.componentHandle, oldView.componentName) ==
+          ComponentKind::RNSScreen) {
     isScreenPop = true;
   }
 
@@ -491,6 +706,14 @@ bool LayoutAnimationsProxy::startAnimationsRecursively(
   bool hasExitAnimation = shouldAnimate &&
       layoutAnimationsManager_->hasLayoutAnimation(
           node->tag, LayoutAnimationType::EXITING);
+  // Views that can't be seen (e.g. far-down rows of a list on a screen that
+  // is torn down) are removed right away instead of running their animation
+  bool isExitAnimationSkipped = false;
+  if (hasExitAnimation && node->state != MOVED && isOutsideOfWindow(node)) {
+    hasExitAnimation = false;
+    isExitAnimationSkipped = true;
+    skippedExitingAnimationsCount_++;
+  }
   bool hasAnimatedChildren = false;
 
   shouldRemoveSubviewsWithoutAnimations =
@@ -551,11 +774,13 @@ bool LayoutAnimationsProxy::startAnimationsRecursively(
   }
 
   if (node->state == MOVED) {
-    auto replacement = std::make_shared<Node>(*node);
-    for (auto subNode : node->children) {
+    // Children of the moved node are no longer needed, as the node is
+    // removed in this transaction
+    auto replacement = std::make_shared<Node>(std::move(*node));
+    for (auto &subNode : replacement->children) {
       subNode->parent = replacement;
     }
-    for (auto subNode : node->unflattenedChildren) {
+    for (auto &subNode : replacement->unflattenedChildren) {
       subNode->unflattenedParent = replacement;
     }
     nodeForTag_[replacement->tag] = replacement;
@@ -567,6 +792,9 @@ bool LayoutAnimationsProxy::startAnimationsRecursively(
   if (hasExitAnimation) {
     node->state = ANIMATING;
     startExitingAnimation(node->tag, node->mutation);
+  } else if (isExitAnimationSkipped) {
+    // The config is cleared once the callback is called
+    skipExitingAnimation(node->tag, node->mutation);
   } else {
     layoutAnimationsManager_->clearLayoutAnimationConfig(node->tag);
   }
@@ -574,6 +802,112 @@ bool LayoutAnimationsProxy::startAnimationsRecursively(
   return wantAnimateExit;
 }
 
+void LayoutAnimationsProxy::setMountedRoot(
+    const RootShadowNode::Shared &rootShadowNode) const {
+  if constexpr (StaticFeatureFlags::getFlag(
+                    "SKIP_OFFSCREEN_EXITING_ANIMATIONS")) {
+    auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+    const auto surfaceId = rootShadowNode->getSurfaceId();
+    // Nothing can be removed from an empty tree (e.g. the one committed when
+    // the surface is stopped)
+    if (rootShadowNode->getChildren().empty()) {
+      mountedRoots_.erase(surfaceId);
+    } else {
+      mountedRoots_[surfaceId] = rootShadowNode;
+    }
+  }
+}
+
+uint64_t LayoutAnimationsProxy::getSkippedExitingAnimationsCount() const {
+  return skippedExitingAnimationsCount_;
+}
+
+// Removed views are found by walking the whole mounted tree of the surface,
+// so the cost grows with the number of mounted views, not with the number of
+// removed ones. The walk can't be limited to ancestors of removed views, as
+// mutations don't reference shadow node families (which would allow to look
+// the ancestors up). It is done at most once per transaction, only when the
+// transaction removes a view with an exiting animation, and it only reads
+// layout metrics that were already computed.
+bool LayoutAnimationsProxy::isOutsideOfWindow(
+    const std::shared_ptr<MutationNode> &node) const {
+  if constexpr (!StaticFeatureFlags::getFlag(
+                    "SKIP_OFFSCREEN_EXITING_ANIMATIONS")) {
+    return false;
+  }
+
+  if (!offscreenTags_.has_value()) {
+    offscreenTags_.emplace();
+    const auto surfaceId = node->mutation.oldChildShadowView.surfaceId;
+    const auto rootIt = mountedRoots_.find(surfaceId);
+    const auto window = surfaceManager.getWindow(surfaceId);
+    // Window dimensions are unknown until the root view is laid out
+    if (rootIt != mountedRoots_.end() && window.width > 0 &&
+        window.height > 0) {
+      const auto marginX = window.width * WINDOW_MARGIN_RATIO;
+      const auto marginY = window.height * WINDOW_MARGIN_RATIO;
+      const facebook::react::Rect bounds{
+          {-marginX, -marginY},
+          {window.width + 2 * marginX, window.height + 2 * marginY}};
+      collectOffscreenTags(*rootIt->second, {0, 0}, bounds, *offscreenTags_);
+    }
+  }
+
+  return offscreenTags_->contains(node->tag);
+}
+
+void LayoutAnimationsProxy::prepareEnteringViews(
+    const RootShadowNode &oldRootShadowNode,
+    const RootShadowNode &newRootShadowNode,
+    const ShadowTreeRevision::Number revision) const {
+  if constexpr (StaticFeatureFlags::getFlag(
+                    "PREPARE_LAYOUT_ANIMATIONS_ON_COMMIT")) {
+    if (!layoutAnimationsManager_->hasEnteringAnimations()) {
+      return;
+    }
+
+    std::vector<const ShadowNode *> createdNodes;
+    collectCreatedNodes(&oldRootShadowNode, newRootShadowNode, createdNodes);
+
+    const auto surfaceId = newRootShadowNode.getSurfaceId();
+    PropsParserContext propsParserContext{surfaceId, *contextContainer_};
+    const folly::dynamic opacity = folly::dynamic::object("opacity", 0);
+
+    for (const auto *node : createdNodes) {
+      const auto tag = node->getTag();
+      const auto &props = node->getProps();
+      const auto nativeId = parseNativeID(props->nativeId);
+      if (!layoutAnimationsManager_->hasLayoutAnimation(tag, ENTERING) &&
+          !(nativeId.has_value() &&
+            layoutAnimationsManager_->hasEnteringAnimationForNativeID(
+                *nativeId))) {
+        continue;
+      }
+
+      auto propsWithoutOpacity =
+          componentDescriptorRegistry_->at(node->getComponentHandle())
+              .cloneProps(propsParserContext, props, RawProps(opacity));
+
+      preparedEnteringViews_.prepare(
+          surfaceId,
+          tag,
+          revision,
+          PreparedEnteringView{
+              .sourceProps = props,
+              .propsWithoutOpacity = std::move(propsWithoutOpacity)});
+    }
+  }
+}
+
+void LayoutAnimationsProxy::clearPreparedEnteringViews(
+    const SurfaceId surfaceId,
+    const ShadowTreeRevision::Number mountedRevision) const {
+  if constexpr (StaticFeatureFlags::getFlag(
+                    "PREPARE_LAYOUT_ANIMATIONS_ON_COMMIT")) {
+    preparedEnteringViews_.clearMounted(surfaceId, mountedRevision);
+  }
+}
+
 void LayoutAnimationsProxy::updateIndexForMutation(
     ShadowViewMutation &mutation) const {
   if (mutation.index == -1) {
@@ -662,25 +996,21 @@ void LayoutAnimationsProxy::startEnteringAnimation(
       static_cast<const ViewProps &>(*mutation.newChildShadowView.props);
   auto opacity = viewProps.opacity;
 
-  uiScheduler_->scheduleOnUI([weakThis = weak_from_this(),
-                              finalView,
-                              current,
+  pendingAnimationStarts_.emplace_back([finalView,
+                                        current,
 #if REACT_NATIVE_MINOR_VERSION < 78
-                              parent,
+                                        parent,
 #endif // REACT_NATIVE_MINOR_VERSION < 78
-                              mutation,
-                              opacity,
-                              tag]() {
-    auto strongThis = weakThis.lock();
-    if (!strongThis) {
-      return;
-    }
-
+                                        mutation,
+                                        opacity,
+                                        tag](
+                                           const LayoutAnimationsProxy &proxy,
+                                           std::vector<LayoutAnimationStart>
+                                               &starts) {
     Rect window{};
     {
-      auto &mutex = strongThis->mutex;
-      auto lock = std::unique_lock<std::recursive_mutex>(mutex);
-      strongThis->layoutAnimations_.insert_or_assign(
+      auto lock = std::unique_lock<std::recursive_mutex>(proxy.mutex);
+      proxy.layoutAnimations_.insert_or_assign(
           tag,
           LayoutAnimation{
               finalView,
@@ -691,12 +1021,17 @@ void LayoutAnimationsProxy::startEnteringAnimation(
               parent,
 #endif // REACT_NATIVE_MINOR_VERSION >= 78
               opacity});
-      window = strongThis->surfaceManager.getWindow(
-          mutation.newChildShadowView.surfaceId);
+      window =
+          proxy.surfaceManager.getWindow(mutation.newChildShadowView.surfaceId);
     }
 
     Snapshot values(mutation.newChildShadowView, window);
-    auto &uiRuntime = strongThis->uiRuntime_;
+    if (proxy.maybeStartNativeLayoutAnimation(
+            tag, LayoutAnimationType::ENTERING, std::nullopt, values)) {
+      return;
+    }
+
+    auto &uiRuntime = proxy.uiRuntime_;
     jsi::Object yogaValues(uiRuntime);
     yogaValues.setProperty(uiRuntime, "targetOriginX", values.x);
     yogaValues.setProperty(uiRuntime, "targetGlobalOriginX", values.x);
@@ -706,8 +1041,8 @@ void LayoutAnimationsProxy::startEnteringAnimation(
     yogaValues.setProperty(uiRuntime, "targetHeight", values.height);
     yogaValues.setProperty(uiRuntime, "windowWidth", values.windowWidth);
     yogaValues.setProperty(uiRuntime, "windowHeight", values.windowHeight);
-    strongThis->layoutAnimationsManager_->startLayoutAnimation(
-        uiRuntime, tag, LayoutAnimationType::ENTERING, yogaValues);
+    starts.push_back(
+        {tag, LayoutAnimationType::ENTERING, std::move(yogaValues)});
   });
 }
 
@@ -719,37 +1054,55 @@ void LayoutAnimationsProxy::startExitingAnimation(
 #endif
   auto surfaceId = mutation.oldChildShadowView.surfaceId;
 
-  uiScheduler_->scheduleOnUI(
-      [weakThis = weak_from_this(), tag, mutation, surfaceId]() {
-        auto strongThis = weakThis.lock();
-        if (!strongThis) {
-          return;
-        }
-
+  pendingAnimationStarts_.emplace_back(
+      [tag, mutation, surfaceId](
+          const LayoutAnimationsProxy &proxy,
+          std::vector<LayoutAnimationStart> &starts) {
         auto oldView = mutation.oldChildShadowView;
         Rect window{};
         {
-          auto &mutex = strongThis->mutex;
-          auto lock = std::unique_lock<std::recursive_mutex>(mutex);
-          strongThis->createLayoutAnimation(mutation, oldView, surfaceId, tag);
-          window = strongThis->surfaceManager.getWindow(surfaceId);
+          auto lock = std::unique_lock<std::recursive_mutex>(proxy.mutex);
+          proxy.createLayoutAnimation(mutation, oldView, surfaceId, tag);
+          window = proxy.surfaceManager.getWindow(surfaceId);
         }
 
         Snapshot values(oldView, window);
+        if (proxy.maybeStartNativeLayoutAnimation(
+                tag, LayoutAnimationType::EXITING, values, std::nullopt)) {
+          proxy.layoutAnimationsManager_->clearLayoutAnimationConfig(tag);
+          return;
+        }
 
-        auto &uiRuntime = strongThis->uiRuntime_;
-        jsi::Object yogaValues(uiRuntime);
-        yogaValues.setProperty(uiRuntime, "currentOriginX", values.x);
-        yogaValues.setProperty(uiRuntime, "currentGlobalOriginX", values.x);
-        yogaValues.setProperty(uiRuntime, "currentOriginY", values.y);
-        yogaValues.setProperty(uiRuntime, "currentGlobalOriginY", values.y);
-        yogaValues.setProperty(uiRuntime, "currentWidth", values.width);
-        yogaValues.setProperty(uiRuntime, "currentHeight", values.height);
-        yogaValues.setProperty(uiRuntime, "windowWidth", values.windowWidth);
-        yogaValues.setProperty(uiRuntime, "windowHeight", values.windowHeight);
-        strongThis->layoutAnimationsManager_->startLayoutAnimation(
-            uiRuntime, tag, LayoutAnimationType::EXITING, yogaValues);
-        strongThis->layoutAnimationsManager_->clearLayoutAnimationConfig(tag);
+        // The config is cleared after the batch is started
+        starts.push_back(
+            {tag,
+             LayoutAnimationType::EXITING,
+             createExitingValues(proxy.uiRuntime_, values)});
+      });
+}
+
+void LayoutAnimationsProxy::skipExitingAnimation(
+    const int tag,
+    const ShadowViewMutation &mutation) const {
+  const auto &oldView = mutation.oldChildShadowView;
+
+  pendingAnimationStarts_.emplace_back(
+      [tag, oldView](
+          const LayoutAnimationsProxy &proxy,
+          std::vector<LayoutAnimationStart> &starts) {
+        Rect window{};
+        {
+          auto lock = std::unique_lock<std::recursive_mutex>(proxy.mutex);
+          window = proxy.surfaceManager.getWindow(oldView.surfaceId);
+        }
+
+        // The callback is read from the style returned by the animation
+        // worklet, which needs the same values as a started animation
+        starts.push_back(
+            {tag,
+             LayoutAnimationType::EXITING,
+             createExitingValues(proxy.uiRuntime_, Snapshot(oldView, window)),
+             true});
       });
 }
 
@@ -761,28 +1114,26 @@ void LayoutAnimationsProxy::startLayoutAnimation(
 #endif
   auto surfaceId = mutation.oldChildShadowView.surfaceId;
 
-  uiScheduler_->scheduleOnUI([weakThis = weak_from_this(),
-                              mutation,
-                              surfaceId,
-                              tag]() {
-    auto strongThis = weakThis.lock();
-    if (!strongThis) {
-      return;
-    }
-
+  pendingAnimationStarts_.emplace_back([mutation, surfaceId, tag](
+                                           const LayoutAnimationsProxy &proxy,
+                                           std::vector<LayoutAnimationStart>
+                                               &starts) {
     auto oldView = mutation.oldChildShadowView;
     Rect window{};
     {
-      auto &mutex = strongThis->mutex;
-      auto lock = std::unique_lock<std::recursive_mutex>(mutex);
-      strongThis->createLayoutAnimation(mutation, oldView, surfaceId, tag);
-      window = strongThis->surfaceManager.getWindow(surfaceId);
+      auto lock = std::unique_lock<std::recursive_mutex>(proxy.mutex);
+      proxy.createLayoutAnimation(mutation, oldView, surfaceId, tag);
+      window = proxy.surfaceManager.getWindow(surfaceId);
     }
 
     Snapshot currentValues(oldView, window);
     Snapshot targetValues(mutation.newChildShadowView, window);
+    if (proxy.maybeStartNativeLayoutAnimation(
+            tag, LayoutAnimationType::LAYOUT, currentValues, targetValues)) {
+      return;
+    }
 
-    auto &uiRuntime = strongThis->uiRuntime_;
+    auto &uiRuntime = proxy.uiRuntime_;
     jsi::Object yogaValues(uiRuntime);
     yogaValues.setProperty(uiRuntime, "currentOriginX", currentValues.x);
     yogaValues.setProperty(uiRuntime, "currentGlobalOriginX", currentValues.x);
@@ -799,11 +1150,39 @@ void LayoutAnimationsProxy::startLayoutAnimation(
     yogaValues.setProperty(uiRuntime, "windowWidth", targetValues.windowWidth);
     yogaValues.setProperty(
         uiRuntime, "windowHeight", targetValues.windowHeight);
-    strongThis->layoutAnimationsManager_->startLayoutAnimation(
-        uiRuntime, tag, LayoutAnimationType::LAYOUT, yogaValues);
+    starts.push_back({tag, LayoutAnimationType::LAYOUT, std::move(yogaValues)});
   });
 }
 
+void LayoutAnimationsProxy::flushAnimationStarts() const {
+  std::vector<LayoutAnimationStartJob> jobs;
+  {
+    auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+    jobs = std::move(pendingAnimationStarts_);
+    pendingAnimationStarts_.clear();
+  }
+  if (jobs.empty()) {
+    return;
+  }
+
+  uiScheduler_->scheduleOnUI(
+      [weakThis = weak_from_this(), jobs = std::move(jobs)]() {
+        auto strongThis = weakThis.lock();
+        if (!strongThis) {
+          return;
+        }
+
+        std::vector<LayoutAnimationStart> starts;
+        starts.reserve(jobs.size());
+        for (const auto &job : jobs) {
+          job(*strongThis, starts);
+        }
+
+        strongThis->layoutAnimationsManager_->startLayoutAnimations(
+            strongThis->uiRuntime_, starts);
+      });
+}
+
 void LayoutAnimationsProxy::updateOngoingAnimationTarget(
     const int tag,
     const ShadowViewMutation &mutation) const {
@@ -816,6 +1195,10 @@ void LayoutAnimationsProxy::maybeCancelAnimation(const int tag) const {
     return;
   }
   layoutAnimations_.erase(tag);
+  if (nativeLayoutAnimations_.erase(tag)) {
+    // Native animations don't have their JS counterpart to stop
+    return;
+  }
   uiScheduler_->scheduleOnUI([weakThis = weak_from_this(), tag]() {
     auto strongThis = weakThis.lock();
     if (!strongThis) {
@@ -827,17 +1210,60 @@ void LayoutAnimationsProxy::maybeCancelAnimation(const int tag) const {
   });
 }
 
+bool LayoutAnimationsProxy::maybeStartNativeLayoutAnimation(
+    const int tag,
+    const LayoutAnimationType type,
+    const std::optional<Snapshot> &current,
+    const std::optional<Snapshot> &target) const {
+  const auto preset =
+      layoutAnimationsManager_->getLayoutAnimationPreset(tag, type);
+  if (!preset) {
+    return false;
+  }
+
+  bool shouldStopJSAnimation = false;
+  {
+    auto lock = std::unique_lock<std::recursive_mutex>(mutex);
+    auto layoutAnimationIt = layoutAnimations_.find(tag);
+    if (layoutAnimationIt == layoutAnimations_.end()) {
+      return true;
+    }
+    auto &layoutAnimation = layoutAnimationIt->second;
+
+    // The count of the layout animation was increased for the new animation,
+    // so it has to be decreased for the replaced one, which will never end
+    if (nativeLayoutAnimations_.erase(tag)) {
+      layoutAnimation.count = std::max(layoutAnimation.count - 1, 1);
+    } else {
+      shouldStopJSAnimation = layoutAnimation.count > 1;
+    }
+    nativeLayoutAnimations_.emplace(
+        tag,
+        NativeLayoutAnimation(
+            type, preset, current, target, isReducedMotionEnabled()));
+  }
+
+  if (shouldStopJSAnimation) {
+    // Decreases the count when the JS animation ends
+    layoutAnimationsManager_->cancelLayoutAnimation(uiRuntime_, tag);
+  }
+  requestNativeLayoutAnimationsFrame_();
+  return true;
+}
+
+bool LayoutAnimationsProxy::isReducedMotionEnabled() const {
+  // Read from the UI runtime on every start, as the setting can be changed
+  // after the preset was configured
+  const auto isReducedMotion = uiRuntime_.global().getProperty(
+      uiRuntime_, "_REANIMATED_IS_REDUCED_MOTION");
+  return isReducedMotion.isBool() && isReducedMotion.getBool();
+}
+
 void LayoutAnimationsProxy::transferConfigFromNativeID(
     const std::string nativeIdString,
     const int tag) const {
-  if (nativeIdString.empty()) {
-    return;
-  }
-  try {
-    auto nativeId = stoi(nativeIdString);
-    layoutAnimationsManager_->transferConfigFromNativeID(nativeId, tag);
-  } catch (std::invalid_argument) {
-  } catch (std::out_of_range) {
+  if (const auto nativeId = parseNativeID(nativeIdString)) {
+    layoutAnimationsManager_->transferConfigFromNativeID(*nativeId, tag);
   }
 }
 
@@ -848,6 +1274,12 @@ std::shared_ptr<ShadowView> LayoutAnimationsProxy::cloneViewWithoutOpacity(
     facebook::react::ShadowViewMutation &mutation,
     const PropsParserContext &propsParserContext) const {
   auto newView = std::make_shared<ShadowView>(mutation.newChildShadowView);
+  const auto prepared = preparedEnteringViews_.take(newView->tag);
+  if (prepared.has_value() && prepared->sourceProps == newView->props) {
+    newView->props = prepared->propsWithoutOpacity;
+    return newView;
+  }
+
   folly::dynamic opacity = folly::dynamic::object("opacity", 0);
   auto newProps = getComponentDescriptorForShadowView(*newView).cloneProps(
       propsParserContext, newView->props, RawProps(opacity));
@@ -868,9 +1300,15 @@ void LayoutAnimationsProxy::maybeRestoreOpacity(
 void LayoutAnimationsProxy::maybeUpdateWindowDimensions(
     facebook::react::ShadowViewMutation &mutation,
     SurfaceId surfaceId) const {
+  // The root view of a surface has the surface id as its tag, so the kind of
+  // the component is checked only for updates of root views. Dimensions
+  // are cached per surface and change only with the layout of the root.
   if (mutation.type == ShadowViewMutation::Update &&
-      !std::strcmp(
-          mutation.oldChildShadowView.componentName, RootComponentName)) {
+      mutation.oldChildShadowView.tag == surfaceId &&
+      (hasLayoutChanged(mutation) || !surfaceManager.hasWindow(surfaceId)) &&
+      componentKinds_.get(
+          mutation.oldChildShadowView.componentHandle,
+          mutation.oldChildShadowView.componentName) == ComponentKind::Root) {
     surfaceManager.updateWindow(
         surfaceId,
         mutation.newChildShadowView.layoutMetrics.frame.size.width,
@@ -1,18 +1,29 @@
 #pragma once
 
+#include <reanimated/LayoutAnimations/ComponentKindCache.h>
+#include <reanimated/LayoutAnimations/LayoutAnimationPresets.h>
 #include <reanimated/LayoutAnimations/LayoutAnimationsManager.h>
 #include <reanimated/LayoutAnimations/LayoutAnimationsUtils.h>
+#include <reanimated/LayoutAnimations/PreparedEnteringViews.h>
+#include <reanimated/Tools/FeatureFlags.h>
 
 #include <worklets/Tools/UIScheduler.h>
 
 #include <react/renderer/componentregistry/ComponentDescriptorFactory.h>
+#include <react/renderer/components/root/RootShadowNode.h>
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
+#include <react/renderer/mounting/ShadowTreeRevision.h>
 #include <react/renderer/mounting/ShadowView.h>
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace reanimated {
@@ -38,32 +49,93 @@ struct LayoutAnimationsProxy
       public std::enable_shared_from_this<LayoutAnimationsProxy> {
   mutable std::unordered_map<Tag, std::shared_ptr<Node>> nodeForTag_;
   mutable std::unordered_map<Tag, LayoutAnimation> layoutAnimations_;
+  // Animations of native presets, progressed in
+  // progressNativeLayoutAnimations instead of by the JS animations manager
+  mutable std::unordered_map<Tag, NativeLayoutAnimation>
+      nativeLayoutAnimations_;
   mutable std::recursive_mutex mutex;
   mutable SurfaceManager surfaceManager;
+  mutable ComponentKindCache componentKinds_{RootShadowNode::Handle()};
   mutable std::unordered_set<std::shared_ptr<MutationNode>> deadNodes;
-  mutable std::unordered_map<Tag, int> leastRemoved;
   std::shared_ptr<LayoutAnimationsManager> layoutAnimationsManager_;
   ContextContainer::Shared contextContainer_;
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   jsi::Runtime &uiRuntime_;
   const std::shared_ptr<UIScheduler> uiScheduler_;
+  // Starts of layout animations collected in pullTransaction. They are run
+  // on the UI thread once the transaction is pulled, so that all JS
+  // animations are started with a single call.
+  using LayoutAnimationStartJob = std::function<void(
+      const LayoutAnimationsProxy &,
+      std::vector<LayoutAnimationStart> &)>;
+  mutable std::vector<LayoutAnimationStartJob> pendingAnimationStarts_;
+  // Makes sure that progressNativeLayoutAnimations is called in the next
+  // frame
+  const std::function<void()> requestNativeLayoutAnimationsFrame_;
+  // Last mounted tree of surfaces that haven't pulled their next transaction
+  // yet. Views removed by that transaction are still in it, so it is used to
+  // find removed views that are outside of the window (kept only if their
+  // exiting animations are skipped). Entries are dropped once the transaction
+  // is handled, so trees of stopped surfaces aren't retained.
+  mutable std::unordered_map<SurfaceId, RootShadowNode::Shared> mountedRoots_;
+  // Removed views of the current transaction that are outside of the window,
+  // collected when the first view with an exiting animation is found
+  mutable std::optional<std::unordered_set<Tag>> offscreenTags_;
+  mutable std::atomic<uint64_t> skippedExitingAnimationsCount_{0};
+  // Props without opacity of views with entering animations, cloned on the
+  // commit thread so that pullTransaction can use them instead of cloning
+  // props while mounting. They are used only if the mounted view has the same
+  // props as the one they were prepared for.
+  struct PreparedEnteringView {
+    Props::Shared sourceProps;
+    Props::Shared propsWithoutOpacity;
+  };
+  mutable PreparedEnteringViews<PreparedEnteringView> preparedEnteringViews_;
   LayoutAnimationsProxy(
       std::shared_ptr<LayoutAnimationsManager> layoutAnimationsManager,
       SharedComponentDescriptorRegistry componentDescriptorRegistry,
       ContextContainer::Shared contextContainer,
       jsi::Runtime &uiRuntime,
-      const std::shared_ptr<UIScheduler> uiScheduler)
+      const std::shared_ptr<UIScheduler> uiScheduler,
+      std::function<void()> requestNativeLayoutAnimationsFrame)
       : layoutAnimationsManager_(layoutAnimationsManager),
         contextContainer_(contextContainer),
         componentDescriptorRegistry_(componentDescriptorRegistry),
         uiRuntime_(uiRuntime),
-        uiScheduler_(uiScheduler) {}
+        uiScheduler_(uiScheduler),
+        requestNativeLayoutAnimationsFrame_(
+            std::move(requestNativeLayoutAnimationsFrame)) {}
 
   void startEnteringAnimation(const int tag, ShadowViewMutation &mutation)
       const;
   void startExitingAnimation(const int tag, ShadowViewMutation &mutation) const;
+  // Calls the callback of the exiting animation with finished set to false
+  // without running the animation
+  void skipExitingAnimation(const int tag, const ShadowViewMutation &mutation)
+      const;
   void startLayoutAnimation(const int tag, const ShadowViewMutation &mutation)
       const;
+  void flushAnimationStarts() const;
+
+  // Called after the tree of the surface is mounted
+  void setMountedRoot(const RootShadowNode::Shared &rootShadowNode) const;
+  // Number of exiting animations that weren't started, because their views
+  // were outside of the window
+  uint64_t getSkippedExitingAnimationsCount() const;
+  bool isOutsideOfWindow(const std::shared_ptr<MutationNode> &node) const;
+
+  // Called on the commit thread for commits from React Native. Prepares
+  // views created by the commit (which creates the given revision) that will
+  // start entering animations.
+  void prepareEnteringViews(
+      const RootShadowNode &oldRootShadowNode,
+      const RootShadowNode &newRootShadowNode,
+      ShadowTreeRevision::Number revision) const;
+  // Called after the given revision of the surface is mounted. Clears views
+  // prepared by commits included in it.
+  void clearPreparedEnteringViews(
+      SurfaceId surfaceId,
+      ShadowTreeRevision::Number mountedRevision) const;
 
   void transferConfigFromNativeID(const std::string nativeId, const int tag)
       const;
@@ -73,6 +145,30 @@ struct LayoutAnimationsProxy
   std::optional<SurfaceId> endLayoutAnimation(int tag, bool shouldRemove);
   void maybeCancelAnimation(const int tag) const;
 
+  // Returns false if the view has no native preset for the animation type,
+  // in which case the animation has to be started in JS
+  bool maybeStartNativeLayoutAnimation(
+      const int tag,
+      const LayoutAnimationType type,
+      const std::optional<Snapshot> &current,
+      const std::optional<Snapshot> &target) const;
+  // Has to be called on the UI thread
+  bool isReducedMotionEnabled() const;
+  // Returns surfaces that have to be notified about the updates
+  std::vector<SurfaceId> progressNativeLayoutAnimations(double timestamp);
+  bool hasNativeLayoutAnimations() const;
+  void updateLayoutAnimationProps(
+      const int tag,
+      const LayoutAnimation &layoutAnimation,
+      RawProps &&rawProps,
+      Frame &&frame) const;
+  // Fast path for frames that animate only the frame, opacity and transform,
+  // which creates RawProps from the values instead of converting a JS style
+  void updateLayoutAnimationValues(
+      const int tag,
+      const LayoutAnimation &layoutAnimation,
+      LayoutAnimationPresetValues &&values) const;
+
   void parseRemoveMutations(
       std::unordered_map<Tag, Tag> &movedViews,
       ShadowViewMutationList &mutations,
@@ -122,6 +218,9 @@ struct LayoutAnimationsProxy
   void endAnimationsRecursively(
       std::shared_ptr<MutationNode> node,
       ShadowViewMutationList &mutations) const;
+  // Removes the node from nodeForTag_ if it is a placeholder of a view that
+  // wasn't removed and has no removed children left
+  void maybeDropPlaceholder(const std::shared_ptr<Node> &node) const;
   void maybeDropAncestors(
       std::shared_ptr<Node> node,
       std::shared_ptr<MutationNode> child,
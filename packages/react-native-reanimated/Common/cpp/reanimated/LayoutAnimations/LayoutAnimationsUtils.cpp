@@ -18,7 +18,9 @@ void SurfaceManager::updateWindow(
     const SurfaceId surfaceId,
     const double windowWidth,
     const double windowHeight) {
-  windows_.insert_or_assign(surfaceId, Rect{windowWidth, windowHeight});
+  auto &window = windows_[surfaceId];
+  window.width = windowWidth;
+  window.height = windowHeight;
 }
 
 Rect SurfaceManager::getWindow(SurfaceId surfaceId) {
@@ -29,6 +31,10 @@ Rect SurfaceManager::getWindow(SurfaceId surfaceId) {
   return Rect{0, 0};
 }
 
+bool SurfaceManager::hasWindow(SurfaceId surfaceId) const {
+  return windows_.contains(surfaceId);
+}
+
 void Node::applyMutationToIndices(ShadowViewMutation mutation) {
 #if REACT_NATIVE_MINOR_VERSION >= 78
   const auto parentTag = mutation.parentTag;
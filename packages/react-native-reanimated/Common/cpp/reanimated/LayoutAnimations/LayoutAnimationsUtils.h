@@ -5,7 +5,9 @@
 #include <react/renderer/mounting/MountingOverrideDelegate.h>
 #include <react/renderer/mounting/ShadowView.h>
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -19,19 +21,24 @@ struct Rect {
 
 struct Frame {
   std::optional<double> x, y, width, height;
-  Frame(jsi::Runtime &runtime, const jsi::Object &newStyle) {
-    if (newStyle.hasProperty(runtime, "originX")) {
-      x = newStyle.getProperty(runtime, "originX").asNumber();
-    }
-    if (newStyle.hasProperty(runtime, "originY")) {
-      y = newStyle.getProperty(runtime, "originY").asNumber();
-    }
-    if (newStyle.hasProperty(runtime, "width")) {
-      width = newStyle.getProperty(runtime, "width").asNumber();
-    }
-    if (newStyle.hasProperty(runtime, "height")) {
-      height = newStyle.getProperty(runtime, "height").asNumber();
+  Frame() = default;
+  Frame(jsi::Runtime &runtime, const jsi::Object &newStyle)
+      : x(getNumber(runtime, newStyle, "originX")),
+        y(getNumber(runtime, newStyle, "originY")),
+        width(getNumber(runtime, newStyle, "width")),
+        height(getNumber(runtime, newStyle, "height")) {}
+
+ private:
+  // A single lookup is cheaper than hasProperty followed by getProperty
+  static std::optional<double> getNumber(
+      jsi::Runtime &runtime,
+      const jsi::Object &newStyle,
+      const char *name) {
+    const auto value = newStyle.getProperty(runtime, name);
+    if (value.isUndefined()) {
+      return std::nullopt;
     }
+    return value.asNumber();
   }
 };
 
@@ -114,6 +121,7 @@ struct SurfaceManager {
   void
   updateWindow(SurfaceId surfaceId, double windowWidth, double windowHeight);
   Rect getWindow(SurfaceId surfaceId);
+  bool hasWindow(SurfaceId surfaceId) const;
 };
 
 static inline void updateLayoutMetrics(
@@ -134,13 +142,6 @@ static inline void updateLayoutMetrics(
   }
 }
 
-static inline bool isRNSScreen(std::shared_ptr<MutationNode> node) {
-  const auto &componentName = node->mutation.oldChildShadowView.componentName;
-  return !std::strcmp(componentName, "RNSScreenStack") ||
-      !std::strcmp(componentName, "RNSScreen") ||
-      !std::strcmp(componentName, "RNSModalScreen");
-}
-
 static inline bool hasLayoutChanged(const ShadowViewMutation &mutation) {
   return mutation.oldChildShadowView.layoutMetrics.frame !=
       mutation.newChildShadowView.layoutMetrics.frame;
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace reanimated {
+
+// Values prepared on the commit thread for views created by a commit, kept
+// until the transaction that mounts the view takes them. A transaction can
+// include several commits, so values are matched with the revision created
+// by the commit that prepared them instead of with a transaction. Once a
+// revision is mounted, values of all revisions up to it were either taken or
+// won't be used anymore (e.g. because their views were flattened).
+template <typename TValue>
+class PreparedEnteringViews {
+ public:
+  using SurfaceId = int32_t;
+  using Tag = int32_t;
+  // Number of the shadow tree revision
+  using Revision = int64_t;
+
+  void prepare(
+      const SurfaceId surfaceId,
+      const Tag tag,
+      const Revision revision,
+      TValue &&value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.insert_or_assign(
+        tag,
+        Entry{
+            .surfaceId = surfaceId,
+            .revision = revision,
+            .value = std::move(value)});
+  }
+
+  // Removes the value prepared for the view and returns it
+  std::optional<TValue> take(const Tag tag) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = entries_.find(tag);
+    if (it == entries_.end()) {
+      return std::nullopt;
+    }
+    auto value = std::move(it->second.value);
+    entries_.erase(it);
+    return value;
+  }
+
+  // Clears values prepared by commits included in the mounted revision.
+  // Values of newer commits are kept, as they are mounted later.
+  void clearMounted(const SurfaceId surfaceId, const Revision mountedRevision) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::erase_if(entries_, [&](const auto &item) {
+      const auto &entry = item.second;
+      return entry.surfaceId == surfaceId && entry.revision <= mountedRevision;
+    });
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  struct Entry {
+    SurfaceId surfaceId;
+    Revision revision;
+    TValue value;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<Tag, Entry> entries_;
+};
+
+} // namespace reanimated
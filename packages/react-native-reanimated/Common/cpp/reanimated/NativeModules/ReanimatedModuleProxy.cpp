@@ -1,12 +1,15 @@
 #include <jsi/jsi.h>
+#include <reanimated/CSS/config/common.h>
 #include <reanimated/NativeModules/ReanimatedModuleProxy.h>
 #include <reanimated/RuntimeDecorators/UIRuntimeDecorator.h>
 #include <reanimated/Tools/FeatureFlags.h>
+#include <reanimated/Tools/FrameDispatcher.h>
 #include <reanimated/Tools/ReanimatedSystraceSection.h>
+#include <reanimated/Tools/WakeupTimer.h>
+#include <reanimated/Tools/WorkerPool.h>
 
 #include <worklets/Registries/EventHandlerRegistry.h>
 #include <worklets/SharedItems/Shareables.h>
-#include <worklets/Tools/AsyncQueue.h>
 #include <worklets/Tools/WorkletEventHandler.h>
 
 #ifdef __ANDROID__
@@ -17,10 +20,14 @@
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/primitives.h>
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -36,7 +43,8 @@ ReanimatedModuleProxy::ReanimatedModuleProxy(
       isReducedMotion_(isReducedMotion),
       workletsModuleProxy_(workletsModuleProxy),
       eventHandlerRegistry_(std::make_unique<EventHandlerRegistry>()),
-      requestRender_(platformDepMethodsHolder.requestRender),
+      frameDispatcher_(std::make_shared<FrameDispatcher>(
+          platformDepMethodsHolder.requestRender)),
       animatedSensorModule_(platformDepMethodsHolder),
       jsLogger_(
           std::make_shared<JSLogger>(workletsModuleProxy->getJSScheduler())),
@@ -55,6 +63,8 @@ ReanimatedModuleProxy::ReanimatedModuleProxy(
       viewStylesRepository_(std::make_shared<ViewStylesRepository>(
           staticPropsRegistry_,
           animatedPropsRegistry_)),
+      cssBakingQueue_(
+          std::make_shared<worklets::AsyncQueue>("Reanimated CSS baking")),
       subscribeForKeyboardEventsFunction_(
           platformDepMethodsHolder.subscribeForKeyboardEvents),
       unsubscribeFromKeyboardEventsFunction_(
@@ -67,21 +77,30 @@ ReanimatedModuleProxy::ReanimatedModuleProxy(
   updatesRegistryManager_->addRegistry(cssTransitionsRegistry_);
   updatesRegistryManager_->addRegistry(animatedPropsRegistry_);
   updatesRegistryManager_->addRegistry(cssAnimationsRegistry_);
+
+  if constexpr (StaticFeatureFlags::getFlag("CSS_PARALLEL_UPDATES")) {
+    // Views are interpolated independently, so CSS registries can split the
+    // work between a few threads (the UI thread is one of them)
+    const auto threadsCount = std::clamp<size_t>(
+        std::thread::hardware_concurrency(), 1, CSS_UPDATE_MAX_THREADS_COUNT);
+    const auto workerPool = std::make_shared<WorkerPool>(threadsCount);
+    cssAnimationsRegistry_->setWorkerPool(workerPool);
+    cssTransitionsRegistry_->setWorkerPool(workerPool);
+  }
+
+  if constexpr (StaticFeatureFlags::getFlag("VIEWPORT_CULLING")) {
+    // Updates of views far outside of the viewport (e.g. items of long lists)
+    // aren't committed until the views are scrolled back into it
+    viewportCuller_ = std::make_shared<ViewportCuller>();
+    cssTransitionsRegistry_->setViewportCuller(viewportCuller_);
+    animatedPropsRegistry_->setViewportCuller(viewportCuller_);
+    cssAnimationsRegistry_->setViewportCuller(viewportCuller_);
+  }
 }
 
 void ReanimatedModuleProxy::init(
     const PlatformDepMethodsHolder &platformDepMethodsHolder) {
-  auto onRenderCallback = [weakThis =
-                               weak_from_this()](const double timestampMs) {
-    auto strongThis = weakThis.lock();
-    if (!strongThis) {
-      return;
-    }
-
-    strongThis->renderRequested_ = false;
-    strongThis->onRender(timestampMs);
-  };
-  onRenderCallback_ = std::move(onRenderCallback);
+  initializeFramePhases();
 
   auto updateProps = [weakThis = weak_from_this()](
                          jsi::Runtime &rt, const jsi::Value &operations) {
@@ -179,14 +198,17 @@ void ReanimatedModuleProxy::init(
       platformDepMethodsHolder.setGestureStateFunction,
       progressLayoutAnimation,
       endLayoutAnimation,
-      platformDepMethodsHolder.maybeFlushUIUpdatesQueueFunction);
+      platformDepMethodsHolder.maybeFlushUIUpdatesQueueFunction,
+      isReducedMotion_);
 }
 
 ReanimatedModuleProxy::~ReanimatedModuleProxy() {
-  // event handler registry and frame callbacks store some JSI values from UI
-  // runtime, so they have to go away before we tear down the runtime
+  // event handler registry, frame callbacks and layout animations manager
+  // store some JSI values from UI runtime, so they have to go away before we
+  // tear down the runtime
   eventHandlerRegistry_.reset();
   frameCallbacks_.clear();
+  layoutAnimationsManager_->clearCachedFunctions();
 }
 
 jsi::Value ReanimatedModuleProxy::registerEventHandler(
@@ -342,7 +364,12 @@ jsi::Value ReanimatedModuleProxy::configureLayoutAnimationBatch(
     batchItem.type = static_cast<LayoutAnimationType>(
         item.getProperty(rt, "type").asNumber());
     auto config = item.getProperty(rt, "config");
-    if (config.isUndefined()) {
+    auto preset = item.getProperty(rt, "preset");
+    if (!preset.isUndefined()) {
+      // Native presets are parsed only once here, so that nothing has to be
+      // read from JS when the animation starts
+      batchItem.preset = parseLayoutAnimationPreset(rt, preset);
+    } else if (config.isUndefined()) {
       batchItem.config = nullptr;
     } else {
       batchItem.config = extractShareableOrThrow<ShareableObject>(
@@ -371,18 +398,16 @@ bool ReanimatedModuleProxy::isAnyHandlerWaitingForEvent(
 }
 
 void ReanimatedModuleProxy::maybeRequestRender() {
-  if (!renderRequested_) {
-    renderRequested_ = true;
-    requestRender_(onRenderCallback_);
-  }
+  frameDispatcher_->requestPhase(FramePhase::FrameCallbacks);
 }
 
 void ReanimatedModuleProxy::onRender(double timestampMs) {
   ReanimatedSystraceSection s("ReanimatedModuleProxy::onRender");
   auto callbacks = std::move(frameCallbacks_);
   frameCallbacks_.clear();
-  jsi::Runtime &uiRuntime =
-      workletsModuleProxy_->getUIWorkletRuntime()->getJSIRuntime();
+  const auto uiWorkletRuntime = workletsModuleProxy_->getUIWorkletRuntime();
+  const auto lockScope = uiWorkletRuntime->lockScope();
+  jsi::Runtime &uiRuntime = uiWorkletRuntime->getJSIRuntime();
   jsi::Value timestamp{timestampMs};
   for (const auto &callback : callbacks) {
     runOnRuntimeGuarded(uiRuntime, *callback, timestamp);
@@ -425,11 +450,32 @@ void ReanimatedModuleProxy::setViewStyle(
   }
 }
 
+void ReanimatedModuleProxy::setAnimatedPropsUpdateRate(
+    jsi::Runtime &rt,
+    const jsi::Value &viewTag,
+    const jsi::Value &updateRate) {
+  const auto tag = static_cast<Tag>(viewTag.asNumber());
+  const auto parsedUpdateRate = css::parseUpdateRate(rt, updateRate);
+
+  // Animated props are collected on the UI thread, so the rate is changed
+  // there as well
+  workletsModuleProxy_->getUIScheduler()->scheduleOnUI(
+      [weakThis = weak_from_this(), tag, parsedUpdateRate]() {
+        auto strongThis = weakThis.lock();
+        if (!strongThis) {
+          return;
+        }
+        auto lock = strongThis->animatedPropsRegistry_->lock();
+        strongThis->animatedPropsRegistry_->setUpdateRate(
+            tag, parsedUpdateRate);
+      });
+}
+
 void ReanimatedModuleProxy::markNodeAsRemovable(
     jsi::Runtime &rt,
     const jsi::Value &shadowNodeWrapper) {
-  auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
-  updatesRegistryManager_->markNodeAsRemovable(shadowNode);
+  const auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
+  updatesRegistryManager_->markNodeAsRemovable(ShadowNodeHandle(*shadowNode));
 }
 
 void ReanimatedModuleProxy::unmarkNodeAsRemovable(
@@ -445,7 +491,12 @@ void ReanimatedModuleProxy::registerCSSKeyframes(
   cssAnimationKeyframesRegistry_->add(
       animationName.asString(rt).utf8(rt),
       parseCSSAnimationKeyframesConfig(
-          rt, keyframesConfig, viewStylesRepository_));
+          rt,
+          keyframesConfig,
+          viewStylesRepository_,
+          [cssBakingQueue = cssBakingQueue_](std::function<void()> &&job) {
+            cssBakingQueue->push(std::move(job));
+          }));
 }
 
 void ReanimatedModuleProxy::unregisterCSSKeyframes(
@@ -458,7 +509,8 @@ void ReanimatedModuleProxy::applyCSSAnimations(
     jsi::Runtime &rt,
     const jsi::Value &shadowNodeWrapper,
     const jsi::Value &animationUpdates) {
-  auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
+  const ShadowNodeHandle shadowNode(
+      *shadowNodeFromValue(rt, shadowNodeWrapper));
   const auto timestamp = getCssTimestamp();
   const auto updates = parseCSSAnimationUpdates(rt, animationUpdates);
 
@@ -511,10 +563,10 @@ void ReanimatedModuleProxy::registerCSSTransition(
     jsi::Runtime &rt,
     const jsi::Value &shadowNodeWrapper,
     const jsi::Value &transitionConfig) {
-  auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
+  const auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
 
   auto transition = std::make_shared<CSSTransition>(
-      std::move(shadowNode),
+      ShadowNodeHandle(*shadowNode),
       parseCSSTransitionConfig(rt, transitionConfig),
       viewStylesRepository_);
 
@@ -549,8 +601,10 @@ bool ReanimatedModuleProxy::handleEvent(
     double currentTime) {
   ReanimatedSystraceSection s("ReanimatedModuleProxy::handleEvent");
 
+  const auto uiWorkletRuntime = workletsModuleProxy_->getUIWorkletRuntime();
+  const auto lockScope = uiWorkletRuntime->lockScope();
   eventHandlerRegistry_->processEvent(
-      workletsModuleProxy_->getUIWorkletRuntime(),
+      uiWorkletRuntime,
       currentTime,
       eventName,
       emitterReactTag,
@@ -586,12 +640,20 @@ bool ReanimatedModuleProxy::handleRawEvent(
     return false;
   }
 
-  jsi::Runtime &rt =
-      workletsModuleProxy_->getUIWorkletRuntime()->getJSIRuntime();
-  const auto &eventPayload = rawEvent.eventPayload;
-  jsi::Value payload = eventPayload->asJSIValue(rt);
-
-  auto res = handleEvent(eventType, tag, std::move(payload), currentTime);
+  const auto uiWorkletRuntime = workletsModuleProxy_->getUIWorkletRuntime();
+  bool res;
+  {
+    const auto lockScope = uiWorkletRuntime->lockScope();
+    jsi::Runtime &rt = uiWorkletRuntime->getJSIRuntime();
+    const auto &eventPayload = rawEvent.eventPayload;
+    auto scrollEventPayload = scrollEventPayloadFactory_.create(
+        rt, uiWorkletRuntime->getGeneration(), *eventPayload);
+    jsi::Value payload = scrollEventPayload.has_value()
+        ? std::move(scrollEventPayload.value())
+        : eventPayload->asJSIValue(rt);
+
+    res = handleEvent(eventType, tag, std::move(payload), currentTime);
+  }
   // TODO: we should call performOperations conditionally if event is handled
   // (res == true), but for now handleEvent always returns false. Thankfully,
   // performOperations does not trigger a lot of code if there is nothing to
@@ -600,47 +662,201 @@ bool ReanimatedModuleProxy::handleRawEvent(
   return res;
 }
 
-void ReanimatedModuleProxy::cssLoopCallback(const double /*timestampMs*/) {
+void ReanimatedModuleProxy::cssLoopCallback(const double timestampMs) {
   shouldUpdateCssAnimations_ = true;
-  if (cssAnimationsRegistry_->hasUpdates() ||
-      cssTransitionsRegistry_->hasUpdates()
+
+  double frameIntervalMs;
+  {
+    std::lock_guard<std::mutex> lock(cssLoopMutex_);
+    // Only requests made after the registries are checked below can keep the
+    // loop running
+    cssLoopWakeupRequested_ = false;
+    if (lastCssLoopTimestampMs_.has_value() &&
+        timestampMs > lastCssLoopTimestampMs_.value()) {
+      cssLoopFrameIntervalMs_ = timestampMs - lastCssLoopTimestampMs_.value();
+    }
+    lastCssLoopTimestampMs_ = timestampMs;
+    frameIntervalMs = cssLoopFrameIntervalMs_;
+  }
+
+  if (cssAnimationsRegistry_->hasActiveUpdates() ||
+      cssTransitionsRegistry_->hasActiveUpdates()
 #ifdef ANDROID
       || updatesRegistryManager_->hasPropsToRevert()
 #endif // ANDROID
   ) {
-    requestRender_([weakThis = weak_from_this()](const double newTimestampMs) {
-      if (auto strongThis = weakThis.lock()) {
-        strongThis->cssLoopCallback(newTimestampMs);
+    requestCSSLoopFrame();
+    return;
+  }
+
+  // Only delayed animations and transitions (if any) are left, so instead of
+  // checking every frame whether they have started, we can stop the loop and
+  // wake it up just before the earliest of them starts
+  const auto animationTimestamp =
+      cssAnimationsRegistry_->getNextDelayedTimestamp();
+  const auto transitionTimestamp =
+      cssTransitionsRegistry_->getNextDelayedTimestamp();
+  if (!animationTimestamp.has_value() && !transitionTimestamp.has_value()) {
+    stopCSSLoop(std::nullopt);
+    return;
+  }
+
+  const auto nextTimestampMs = std::min(
+      animationTimestamp.value_or(std::numeric_limits<double>::infinity()),
+      transitionTimestamp.value_or(std::numeric_limits<double>::infinity()));
+  // Delayed items are activated in performOperations, which runs after this
+  // callback, so the loop is woken up one frame earlier and the wakeup is not
+  // worth it at all for items that start within the next frames
+  const auto delayMs =
+      nextTimestampMs - getAnimationTimestamp_() - frameIntervalMs;
+  if (delayMs <= frameIntervalMs) {
+    requestCSSLoopFrame();
+    return;
+  }
+
+  stopCSSLoop(delayMs);
+}
+
+uint64_t ReanimatedModuleProxy::getSkippedCSSLoopWakeupsCount() const {
+  std::lock_guard<std::mutex> lock(cssLoopMutex_);
+  return skippedCssLoopWakeupsCount_;
+}
+
+uint64_t ReanimatedModuleProxy::getSkippedExitingAnimationsCount() const {
+  return layoutAnimationsProxy_
+      ? layoutAnimationsProxy_->getSkippedExitingAnimationsCount()
+      : 0;
+}
+
+jsi::Value ReanimatedModuleProxy::getRegistriesStats(jsi::Runtime &rt) {
+  return getRegistriesStats().toJSIObject(rt);
+}
+
+RegistriesStats ReanimatedModuleProxy::getRegistriesStats() {
+  const auto eventHandlersCount = eventHandlerRegistry_->getHandlersCount();
+
+  return {
+      .animatedProps = animatedPropsRegistry_->getStats(),
+      .cssAnimations = cssAnimationsRegistry_->getStats(),
+      .cssTransitions = cssTransitionsRegistry_->getStats(),
+      .staticProps = staticPropsRegistry_->getStats(),
+      .cssKeyframes = cssAnimationKeyframesRegistry_->getStats(),
+      .layoutAnimations = layoutAnimationsManager_->getStats(),
+      .eventHandlers = {
+          .entriesCount = eventHandlersCount,
+          .retainedBytes = eventHandlerRegistry_->getRetainedBytes()}};
+}
+
+void ReanimatedModuleProxy::requestCSSLoopFrame() {
+  frameDispatcher_->requestPhase(FramePhase::CSS);
+}
+
+void ReanimatedModuleProxy::stopCSSLoop(
+    const std::optional<double> wakeupDelayMs) {
+  {
+    std::lock_guard<std::mutex> lock(cssLoopMutex_);
+    if (!cssLoopWakeupRequested_) {
+      cssLoopRunning_ = false;
+      lastCssLoopTimestampMs_.reset();
+      if (wakeupDelayMs.has_value()) {
+        cssLoopIdleSince_ = WakeupTimer::Clock::now();
+        cssLoopWakeupTimer_.arm(
+            cssLoopIdleSince_.value() +
+                std::chrono::duration_cast<WakeupTimer::Clock::duration>(
+                    std::chrono::duration<double, std::milli>(
+                        wakeupDelayMs.value())),
+            [weakThis = weak_from_this(),
+             uiScheduler = workletsModuleProxy_->getUIScheduler()]() {
+              uiScheduler->scheduleOnUI([weakThis]() {
+                if (auto strongThis = weakThis.lock()) {
+                  strongThis->maybeRunCSSLoop();
+                }
+              });
+            });
       }
-    });
-  } else {
-    cssLoopRunning_ = false;
+      return;
+    }
   }
+
+  // CSS animations or transitions were added while the frame was processed
+  requestCSSLoopFrame();
 }
 
-void ReanimatedModuleProxy::maybeRunCSSLoop() {
-  if (cssLoopRunning_) {
+void ReanimatedModuleProxy::maybeRunLayoutAnimationsLoop() {
+  if (layoutAnimationsLoopRunning_) {
+    return;
+  }
+
+  layoutAnimationsLoopRunning_ = true;
+  frameDispatcher_->requestPhase(FramePhase::LayoutAnimations);
+}
+
+void ReanimatedModuleProxy::layoutAnimationsLoopCallback(
+    const double timestampMs) {
+  ReanimatedSystraceSection s(
+      "ReanimatedModuleProxy::layoutAnimationsLoopCallback");
+
+  layoutAnimationsLoopRunning_ = false;
+  if (!layoutAnimationsProxy_) {
     return;
   }
 
-  cssLoopRunning_ = true;
+  notifySurfacesAboutUpdates(
+      layoutAnimationsProxy_->progressNativeLayoutAnimations(timestampMs));
+
+  if (layoutAnimationsProxy_->hasNativeLayoutAnimations()) {
+    maybeRunLayoutAnimationsLoop();
+  }
+}
+
+void ReanimatedModuleProxy::notifySurfacesAboutUpdates(
+    const std::vector<SurfaceId> &surfaceIds) {
+  const auto &shadowTreeRegistry = uiManager_->getShadowTreeRegistry();
+  for (const auto surfaceId : surfaceIds) {
+    shadowTreeRegistry.visit(surfaceId, [](const ShadowTree &shadowTree) {
+      shadowTree.notifyDelegatesOfUpdates();
+    });
+  }
+}
+
+void ReanimatedModuleProxy::maybeRunCSSLoop() {
+  {
+    std::lock_guard<std::mutex> lock(cssLoopMutex_);
+    if (cssLoopRunning_) {
+      // The loop may be about to stop after the frame that is processed now
+      cssLoopWakeupRequested_ = true;
+      return;
+    }
+
+    cssLoopRunning_ = true;
+
+    // The loop may be resumed before the wakeup if new CSS animations or
+    // transitions were added in the meantime
+    cssLoopWakeupTimer_.cancel();
+    if (cssLoopIdleSince_.has_value()) {
+      const std::chrono::duration<double, std::milli> idleDuration =
+          WakeupTimer::Clock::now() - cssLoopIdleSince_.value();
+      skippedCssLoopWakeupsCount_ += static_cast<uint64_t>(
+          idleDuration.count() / cssLoopFrameIntervalMs_);
+      cssLoopIdleSince_.reset();
+    }
+  }
 
   workletsModuleProxy_->getUIScheduler()->scheduleOnUI(
       [weakThis = weak_from_this()]() {
-        auto strongThis = weakThis.lock();
-        if (!strongThis) {
-          return;
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->requestCSSLoopFrame();
         }
-        strongThis->requestRender_([weakThis](const double timestampMs) {
-          if (auto strongThis = weakThis.lock()) {
-            strongThis->cssLoopCallback(timestampMs);
-          }
-        });
       });
 }
 
 double ReanimatedModuleProxy::getCssTimestamp() {
-  if (cssLoopRunning_) {
+  bool cssLoopRunning;
+  {
+    std::lock_guard<std::mutex> lock(cssLoopMutex_);
+    cssLoopRunning = cssLoopRunning_;
+  }
+  if (cssLoopRunning) {
     return currentCssTimestamp_;
   }
   currentCssTimestamp_ = getAnimationTimestamp_();
@@ -648,6 +864,11 @@ double ReanimatedModuleProxy::getCssTimestamp() {
 }
 
 void ReanimatedModuleProxy::performOperations() {
+  // The frame dispatcher measures commits run after its phases
+  frameDispatcher_->runCommit([this]() { flushAndCommitUpdates(); });
+}
+
+void ReanimatedModuleProxy::flushAndCommitUpdates() {
   ReanimatedSystraceSection s("ReanimatedModuleProxy::performOperations");
 
   jsi::Runtime &rt =
@@ -659,6 +880,10 @@ void ReanimatedModuleProxy::performOperations() {
 
     auto lock = updatesRegistryManager_->lock();
 
+    if (viewportCuller_) {
+      updateViewportVisibility(updatesBatch);
+    }
+
     if (shouldUpdateCssAnimations_) {
       currentCssTimestamp_ = getAnimationTimestamp_();
       auto lock = cssTransitionsRegistry_->lock();
@@ -669,8 +894,16 @@ void ReanimatedModuleProxy::performOperations() {
 
     {
       auto lock = animatedPropsRegistry_->lock();
+      // Props of views with a reduced update rate are added to the batch
+      // only in frames in which they are due
+      animatedPropsRegistry_->releaseThrottledUpdates(getAnimationTimestamp_());
       // Flush all animated props updates
       animatedPropsRegistry_->flushUpdates(updatesBatch);
+      if (animatedPropsRegistry_->hasThrottledUpdates()) {
+        // Make sure that there is a frame in which held back props will be
+        // applied, even if the animation that produced them has finished
+        frameDispatcher_->requestFrame();
+      }
     }
 
     if (shouldUpdateCssAnimations_) {
@@ -685,6 +918,7 @@ void ReanimatedModuleProxy::performOperations() {
     if ((updatesBatch.size() > 0) &&
         updatesRegistryManager_->shouldReanimatedSkipCommit()) {
       updatesRegistryManager_->pleaseCommitAfterPause();
+      markSurfacesAsOutOfSync(updatesBatch);
     }
   }
 
@@ -694,10 +928,21 @@ void ReanimatedModuleProxy::performOperations() {
     // In this case, we should skip the commit here and let React Native do
     // it. The commit will include the current values from the updates manager
     // which will be applied in ReanimatedCommitHook.
+    auto lock = updatesRegistryManager_->lock();
+    markSurfacesAsOutOfSync(updatesBatch);
     return;
   }
 
-  commitUpdates(rt, updatesBatch);
+  // Updates with a reduced update rate are skipped on off-frames, so there
+  // may be nothing to commit in this frame
+  bool hasUpdatesToCommit = !updatesBatch.empty() || shouldFlushRegistry_;
+#ifdef ANDROID
+  hasUpdatesToCommit =
+      hasUpdatesToCommit || updatesRegistryManager_->hasPropsToRevert();
+#endif // ANDROID
+  if (hasUpdatesToCommit) {
+    commitUpdates(rt, updatesBatch);
+  }
 
   // Clear the entire cache after the commit
   // (we don't know if the view is updated from outside of Reanimated
@@ -705,12 +950,113 @@ void ReanimatedModuleProxy::performOperations() {
   viewStylesRepository_->clearNodesCache();
 }
 
+void ReanimatedModuleProxy::updateViewportVisibility(
+    UpdatesBatch &updatesBatch) {
+  const auto timestamp = getAnimationTimestamp_();
+  if (!viewportCuller_->isVisibilityUpdateDue(timestamp)) {
+    return;
+  }
+
+  ReanimatedSystraceSection s(
+      "ReanimatedModuleProxy::updateViewportVisibility");
+  const auto visibleTags = viewportCuller_->updateVisibility(
+      uiManager_->getShadowTreeRegistry(),
+      updatesRegistryManager_->collectShadowNodes(),
+      timestamp);
+  // Updates held back while the views were culled are added before updates
+  // of the current frame, so that the latter override them
+  updatesRegistryManager_->collectUpdates(visibleTags, updatesBatch);
+}
+
+void ReanimatedModuleProxy::requestViewportVisibilityUpdate() {
+  // Only trees mounted by React Native can lay out or scroll views with held
+  // back updates into the viewport when there are no animation frames
+  if (!viewportCuller_ || !viewportCuller_->hasHeldBackUpdates()) {
+    return;
+  }
+  viewportCuller_->invalidateVisibility();
+  frameDispatcher_->requestFrame();
+}
+
 void ReanimatedModuleProxy::requestFlushRegistry() {
-  requestRender_([weakThis = weak_from_this()](const double timestamp) {
-    if (auto strongThis = weakThis.lock()) {
-      strongThis->shouldFlushRegistry_ = true;
-    }
-  });
+  frameDispatcher_->requestPhase(FramePhase::Commit);
+}
+
+void ReanimatedModuleProxy::initializeFramePhases() {
+  frameDispatcher_->setPhaseCallback(
+      FramePhase::FrameCallbacks,
+      [weakThis = weak_from_this()](const double timestampMs) {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->onRender(timestampMs);
+        }
+      });
+  frameDispatcher_->setPhaseCallback(
+      FramePhase::LayoutAnimations,
+      [weakThis = weak_from_this()](const double timestampMs) {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->layoutAnimationsLoopCallback(timestampMs);
+        }
+      });
+  frameDispatcher_->setPhaseCallback(
+      FramePhase::CSS,
+      [weakThis = weak_from_this()](const double timestampMs) {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->cssLoopCallback(timestampMs);
+        }
+      });
+  // The commit phase is requested only to flush the updates registry
+  frameDispatcher_->setPhaseCallback(
+      FramePhase::Commit,
+      [weakThis = weak_from_this()](const double) {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->shouldFlushRegistry_ = true;
+        }
+      });
+}
+
+static jsi::Object framePhaseStatsToJSIObject(
+    jsi::Runtime &rt,
+    const FramePhaseStats &stats) {
+  jsi::Object result(rt);
+  result.setProperty(rt, "runsCount", static_cast<double>(stats.runsCount));
+  result.setProperty(rt, "lastDurationMs", stats.lastDurationMs);
+  result.setProperty(rt, "maxDurationMs", stats.maxDurationMs);
+  result.setProperty(rt, "totalDurationMs", stats.totalDurationMs);
+  return result;
+}
+
+jsi::Value ReanimatedModuleProxy::getFrameStats(jsi::Runtime &rt) {
+  const auto stats = getFrameStats();
+  jsi::Object result(rt);
+  result.setProperty(rt, "framesCount", static_cast<double>(stats.framesCount));
+  result.setProperty(
+      rt,
+      "mergedRequestsCount",
+      static_cast<double>(stats.mergedRequestsCount));
+  result.setProperty(
+      rt,
+      "frameCallbacks",
+      framePhaseStatsToJSIObject(rt, stats.frameCallbacks));
+  result.setProperty(
+      rt,
+      "layoutAnimations",
+      framePhaseStatsToJSIObject(rt, stats.layoutAnimations));
+  result.setProperty(rt, "css", framePhaseStatsToJSIObject(rt, stats.css));
+  result.setProperty(
+      rt, "commit", framePhaseStatsToJSIObject(rt, stats.commit));
+  result.setProperty(
+      rt,
+      "skippedCSSLoopWakeupsCount",
+      static_cast<double>(getSkippedCSSLoopWakeupsCount()));
+  result.setProperty(
+      rt,
+      "skippedExitingAnimationsCount",
+      static_cast<double>(getSkippedExitingAnimationsCount()));
+  return result;
+}
+
+FrameDispatcherStats ReanimatedModuleProxy::getFrameStats() const {
+  return frameDispatcher_->getStats();
 }
 
 void ReanimatedModuleProxy::commitUpdates(
@@ -726,6 +1072,7 @@ void ReanimatedModuleProxy::commitUpdates(
   updatesRegistryManager_->collectPropsToRevertBySurface(propsMapBySurface);
 #endif
 
+  const bool isFlushingRegistry = shouldFlushRegistry_;
   if (shouldFlushRegistry_) {
     shouldFlushRegistry_ = false;
     const auto propsMap = updatesRegistryManager_->collectProps();
@@ -738,8 +1085,8 @@ void ReanimatedModuleProxy::commitUpdates(
     }
   } else {
     for (auto const &[shadowNode, props] : updatesBatch) {
-      SurfaceId surfaceId = shadowNode->getSurfaceId();
-      auto family = &shadowNode->getFamily();
+      SurfaceId surfaceId = shadowNode.getSurfaceId();
+      auto family = &shadowNode.getFamily();
       react_native_assert(family->getSurfaceId() == surfaceId);
       propsMapBySurface[surfaceId][family].emplace_back(std::move(props));
     }
@@ -771,6 +1118,16 @@ void ReanimatedModuleProxy::commitUpdates(
            false,
            /* .mountSynchronously = */ true});
 
+      if (status != ShadowTree::CommitStatus::Succeeded) {
+        // Updates that weren't committed have to be re-applied by the next
+        // React Native commit of the surface
+        auto lock = updatesRegistryManager_->lock();
+        updatesRegistryManager_->markSurfaceAsOutOfSync(surfaceId);
+      } else if (isFlushingRegistry) {
+        auto lock = updatesRegistryManager_->lock();
+        updatesRegistryManager_->markSurfaceAsInSync(surfaceId);
+      }
+
 #ifdef ANDROID
       if (status == ShadowTree::CommitStatus::Succeeded) {
         updatesRegistryManager_->clearPropsToRevert(surfaceId);
@@ -780,6 +1137,13 @@ void ReanimatedModuleProxy::commitUpdates(
   }
 }
 
+void ReanimatedModuleProxy::markSurfacesAsOutOfSync(
+    const UpdatesBatch &updatesBatch) {
+  for (const auto &[shadowNode, _] : updatesBatch) {
+    updatesRegistryManager_->markSurfaceAsOutOfSync(shadowNode.getSurfaceId());
+  }
+}
+
 void ReanimatedModuleProxy::dispatchCommand(
     jsi::Runtime &rt,
     const jsi::Value &shadowNodeValue,
@@ -875,8 +1239,18 @@ void ReanimatedModuleProxy::initializeFabric(
 
     strongThis->requestFlushRegistry();
   };
+  const std::function<void()> onReactNativeMount =
+      [weakThis = weak_from_this()]() {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->requestViewportVisibilityUpdate();
+        }
+      };
   mountHook_ = std::make_shared<ReanimatedMountHook>(
-      uiManager_, updatesRegistryManager_, request);
+      uiManager_,
+      updatesRegistryManager_,
+      layoutAnimationsProxy_,
+      request,
+      onReactNativeMount);
   commitHook_ = std::make_shared<ReanimatedCommitHook>(
       uiManager_, updatesRegistryManager_, layoutAnimationsProxy_);
 }
@@ -896,7 +1270,12 @@ void ReanimatedModuleProxy::initializeLayoutAnimationsProxy() {
         componentDescriptorRegistry,
         scheduler->getContextContainer(),
         workletsModuleProxy_->getUIWorkletRuntime()->getJSIRuntime(),
-        workletsModuleProxy_->getUIScheduler());
+        workletsModuleProxy_->getUIScheduler(),
+        [weakThis = weak_from_this()]() {
+          if (auto strongThis = weakThis.lock()) {
+            strongThis->maybeRunLayoutAnimationsLoop();
+          }
+        });
   }
 }
 
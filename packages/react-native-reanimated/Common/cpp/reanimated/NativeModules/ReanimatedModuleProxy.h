@@ -11,16 +11,22 @@
 #include <reanimated/Fabric/ReanimatedCommitHook.h>
 #include <reanimated/Fabric/ReanimatedCommitShadowNode.h>
 #include <reanimated/Fabric/ReanimatedMountHook.h>
+#include <reanimated/Fabric/ScrollEventPayloadFactory.h>
 #include <reanimated/Fabric/ShadowTreeCloner.h>
 #include <reanimated/Fabric/updates/AnimatedPropsRegistry.h>
 #include <reanimated/Fabric/updates/UpdatesRegistryManager.h>
+#include <reanimated/Fabric/updates/ViewportCuller.h>
 #include <reanimated/LayoutAnimations/LayoutAnimationsManager.h>
 #include <reanimated/LayoutAnimations/LayoutAnimationsProxy.h>
 #include <reanimated/NativeModules/ReanimatedModuleProxySpec.h>
+#include <reanimated/Tools/FrameDispatcher.h>
 #include <reanimated/Tools/PlatformDepMethodsHolder.h>
+#include <reanimated/Tools/RegistryStats.h>
+#include <reanimated/Tools/WakeupTimer.h>
 
 #include <worklets/NativeModules/WorkletsModuleProxy.h>
 #include <worklets/Registries/EventHandlerRegistry.h>
+#include <worklets/Tools/AsyncQueue.h>
 #include <worklets/Tools/JSScheduler.h>
 #include <worklets/Tools/SingleInstanceChecker.h>
 #include <worklets/Tools/UIScheduler.h>
@@ -29,6 +35,8 @@
 #include <react/renderer/uimanager/UIManager.h>
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -40,7 +48,7 @@ namespace reanimated {
 using namespace facebook;
 using namespace css;
 
-using UpdatesBatch = std::vector<std::pair<ShadowNode::Shared, folly::dynamic>>;
+using UpdatesBatch = std::vector<std::pair<ShadowNodeHandle, folly::dynamic>>;
 
 class ReanimatedModuleProxy
     : public ReanimatedModuleProxySpec,
@@ -117,6 +125,11 @@ class ReanimatedModuleProxy
       const jsi::Value &viewTag,
       const jsi::Value &viewStyle) override;
 
+  void setAnimatedPropsUpdateRate(
+      jsi::Runtime &rt,
+      const jsi::Value &viewTag,
+      const jsi::Value &updateRate) override;
+
   void markNodeAsRemovable(
       jsi::Runtime &rt,
       const jsi::Value &shadowNodeWrapper) override;
@@ -147,7 +160,23 @@ class ReanimatedModuleProxy
   void unregisterCSSTransition(jsi::Runtime &rt, const jsi::Value &viewTag)
       override;
 
-  void cssLoopCallback(const double /*timestampMs*/);
+  jsi::Value getRegistriesStats(jsi::Runtime &rt) override;
+  // Entries count and approximate memory retained by every registry. It is
+  // cheap enough to be queried periodically in production (must not be called
+  // with any registry lock held).
+  RegistriesStats getRegistriesStats();
+
+  jsi::Value getFrameStats(jsi::Runtime &rt) override;
+  // Number of requested frames and durations of their phases
+  FrameDispatcherStats getFrameStats() const;
+
+  void cssLoopCallback(const double timestampMs);
+  // Number of frames in which the CSS loop wasn't run, because it was waiting
+  // only for delayed CSS animations and transitions to start
+  uint64_t getSkippedCSSLoopWakeupsCount() const;
+  // Number of exiting animations that weren't started, because their views
+  // were outside of the window (SKIP_OFFSCREEN_EXITING_ANIMATIONS)
+  uint64_t getSkippedExitingAnimationsCount() const;
 
   void dispatchCommand(
       jsi::Runtime &rt,
@@ -207,26 +236,57 @@ class ReanimatedModuleProxy
   std::function<std::string()> createRegistriesLeakCheck();
 
  private:
+  void initializeFramePhases();
+  void flushAndCommitUpdates();
+  // Must be called with the updates registry manager lock held
+  void updateViewportVisibility(UpdatesBatch &updatesBatch);
+  // Called on the UI thread after React Native mounts a tree
+  void requestViewportVisibilityUpdate();
   void commitUpdates(jsi::Runtime &rt, const UpdatesBatch &updatesBatch);
+  // Must be called with the updates registry manager lock held
+  void markSurfacesAsOutOfSync(const UpdatesBatch &updatesBatch);
+  void requestCSSLoopFrame();
+  // Stops the loop (optionally arming the wakeup of delayed items) unless it
+  // was asked to keep running while the current frame was processed
+  void stopCSSLoop(std::optional<double> wakeupDelayMs);
+  // Frame loop of layout animations of native presets (run on the UI thread)
+  void maybeRunLayoutAnimationsLoop();
+  void layoutAnimationsLoopCallback(const double timestampMs);
+  void notifySurfacesAboutUpdates(const std::vector<SurfaceId> &surfaceIds);
 
   const bool isReducedMotion_;
   bool shouldFlushRegistry_ = false;
   std::shared_ptr<WorkletsModuleProxy> workletsModuleProxy_;
 
   std::unique_ptr<EventHandlerRegistry> eventHandlerRegistry_;
-  const RequestRenderFunction requestRender_;
+  // Only used on the UI thread, in `handleRawEvent`
+  ScrollEventPayloadFactory scrollEventPayloadFactory_;
+  const std::shared_ptr<FrameDispatcher> frameDispatcher_;
   std::vector<std::shared_ptr<jsi::Value>> frameCallbacks_;
-  volatile bool renderRequested_{false};
-  std::function<void(const double)> onRenderCallback_;
   AnimatedSensorModule animatedSensorModule_;
   const std::shared_ptr<JSLogger> jsLogger_;
   std::shared_ptr<LayoutAnimationsManager> layoutAnimationsManager_;
   GetAnimationTimestampFunction getAnimationTimestamp_;
 
+  static constexpr size_t CSS_UPDATE_MAX_THREADS_COUNT = 4;
+
+  // Protects the state of the CSS loop, which is started from the JS thread
+  // and stopped from the UI thread
+  mutable std::mutex cssLoopMutex_;
   bool cssLoopRunning_{false};
+  // Set when maybeRunCSSLoop is called while the loop is running, so that
+  // the loop doesn't stop at the end of the frame that is being processed
+  bool cssLoopWakeupRequested_{false};
+  std::optional<double> lastCssLoopTimestampMs_;
+  double cssLoopFrameIntervalMs_{1000.0 / 60};
+  std::optional<WakeupTimer::Clock::time_point> cssLoopIdleSince_;
+  uint64_t skippedCssLoopWakeupsCount_{0};
+  WakeupTimer cssLoopWakeupTimer_;
   bool shouldUpdateCssAnimations_{true};
   double currentCssTimestamp_{0};
 
+  bool layoutAnimationsLoopRunning_{false};
+
   const std::shared_ptr<AnimatedPropsRegistry> animatedPropsRegistry_;
   const std::shared_ptr<StaticPropsRegistry> staticPropsRegistry_;
   const std::shared_ptr<UpdatesRegistryManager> updatesRegistryManager_;
@@ -234,6 +294,11 @@ class ReanimatedModuleProxy
   const std::shared_ptr<CSSAnimationsRegistry> cssAnimationsRegistry_;
   const std::shared_ptr<CSSTransitionsRegistry> cssTransitionsRegistry_;
   const std::shared_ptr<ViewStylesRepository> viewStylesRepository_;
+  // Bakes CSS animation styles, so that they are interpolated live until baked
+  // instead of blocking the UI thread
+  const std::shared_ptr<worklets::AsyncQueue> cssBakingQueue_;
+  // Null unless viewport culling is enabled
+  std::shared_ptr<ViewportCuller> viewportCuller_;
 
   std::shared_ptr<UIManager> uiManager_;
   std::shared_ptr<LayoutAnimationsProxy> layoutAnimationsProxy_;
@@ -121,6 +121,17 @@ static jsi::Value REANIMATED_SPEC_PREFIX(setViewStyle)(
   return jsi::Value::undefined();
 }
 
+static jsi::Value REANIMATED_SPEC_PREFIX(setAnimatedPropsUpdateRate)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<ReanimatedModuleProxySpec *>(&turboModule)
+      ->setAnimatedPropsUpdateRate(
+          rt, std::move(args[0]), std::move(args[1]));
+  return jsi::Value::undefined();
+}
+
 static jsi::Value REANIMATED_SPEC_PREFIX(markNodeAsRemovable)(
     jsi::Runtime &rt,
     TurboModule &turboModule,
@@ -211,6 +222,24 @@ static jsi::Value REANIMATED_SPEC_PREFIX(unregisterCSSTransition)(
   return jsi::Value::undefined();
 }
 
+static jsi::Value REANIMATED_SPEC_PREFIX(getRegistriesStats)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  return static_cast<ReanimatedModuleProxySpec *>(&turboModule)
+      ->getRegistriesStats(rt);
+}
+
+static jsi::Value REANIMATED_SPEC_PREFIX(getFrameStats)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  return static_cast<ReanimatedModuleProxySpec *>(&turboModule)
+      ->getFrameStats(rt);
+}
+
 ReanimatedModuleProxySpec::ReanimatedModuleProxySpec(
     const std::shared_ptr<CallInvoker> &jsInvoker)
     : TurboModule("NativeReanimated", jsInvoker) {
@@ -239,6 +268,8 @@ ReanimatedModuleProxySpec::ReanimatedModuleProxySpec(
 
   methodMap_["setViewStyle"] =
       MethodMetadata{2, REANIMATED_SPEC_PREFIX(setViewStyle)};
+  methodMap_["setAnimatedPropsUpdateRate"] =
+      MethodMetadata{2, REANIMATED_SPEC_PREFIX(setAnimatedPropsUpdateRate)};
 
   methodMap_["markNodeAsRemovable"] =
       MethodMetadata{1, REANIMATED_SPEC_PREFIX(markNodeAsRemovable)};
@@ -261,6 +292,11 @@ ReanimatedModuleProxySpec::ReanimatedModuleProxySpec(
       MethodMetadata{2, REANIMATED_SPEC_PREFIX(updateCSSTransition)};
   methodMap_["unregisterCSSTransition"] =
       MethodMetadata{1, REANIMATED_SPEC_PREFIX(unregisterCSSTransition)};
+
+  methodMap_["getRegistriesStats"] =
+      MethodMetadata{0, REANIMATED_SPEC_PREFIX(getRegistriesStats)};
+  methodMap_["getFrameStats"] =
+      MethodMetadata{0, REANIMATED_SPEC_PREFIX(getFrameStats)};
 }
 
 } // namespace reanimated
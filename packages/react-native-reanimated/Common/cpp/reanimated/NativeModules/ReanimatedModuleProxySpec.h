@@ -78,6 +78,12 @@ class JSI_EXPORT ReanimatedModuleProxySpec : public TurboModule {
       const jsi::Value &viewTag,
       const jsi::Value &viewStyle) = 0;
 
+  // Animated props
+  virtual void setAnimatedPropsUpdateRate(
+      jsi::Runtime &rt,
+      const jsi::Value &viewTag,
+      const jsi::Value &updateRate) = 0;
+
   // Cleanup
   virtual void markNodeAsRemovable(
       jsi::Runtime &rt,
@@ -114,6 +120,10 @@ class JSI_EXPORT ReanimatedModuleProxySpec : public TurboModule {
   virtual void unregisterCSSTransition(
       jsi::Runtime &rt,
       const jsi::Value &viewTag) = 0;
+
+  // Introspection
+  virtual jsi::Value getRegistriesStats(jsi::Runtime &rt) = 0;
+  virtual jsi::Value getFrameStats(jsi::Runtime &rt) = 0;
 };
 
 } // namespace reanimated
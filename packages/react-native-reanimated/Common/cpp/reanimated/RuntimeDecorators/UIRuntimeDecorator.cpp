@@ -15,7 +15,8 @@ void UIRuntimeDecorator::decorate(
     const SetGestureStateFunction setGestureState,
     const ProgressLayoutAnimationFunction progressLayoutAnimation,
     const EndLayoutAnimationFunction endLayoutAnimation,
-    const MaybeFlushUIUpdatesQueueFunction maybeFlushUIUpdatesQueue) {
+    const MaybeFlushUIUpdatesQueueFunction maybeFlushUIUpdatesQueue,
+    const bool isReducedMotion) {
   jsi_utils::installJsiFunction(uiRuntime, "_updateProps", updateProps);
   jsi_utils::installJsiFunction(uiRuntime, "_dispatchCommand", dispatchCommand);
   jsi_utils::installJsiFunction(uiRuntime, "_measure", measure);
@@ -47,6 +48,11 @@ void UIRuntimeDecorator::decorate(
               jsi_utils::createHostFunction(maybeFlushUIUpdatesQueue)));
 
   jsi_utils::installJsiFunction(uiRuntime, "_obtainProp", obtainPropFunction);
+
+  // Updated by ReducedMotionManager and read by native layout animations when
+  // they start
+  uiRuntime.global().setProperty(
+      uiRuntime, "_REANIMATED_IS_REDUCED_MOTION", isReducedMotion);
 }
 
 } // namespace reanimated
@@ -20,7 +20,8 @@ class UIRuntimeDecorator {
       const SetGestureStateFunction setGestureState,
       const ProgressLayoutAnimationFunction progressLayoutAnimation,
       const EndLayoutAnimationFunction endLayoutAnimation,
-      const MaybeFlushUIUpdatesQueueFunction maybeFlushUIUpdatesQueue);
+      const MaybeFlushUIUpdatesQueueFunction maybeFlushUIUpdatesQueue,
+      const bool isReducedMotion);
 };
 
 } // namespace reanimated
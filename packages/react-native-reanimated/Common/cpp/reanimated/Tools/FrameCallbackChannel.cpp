@@ -0,0 +1,64 @@
+#include <reanimated/Tools/FrameCallbackChannel.h>
+
+#include <utility>
+
+namespace reanimated {
+
+FrameCallbackChannel::FrameCallbackChannel(
+    RequestPlatformFrameFunction requestPlatformFrame)
+    : requestPlatformFrame_(std::move(requestPlatformFrame)) {}
+
+FrameCallbackChannel::~FrameCallbackChannel() {
+  deleteCallbacks(pendingCallbacks_.exchange(nullptr));
+}
+
+void FrameCallbackChannel::requestFrame(FrameCallback &&callback) {
+  auto pendingCallback = new PendingCallback{
+      .callback = std::move(callback),
+      .next = pendingCallbacks_.load(std::memory_order_relaxed)};
+  while (!pendingCallbacks_.compare_exchange_weak(
+      pendingCallback->next,
+      pendingCallback,
+      std::memory_order_release,
+      std::memory_order_relaxed)) {
+  }
+
+  // Only the request that makes the channel non-empty asks for a frame, the
+  // other ones are run in the same frame
+  if (!pendingCallback->next) {
+    requestPlatformFrame_();
+  }
+}
+
+void FrameCallbackChannel::onFrame(const double timestampMs) {
+  // Taking the whole stack at once lets callbacks requested from now on
+  // request the next frame
+  auto head = pendingCallbacks_.exchange(nullptr, std::memory_order_acquire);
+
+  // The stack holds callbacks from the most recent one, so it's reversed to
+  // run them in the order of requests
+  PendingCallback *reversed = nullptr;
+  while (head) {
+    auto next = head->next;
+    head->next = reversed;
+    reversed = head;
+    head = next;
+  }
+
+  while (reversed) {
+    auto next = reversed->next;
+    reversed->callback(timestampMs);
+    delete reversed;
+    reversed = next;
+  }
+}
+
+void FrameCallbackChannel::deleteCallbacks(PendingCallback *head) {
+  while (head) {
+    auto next = head->next;
+    delete head;
+    head = next;
+  }
+}
+
+} // namespace reanimated
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+namespace reanimated {
+
+// Multiplexes frame callbacks onto a single persistent platform frame
+// callback. The platform is asked for a frame only when the first callback
+// is requested after the previous frame, and it calls onFrame, which runs
+// all callbacks requested before it in the order of requests. Callbacks
+// requested while the frame is being run are run in the next frame.
+// Callbacks are kept in a lock-free stack, so they can be requested from
+// any thread, as long as the platform frame request can be made from it too
+// (the Android one posts itself to the UI thread). onFrame must be called
+// from a single thread at a time. The class doesn't depend on any platform,
+// so it can be driven by a fake frame source (see the host tests).
+class FrameCallbackChannel {
+ public:
+  using FrameCallback = std::function<void(double)>;
+  using RequestPlatformFrameFunction = std::function<void()>;
+
+  explicit FrameCallbackChannel(
+      RequestPlatformFrameFunction requestPlatformFrame);
+  ~FrameCallbackChannel();
+
+  FrameCallbackChannel(const FrameCallbackChannel &) = delete;
+  FrameCallbackChannel &operator=(const FrameCallbackChannel &) = delete;
+
+  void requestFrame(FrameCallback &&callback);
+  void onFrame(double timestampMs);
+
+ private:
+  struct PendingCallback {
+    FrameCallback callback;
+    PendingCallback *next;
+  };
+
+  const RequestPlatformFrameFunction requestPlatformFrame_;
+  // The most recently requested callback
+  std::atomic<PendingCallback *> pendingCallbacks_{nullptr};
+
+  static void deleteCallbacks(PendingCallback *head);
+};
+
+} // namespace reanimated
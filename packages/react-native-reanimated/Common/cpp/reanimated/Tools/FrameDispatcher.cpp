@@ -0,0 +1,143 @@
+#include <reanimated/Tools/FrameDispatcher.h>
+#include <reanimated/Tools/ReanimatedSystraceSection.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+namespace reanimated {
+
+namespace {
+
+double measureMs(const std::function<void()> &fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  const std::chrono::duration<double, std::milli> duration =
+      std::chrono::steady_clock::now() - start;
+  return duration.count();
+}
+
+} // namespace
+
+FrameDispatcher::FrameDispatcher(RequestRenderFunction requestRender)
+    : requestRender_(std::move(requestRender)) {}
+
+void FrameDispatcher::setPhaseCallback(
+    const FramePhase phase,
+    PhaseCallback &&callback) {
+  phaseCallbacks_[static_cast<size_t>(phase)] = std::move(callback);
+}
+
+void FrameDispatcher::requestPhase(const FramePhase phase) {
+  assertUIThread();
+  requestedPhases_[static_cast<size_t>(phase)] = true;
+  requestFrame();
+}
+
+void FrameDispatcher::requestFrame() {
+  assertUIThread();
+  if (frameRequested_) {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.mergedRequestsCount++;
+    return;
+  }
+
+  frameRequested_ = true;
+  {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats_.framesCount++;
+  }
+
+  requestRender_([weakThis = weak_from_this()](const double timestampMs) {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->onFrame(timestampMs);
+    }
+  });
+}
+
+void FrameDispatcher::runCommit(const std::function<void()> &commit) {
+  assertUIThread();
+  if (!awaitingCommit_) {
+    commit();
+    return;
+  }
+
+  awaitingCommit_ = false;
+  const auto durationMs = commitPhaseDurationMs_ + measureMs(commit);
+  commitPhaseDurationMs_ = 0;
+  recordPhase(FramePhase::Commit, durationMs);
+}
+
+FrameDispatcherStats FrameDispatcher::getStats() const {
+  std::lock_guard<std::mutex> lock(statsMutex_);
+  return stats_;
+}
+
+void FrameDispatcher::onFrame(const double timestampMs) {
+  ReanimatedSystraceSection s("FrameDispatcher::onFrame");
+  assertUIThread();
+
+  // Phases requested from now on are run in the next frame
+  const auto phases = requestedPhases_;
+  requestedPhases_.fill(false);
+  frameRequested_ = false;
+  // The platform calls performOperations right after the frame callbacks
+  awaitingCommit_ = true;
+
+  for (size_t i = 0; i < FRAME_PHASES_COUNT; ++i) {
+    const auto &callback = phaseCallbacks_[i];
+    if (!phases[i] || !callback) {
+      continue;
+    }
+
+    const auto durationMs = measureMs([&]() { callback(timestampMs); });
+    // The commit phase is recorded together with the commit in runCommit
+    if (static_cast<FramePhase>(i) == FramePhase::Commit) {
+      commitPhaseDurationMs_ = durationMs;
+    } else {
+      recordPhase(static_cast<FramePhase>(i), durationMs);
+    }
+  }
+}
+
+void FrameDispatcher::recordPhase(
+    const FramePhase phase,
+    const double durationMs) {
+  std::lock_guard<std::mutex> lock(statsMutex_);
+
+  FramePhaseStats *phaseStats = nullptr;
+  switch (phase) {
+    case FramePhase::FrameCallbacks:
+      phaseStats = &stats_.frameCallbacks;
+      break;
+    case FramePhase::LayoutAnimations:
+      phaseStats = &stats_.layoutAnimations;
+      break;
+    case FramePhase::CSS:
+      phaseStats = &stats_.css;
+      break;
+    case FramePhase::Commit:
+      phaseStats = &stats_.commit;
+      break;
+  }
+
+  phaseStats->runsCount++;
+  phaseStats->lastDurationMs = durationMs;
+  phaseStats->maxDurationMs = std::max(phaseStats->maxDurationMs, durationMs);
+  phaseStats->totalDurationMs += durationMs;
+}
+
+void FrameDispatcher::assertUIThread() {
+#ifndef NDEBUG
+  const auto threadId = std::this_thread::get_id();
+  if (uiThreadId_ == std::thread::id()) {
+    uiThreadId_ = threadId;
+  }
+  assert(
+      uiThreadId_ == threadId &&
+      "[Reanimated] FrameDispatcher must be used on the UI thread");
+#endif // NDEBUG
+}
+
+} // namespace reanimated
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace reanimated {
+
+// Phases of a frame in the order in which they are run. Events are not a
+// phase of the dispatcher - they are delivered by the platform before the
+// frame callbacks (and handled as soon as they arrive).
+enum class FramePhase : uint8_t {
+  // Frame callbacks registered from the UI runtime
+  FrameCallbacks,
+  // Layout animations of native presets
+  LayoutAnimations,
+  // CSS animations and transitions (they are updated in the commit, this
+  // phase decides whether the CSS loop should keep running)
+  CSS,
+  // Work that has to be done right before the commit (e.g. flushing the
+  // updates registry). The commit itself is performOperations, which the
+  // platform runs once after the frame callbacks.
+  Commit,
+};
+
+constexpr size_t FRAME_PHASES_COUNT = 4;
+
+struct FramePhaseStats {
+  uint64_t runsCount = 0;
+  double lastDurationMs = 0;
+  double maxDurationMs = 0;
+  double totalDurationMs = 0;
+};
+
+struct FrameDispatcherStats {
+  // Frames requested from the platform
+  uint64_t framesCount = 0;
+  // Requests that were merged into an already requested frame
+  uint64_t mergedRequestsCount = 0;
+  FramePhaseStats frameCallbacks;
+  FramePhaseStats layoutAnimations;
+  FramePhaseStats css;
+  FramePhaseStats commit;
+};
+
+// Registers at most one platform frame callback per vsync and runs all
+// phases requested for this frame in a fixed order. Phases requested while
+// the frame is being run (e.g. loops requesting their next frame) are run in
+// the next frame. Must be used on the UI thread, except for getStats and
+// setPhaseCallback (phase callbacks must be set before the first request).
+// Debug builds assert that all requests, frames and commits come from the
+// same thread. The class doesn't depend on any platform, so it can be driven
+// by a fake requestRender (see the host tests).
+class FrameDispatcher : public std::enable_shared_from_this<FrameDispatcher> {
+ public:
+  using PhaseCallback = std::function<void(const double)>;
+  // The same as the requestRender function of the platform
+  using RequestRenderFunction =
+      std::function<void(std::function<void(const double)>)>;
+
+  explicit FrameDispatcher(RequestRenderFunction requestRender);
+
+  void setPhaseCallback(FramePhase phase, PhaseCallback &&callback);
+  void requestPhase(FramePhase phase);
+  // Requests a frame without running any phase, only to make sure that
+  // performOperations is called in the next frame
+  void requestFrame();
+
+  // Runs the commit and accounts its duration to the commit phase of the
+  // last frame. Commits outside of frames (e.g. after events) are not
+  // measured.
+  void runCommit(const std::function<void()> &commit);
+
+  FrameDispatcherStats getStats() const;
+
+ private:
+  const RequestRenderFunction requestRender_;
+  std::array<PhaseCallback, FRAME_PHASES_COUNT> phaseCallbacks_;
+  std::array<bool, FRAME_PHASES_COUNT> requestedPhases_{};
+  bool frameRequested_ = false;
+  bool awaitingCommit_ = false;
+  double commitPhaseDurationMs_ = 0;
+
+  mutable std::mutex statsMutex_;
+  FrameDispatcherStats stats_;
+
+#ifndef NDEBUG
+  // The thread of the first request (the UI thread)
+  std::thread::id uiThreadId_;
+#endif // NDEBUG
+
+  void onFrame(double timestampMs);
+  void recordPhase(FramePhase phase, double durationMs);
+  void assertUIThread();
+};
+
+} // namespace reanimated
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace reanimated {
+
+// Calls `callback(key, begin, end)` for every range of entries with the same
+// key, in the ascending order of keys. Entries are stable-sorted, so values
+// with the same key stay in the order in which they were added. Meant for
+// entries that are grouped only once, for which a hash map of vectors would
+// allocate a vector per key.
+template <typename TKey, typename TValue, typename TCallback>
+void forEachGroupByKey(
+    std::vector<std::pair<TKey, TValue>> &entries,
+    TCallback &&callback) {
+  const auto compareKeys = [](const auto &lhs, const auto &rhs) {
+    return lhs.first < rhs.first;
+  };
+  // Entries often come sorted already (e.g. when all of them have the same
+  // key), in which case the sort and its buffer allocation are skipped
+  if (!std::is_sorted(entries.begin(), entries.end(), compareKeys)) {
+    std::stable_sort(entries.begin(), entries.end(), compareKeys);
+  }
+
+  for (auto groupBegin = entries.begin(); groupBegin != entries.end();) {
+    const auto key = groupBegin->first;
+    const auto groupEnd =
+        std::find_if(groupBegin, entries.end(), [&key](const auto &entry) {
+          return entry.first != key;
+        });
+    callback(key, groupBegin, groupEnd);
+    groupBegin = groupEnd;
+  }
+}
+
+} // namespace reanimated
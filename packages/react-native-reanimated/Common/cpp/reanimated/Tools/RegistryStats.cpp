@@ -0,0 +1,44 @@
+#include <reanimated/Tools/RegistryStats.h>
+
+namespace reanimated {
+
+jsi::Object RegistryStats::toJSIObject(jsi::Runtime &rt) const {
+  jsi::Object result(rt);
+  result.setProperty(rt, "entriesCount", static_cast<double>(entriesCount));
+  result.setProperty(rt, "retainedBytes", static_cast<double>(retainedBytes));
+  result.setProperty(rt, "runningCount", static_cast<double>(runningCount));
+  result.setProperty(rt, "delayedCount", static_cast<double>(delayedCount));
+  return result;
+}
+
+jsi::Object RegistriesStats::toJSIObject(jsi::Runtime &rt) const {
+  jsi::Object result(rt);
+  result.setProperty(rt, "animatedProps", animatedProps.toJSIObject(rt));
+  result.setProperty(rt, "cssAnimations", cssAnimations.toJSIObject(rt));
+  result.setProperty(rt, "cssTransitions", cssTransitions.toJSIObject(rt));
+  result.setProperty(rt, "staticProps", staticProps.toJSIObject(rt));
+  result.setProperty(rt, "cssKeyframes", cssKeyframes.toJSIObject(rt));
+  result.setProperty(rt, "layoutAnimations", layoutAnimations.toJSIObject(rt));
+  result.setProperty(rt, "eventHandlers", eventHandlers.toJSIObject(rt));
+  return result;
+}
+
+size_t getRetainedBytes(const folly::dynamic &value) {
+  size_t bytes = sizeof(folly::dynamic);
+
+  if (value.isString()) {
+    bytes += value.getString().capacity();
+  } else if (value.isArray()) {
+    for (const auto &item : value) {
+      bytes += getRetainedBytes(item);
+    }
+  } else if (value.isObject()) {
+    for (const auto &[key, item] : value.items()) {
+      bytes += getRetainedBytes(key) + getRetainedBytes(item);
+    }
+  }
+
+  return bytes;
+}
+
+} // namespace reanimated
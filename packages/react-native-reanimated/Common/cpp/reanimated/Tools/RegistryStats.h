@@ -0,0 +1,43 @@
+#pragma once
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace reanimated {
+
+using namespace facebook;
+
+struct RegistryStats {
+  size_t entriesCount = 0;
+  // Approximate number of bytes retained by the registry. Objects shared with
+  // other owners (e.g. shadow nodes of views, keyframes interpolators used by
+  // animations) are counted only in their owning registry.
+  size_t retainedBytes = 0;
+  // Items updated in every frame (e.g. running animations)
+  size_t runningCount = 0;
+  // Items waiting for their delay to pass
+  size_t delayedCount = 0;
+
+  jsi::Object toJSIObject(jsi::Runtime &rt) const;
+};
+
+struct RegistriesStats {
+  RegistryStats animatedProps;
+  RegistryStats cssAnimations;
+  RegistryStats cssTransitions;
+  RegistryStats staticProps;
+  RegistryStats cssKeyframes;
+  RegistryStats layoutAnimations;
+  RegistryStats eventHandlers;
+
+  jsi::Object toJSIObject(jsi::Runtime &rt) const;
+};
+
+// Approximate number of bytes retained by the value, including the value
+// itself
+size_t getRetainedBytes(const folly::dynamic &value);
+
+} // namespace reanimated
@@ -0,0 +1,81 @@
+#include <reanimated/Tools/WakeupTimer.h>
+
+#include <utility>
+
+namespace reanimated {
+
+WakeupTimer::~WakeupTimer() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_one();
+
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void WakeupTimer::arm(
+    const Clock::time_point deadline,
+    Callback &&callback) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    deadline_ = deadline;
+    callback_ = std::move(callback);
+    if (!thread_.joinable()) {
+      thread_ = std::thread([this]() { timerLoop(); });
+    }
+  }
+  condition_.notify_one();
+}
+
+bool WakeupTimer::cancel() {
+  bool wasArmed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wasArmed = deadline_.has_value();
+    deadline_.reset();
+    callback_ = nullptr;
+  }
+  condition_.notify_one();
+  return wasArmed;
+}
+
+bool WakeupTimer::isArmed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return deadline_.has_value();
+}
+
+void WakeupTimer::timerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (!stopping_) {
+    if (!deadline_.has_value()) {
+      condition_.wait(lock);
+      continue;
+    }
+
+    // The deadline may be changed (or the wakeup cancelled) while waiting,
+    // so it is checked again after every wakeup of the condition variable
+    const auto deadline = deadline_.value();
+    if (condition_.wait_until(lock, deadline) != std::cv_status::timeout ||
+        deadline_ != deadline) {
+      continue;
+    }
+
+    auto callback = std::move(callback_);
+    callback_ = nullptr;
+    deadline_.reset();
+
+    // Run the callback without holding the lock, so that it can arm the timer
+    // again
+    lock.unlock();
+    if (callback) {
+      callback();
+    }
+    lock.lock();
+  }
+}
+
+} // namespace reanimated
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace reanimated {
+
+// One-shot timer running the callback on its own thread once the deadline
+// passes. Only one wakeup can be armed at a time - arming the timer again
+// replaces the previous wakeup. The thread is started on the first arm().
+class WakeupTimer {
+ public:
+  using Clock = std::chrono::steady_clock;
+  using Callback = std::function<void()>;
+
+  WakeupTimer() = default;
+  ~WakeupTimer();
+
+  WakeupTimer(const WakeupTimer &) = delete;
+  WakeupTimer &operator=(const WakeupTimer &) = delete;
+
+  void arm(Clock::time_point deadline, Callback &&callback);
+  // Returns true if there was an armed wakeup that hasn't fired yet
+  bool cancel();
+  bool isArmed() const;
+
+ private:
+  std::thread thread_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+
+  std::optional<Clock::time_point> deadline_;
+  Callback callback_;
+  bool stopping_ = false;
+
+  void timerLoop();
+};
+
+} // namespace reanimated
@@ -0,0 +1,131 @@
+#include <reanimated/Tools/WorkerPool.h>
+
+#include <algorithm>
+
+namespace reanimated {
+
+WorkerPool::WorkerPool(const size_t threadsCount) {
+  const auto workersCount = std::max<size_t>(threadsCount, 1) - 1;
+  threads_.reserve(workersCount);
+  for (size_t i = 0; i < workersCount; ++i) {
+    threads_.emplace_back([this]() { workerLoop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  workAvailable_.notify_all();
+
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t WorkerPool::getThreadsCount() const {
+  return threads_.size() + 1;
+}
+
+void WorkerPool::run(const size_t tasksCount, const Task &task) {
+  if (tasksCount == 0) {
+    return;
+  }
+
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    tasksCount_ = tasksCount;
+    nextTaskIndex_ = 0;
+    pendingTasksCount_ = tasksCount;
+    exception_ = nullptr;
+    generation = ++generation_;
+  }
+  workAvailable_.notify_all();
+
+  runTasks(generation);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    workFinished_.wait(lock, [this]() { return pendingTasksCount_ == 0; });
+    task_ = nullptr;
+    exception = std::move(exception_);
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void WorkerPool::runInChunks(const size_t itemsCount, const ChunkTask &task) {
+  const auto chunksCount = getChunksCount(itemsCount);
+  if (chunksCount == 0) {
+    return;
+  }
+
+  const auto chunkSize = (itemsCount + chunksCount - 1) / chunksCount;
+  run(chunksCount, [&](const size_t chunkIndex) {
+    const auto begin = std::min(chunkIndex * chunkSize, itemsCount);
+    const auto end = std::min(begin + chunkSize, itemsCount);
+    task(chunkIndex, begin, end);
+  });
+}
+
+size_t WorkerPool::getChunksCount(const size_t itemsCount) const {
+  return std::min(getThreadsCount(), itemsCount);
+}
+
+void WorkerPool::workerLoop() {
+  uint64_t lastGeneration = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      workAvailable_.wait(lock, [&]() {
+        return stopping_ || generation_ != lastGeneration;
+      });
+      if (stopping_) {
+        return;
+      }
+      lastGeneration = generation_;
+    }
+
+    runTasks(lastGeneration);
+  }
+}
+
+void WorkerPool::runTasks(const uint64_t generation) {
+  while (true) {
+    const Task *task;
+    size_t taskIndex;
+    {
+      // Tasks are claimed under the lock, so a thread that woke up late can
+      // never pick up a task of the next run() call
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (generation != generation_ || nextTaskIndex_ >= tasksCount_) {
+        return;
+      }
+      task = task_;
+      taskIndex = nextTaskIndex_++;
+    }
+
+    try {
+      (*task)(taskIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) {
+        exception_ = std::current_exception();
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--pendingTasksCount_ == 0) {
+      workFinished_.notify_all();
+    }
+  }
+}
+
+} // namespace reanimated
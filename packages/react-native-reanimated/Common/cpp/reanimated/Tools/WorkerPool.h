@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace reanimated {
+
+// Fixed pool of threads running data-parallel tasks. The thread that calls
+// run() also executes tasks, so a pool of size N spawns only N - 1 threads.
+class WorkerPool {
+ public:
+  using Task = std::function<void(size_t taskIndex)>;
+  using ChunkTask =
+      std::function<void(size_t chunkIndex, size_t begin, size_t end)>;
+
+  explicit WorkerPool(size_t threadsCount);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  size_t getThreadsCount() const;
+
+  // Runs task(i) for every i in [0, tasksCount) and blocks until all of them
+  // finish. The first exception thrown by any of the tasks is re-thrown.
+  // Must not be called concurrently from multiple threads.
+  void run(size_t tasksCount, const Task &task);
+
+  // Splits items [0, itemsCount) into getChunksCount(itemsCount) contiguous
+  // ranges and runs task(chunkIndex, begin, end) for each of them
+  void runInChunks(size_t itemsCount, const ChunkTask &task);
+  size_t getChunksCount(size_t itemsCount) const;
+
+ private:
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable workAvailable_;
+  std::condition_variable workFinished_;
+
+  const Task *task_ = nullptr;
+  size_t tasksCount_ = 0;
+  size_t nextTaskIndex_ = 0;
+  size_t pendingTasksCount_ = 0;
+  uint64_t generation_ = 0;
+  bool stopping_ = false;
+  std::exception_ptr exception_;
+
+  void workerLoop();
+  void runTasks(uint64_t generation);
+};
+
+} // namespace reanimated
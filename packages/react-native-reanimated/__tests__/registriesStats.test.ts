@@ -0,0 +1,63 @@
+import { getRegistriesStats } from '../src';
+import { ReanimatedError } from '../src/common';
+import type { RegistriesStats } from '../src/ReanimatedModule';
+import { ReanimatedModule } from '../src/ReanimatedModule';
+import { createJSReanimatedModule } from '../src/ReanimatedModule/js-reanimated';
+
+const REGISTRY_NAMES: (keyof RegistriesStats)[] = [
+  'animatedProps',
+  'cssAnimations',
+  'cssTransitions',
+  'staticProps',
+  'cssKeyframes',
+  'layoutAnimations',
+  'eventHandlers',
+];
+
+function createStats(): RegistriesStats {
+  return Object.fromEntries(
+    REGISTRY_NAMES.map((name, index) => [
+      name,
+      {
+        entriesCount: index,
+        retainedBytes: 64 * index,
+        runningCount: 0,
+        delayedCount: 0,
+      },
+    ])
+  ) as unknown as RegistriesStats;
+}
+
+describe(getRegistriesStats, () => {
+  afterEach(() => {
+    jest.restoreAllMocks();
+  });
+
+  it('returns stats reported by the module', () => {
+    const stats = createStats();
+    jest.spyOn(ReanimatedModule, 'getRegistriesStats').mockReturnValue(stats);
+
+    expect(getRegistriesStats()).toBe(stats);
+    expect(ReanimatedModule.getRegistriesStats).toHaveBeenCalledTimes(1);
+  });
+
+  it('reads the stats again on every call', () => {
+    const spy = jest
+      .spyOn(ReanimatedModule, 'getRegistriesStats')
+      .mockReturnValueOnce(createStats())
+      .mockReturnValueOnce(createStats());
+
+    getRegistriesStats();
+    getRegistriesStats();
+
+    expect(spy).toHaveBeenCalledTimes(2);
+  });
+
+  it('is not available in JSReanimated', () => {
+    expect(() => createJSReanimatedModule().getRegistriesStats()).toThrow(
+      new ReanimatedError(
+        '`getRegistriesStats` is not available in JSReanimated.'
+      )
+    );
+  });
+});
@@ -1,37 +0,0 @@
-#pragma once
-
-#include <fbjni/fbjni.h>
-
-#include <utility>
-
-namespace reanimated {
-
-using namespace facebook;
-using namespace facebook::jni;
-
-class AnimationFrameCallback : public HybridClass<AnimationFrameCallback> {
- public:
-  static auto constexpr kJavaDescriptor =
-      "Lcom/swmansion/reanimated/nativeProxy/AnimationFrameCallback;";
-
-  void onAnimationFrame(double timestampMs) {
-    callback_(timestampMs);
-  }
-
-  static void registerNatives() {
-    javaClassStatic()->registerNatives({
-        makeNativeMethod(
-            "onAnimationFrame", AnimationFrameCallback::onAnimationFrame),
-    });
-  }
-
- private:
-  friend HybridBase;
-
-  explicit AnimationFrameCallback(std::function<void(double)> callback)
-      : callback_(std::move(callback)) {}
-
-  std::function<void(double)> callback_;
-};
-
-} // namespace reanimated
@@ -1,7 +1,6 @@
 #include <reanimated/RuntimeDecorators/RNRuntimeDecorator.h>
 #include <reanimated/Tools/PlatformDepMethodsHolder.h>
 #include <reanimated/Tools/ReanimatedVersion.h>
-#include <reanimated/android/AnimationFrameCallback.h>
 #include <reanimated/android/EventHandler.h>
 #include <reanimated/android/KeyboardWorkletWrapper.h>
 #include <reanimated/android/NativeProxy.h>
@@ -23,6 +22,7 @@ NativeProxy::NativeProxy(
         fabricUIManager)
     : javaPart_(jni::make_global(jThis)),
       rnRuntime_(rnRuntime),
+      frameCallbackChannel_(bindThis(&NativeProxy::requestPlatformFrame)),
       workletsModuleProxy_(workletsModuleProxy),
       reanimatedModuleProxy_(std::make_shared<ReanimatedModuleProxy>(
           workletsModuleProxy,
@@ -144,15 +144,21 @@ void NativeProxy::registerNatives() {
            "isAnyHandlerWaitingForEvent",
            NativeProxy::isAnyHandlerWaitingForEvent),
        makeNativeMethod("performOperations", NativeProxy::performOperations),
+       makeNativeMethod("onFrame", NativeProxy::onFrame),
        makeNativeMethod("invalidateCpp", NativeProxy::invalidateCpp)});
 }
 
 void NativeProxy::requestRender(std::function<void(double)> onRender) {
-  static const auto method =
-      getJniMethod<void(AnimationFrameCallback::javaobject)>("requestRender");
-  method(
-      javaPart_.get(),
-      AnimationFrameCallback::newObjectCxxArgs(std::move(onRender)).get());
+  frameCallbackChannel_.requestFrame(std::move(onRender));
+}
+
+void NativeProxy::requestPlatformFrame() {
+  static const auto method = getJniMethod<void()>("requestFrame");
+  method(javaPart_.get());
+}
+
+void NativeProxy::onFrame(const jdouble timestampMs) {
+  frameCallbackChannel_.onFrame(timestampMs);
 }
 
 void NativeProxy::registerEventHandler() {
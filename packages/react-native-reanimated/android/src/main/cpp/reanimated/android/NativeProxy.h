@@ -1,6 +1,7 @@
 #pragma once
 
 #include <reanimated/NativeModules/ReanimatedModuleProxy.h>
+#include <reanimated/Tools/FrameCallbackChannel.h>
 
 #include <worklets/android/WorkletsModule.h>
 
@@ -42,6 +43,8 @@ class NativeProxy : public jni::HybridClass<NativeProxy>,
   friend HybridBase;
   jni::global_ref<NativeProxy::javaobject> javaPart_;
   jsi::Runtime *rnRuntime_;
+  // Declared before the module proxy, which may request frames when created
+  FrameCallbackChannel frameCallbackChannel_;
   std::shared_ptr<WorkletsModuleProxy> workletsModuleProxy_;
   std::shared_ptr<ReanimatedModuleProxy> reanimatedModuleProxy_;
 #ifndef NDEBUG
@@ -61,6 +64,8 @@ class NativeProxy : public jni::HybridClass<NativeProxy>,
   void performOperations();
   bool getIsReducedMotion();
   void requestRender(std::function<void(double)> onRender);
+  void requestPlatformFrame();
+  void onFrame(jdouble timestampMs);
   void registerEventHandler();
   void maybeFlushUIUpdatesQueue();
   void setGestureState(int handlerTag, int newState);
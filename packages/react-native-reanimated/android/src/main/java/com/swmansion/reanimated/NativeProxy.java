@@ -18,7 +18,6 @@ import com.facebook.soloader.SoLoader;
 import com.swmansion.common.GestureHandlerStateManager;
 import com.swmansion.reanimated.keyboard.KeyboardAnimationManager;
 import com.swmansion.reanimated.keyboard.KeyboardWorkletWrapper;
-import com.swmansion.reanimated.nativeProxy.AnimationFrameCallback;
 import com.swmansion.reanimated.nativeProxy.EventHandler;
 import com.swmansion.reanimated.nativeProxy.SensorSetter;
 import com.swmansion.reanimated.sensor.ReanimatedSensorContainer;
@@ -107,6 +106,8 @@ public class NativeProxy {
 
   public native void performOperations();
 
+  private native void onFrame(double timestampMs);
+
   protected native void installJSIBindings();
 
   private native void invalidateCpp();
@@ -138,10 +139,25 @@ public class NativeProxy {
     DevMenuUtils.addDevMenuOption(mContext.get(), this::toggleSlowAnimations);
   }
 
+  /**
+   * Frame callbacks requested from C++ are kept there and run by a single `onFrame` call, so the
+   * same callback object is posted for every frame.
+   */
+  private final NodesManager.OnAnimationFrame mFrameCallback =
+      timestampMs -> {
+        if (!mInvalidated.get()) {
+          onFrame(timestampMs);
+        }
+      };
+
   @DoNotStrip
-  public void requestRender(AnimationFrameCallback callback) {
-    UiThreadUtil.assertOnUiThread();
-    mNodesManager.postOnAnimation(callback);
+  public void requestFrame() {
+    // NodesManager keeps frame callbacks in a list that is only accessed on the UI thread
+    if (UiThreadUtil.isOnUiThread()) {
+      mNodesManager.postOnAnimation(mFrameCallback);
+    } else {
+      UiThreadUtil.runOnUiThread(() -> mNodesManager.postOnAnimation(mFrameCallback));
+    }
   }
 
   @DoNotStrip
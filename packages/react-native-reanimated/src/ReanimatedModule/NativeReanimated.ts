@@ -31,8 +31,13 @@ import { jsVersion } from '../platform-specific/jsVersion';
 import { assertWorkletsVersion } from '../platform-specific/workletsVersion';
 import { ReanimatedTurboModule } from '../specs';
 import type {
+  FramePhaseStats,
+  FrameStats,
   IReanimatedModule,
   ReanimatedModuleProxy,
+  RegistriesStats,
+  RegistryStats,
+  UpdateRate,
 } from './reanimatedModuleProxy';
 
 export function createNativeReanimatedModule(): IReanimatedModule {
@@ -187,6 +192,13 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
     this.#reanimatedModuleProxy.setViewStyle(viewTag, style);
   }
 
+  setAnimatedPropsUpdateRate(viewTag: number, updateRate?: UpdateRate) {
+    this.#reanimatedModuleProxy.setAnimatedPropsUpdateRate(
+      viewTag,
+      updateRate
+    );
+  }
+
   markNodeAsRemovable(shadowNodeWrapper: ShadowNodeWrapper) {
     this.#reanimatedModuleProxy.markNodeAsRemovable(shadowNodeWrapper);
   }
@@ -243,6 +255,14 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
   unregisterCSSTransition(viewTag: number) {
     this.#reanimatedModuleProxy.unregisterCSSTransition(viewTag);
   }
+
+  getRegistriesStats() {
+    return this.#reanimatedModuleProxy.getRegistriesStats();
+  }
+
+  getFrameStats() {
+    return this.#reanimatedModuleProxy.getFrameStats();
+  }
 }
 
 class DummyReanimatedModuleProxy implements ReanimatedModuleProxy {
@@ -255,6 +275,7 @@ class DummyReanimatedModuleProxy implements ReanimatedModuleProxy {
 
   unsubscribeFromKeyboardEvents(): void {}
   setViewStyle(): void {}
+  setAnimatedPropsUpdateRate(): void {}
   markNodeAsRemovable(): void {}
   unmarkNodeAsRemovable(): void {}
   registerCSSKeyframes(): void {}
@@ -266,6 +287,39 @@ class DummyReanimatedModuleProxy implements ReanimatedModuleProxy {
   registerCSSTransition(): void {}
   updateCSSTransition(): void {}
   unregisterCSSTransition(): void {}
+  getRegistriesStats(): RegistriesStats {
+    const empty: RegistryStats = {
+      entriesCount: 0,
+      retainedBytes: 0,
+      runningCount: 0,
+      delayedCount: 0,
+    };
+    return {
+      animatedProps: empty,
+      cssAnimations: empty,
+      cssTransitions: empty,
+      staticProps: empty,
+      cssKeyframes: empty,
+      layoutAnimations: empty,
+      eventHandlers: empty,
+    };
+  }
+  getFrameStats(): FrameStats {
+    const empty: FramePhaseStats = {
+      runsCount: 0,
+      lastDurationMs: 0,
+      maxDurationMs: 0,
+      totalDurationMs: 0,
+    };
+    return {
+      framesCount: 0,
+      mergedRequestsCount: 0,
+      frameCallbacks: empty,
+      layoutAnimations: empty,
+      css: empty,
+      commit: empty,
+    };
+  }
   registerSensor(): number {
     return -1;
   }
@@ -2,6 +2,11 @@
 
 export { ReanimatedModule } from './reanimatedModuleInstance';
 export type {
+  FramePhaseStats,
+  FrameStats,
   IReanimatedModule,
   ReanimatedModuleProxy,
+  RegistriesStats,
+  RegistryStats,
+  UpdateRate,
 } from './reanimatedModuleProxy';
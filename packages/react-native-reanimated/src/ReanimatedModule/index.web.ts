@@ -4,6 +4,11 @@ import { createJSReanimatedModule } from './js-reanimated';
 
 export const ReanimatedModule = createJSReanimatedModule();
 export type {
+  FramePhaseStats,
+  FrameStats,
   IReanimatedModule,
   ReanimatedModuleProxy,
+  RegistriesStats,
+  RegistryStats,
+  UpdateRate,
 } from './reanimatedModuleProxy';
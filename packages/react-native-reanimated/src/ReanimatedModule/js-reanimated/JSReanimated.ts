@@ -26,7 +26,12 @@ import type {
   NormalizedCSSTransitionConfig,
 } from '../../css/platform/native';
 import { assertWorkletsVersion } from '../../platform-specific/workletsVersion';
-import type { IReanimatedModule } from '../reanimatedModuleProxy';
+import type {
+  FrameStats,
+  IReanimatedModule,
+  RegistriesStats,
+  UpdateRate,
+} from '../reanimatedModuleProxy';
 import type { WebSensor } from './WebSensor';
 
 export function createJSReanimatedModule(): IReanimatedModule {
@@ -268,6 +273,15 @@ class JSReanimated implements IReanimatedModule {
     throw new ReanimatedError('setViewStyle is not available in JSReanimated.');
   }
 
+  setAnimatedPropsUpdateRate(
+    _viewTag: number,
+    _updateRate?: UpdateRate
+  ): void {
+    throw new ReanimatedError(
+      'setAnimatedPropsUpdateRate is not available in JSReanimated.'
+    );
+  }
+
   markNodeAsRemovable(_shadowNodeWrapper: ShadowNodeWrapper): void {
     throw new ReanimatedError(
       'markNodeAsRemovable is not available in JSReanimated.'
@@ -333,6 +347,18 @@ class JSReanimated implements IReanimatedModule {
       '`unregisterCSSTransition` is not available in JSReanimated.'
     );
   }
+
+  getRegistriesStats(): RegistriesStats {
+    throw new ReanimatedError(
+      '`getRegistriesStats` is not available in JSReanimated.'
+    );
+  }
+
+  getFrameStats(): FrameStats {
+    throw new ReanimatedError(
+      '`getFrameStats` is not available in JSReanimated.'
+    );
+  }
 }
 
 // Lack of this export breaks TypeScript generation since
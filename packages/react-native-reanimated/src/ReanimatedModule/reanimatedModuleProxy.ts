@@ -15,6 +15,64 @@ import type {
   NormalizedCSSTransitionConfig,
 } from '../css/platform/native';
 
+/**
+ * How often updates of an animation are applied: at the display refresh rate,
+ * in every other frame or a fixed number of times per second.
+ */
+export type UpdateRate = 'full' | 'half' | number;
+
+export interface RegistryStats {
+  entriesCount: number;
+  /**
+   * Approximate number of bytes retained by the registry. Objects shared with
+   * other owners (e.g. shadow nodes) are not included.
+   */
+  retainedBytes: number;
+  /** Number of items updated in every frame (e.g. running animations). */
+  runningCount: number;
+  /** Number of items waiting for their delay to pass. */
+  delayedCount: number;
+}
+
+export interface RegistriesStats {
+  animatedProps: RegistryStats;
+  cssAnimations: RegistryStats;
+  cssTransitions: RegistryStats;
+  staticProps: RegistryStats;
+  cssKeyframes: RegistryStats;
+  layoutAnimations: RegistryStats;
+  eventHandlers: RegistryStats;
+}
+
+export interface FramePhaseStats {
+  runsCount: number;
+  lastDurationMs: number;
+  maxDurationMs: number;
+  totalDurationMs: number;
+}
+
+export interface FrameStats {
+  /** Number of frames requested from the platform. */
+  framesCount: number;
+  /** Number of frame requests merged into an already requested frame. */
+  mergedRequestsCount: number;
+  frameCallbacks: FramePhaseStats;
+  layoutAnimations: FramePhaseStats;
+  css: FramePhaseStats;
+  /** Commits run in frames, together with the work that precedes them. */
+  commit: FramePhaseStats;
+  /**
+   * Number of frames in which the CSS loop was asleep (waiting for delayed
+   * animations or transitions) instead of running.
+   */
+  skippedCSSLoopWakeupsCount: number;
+  /**
+   * Number of exiting animations that weren't run, because their views were
+   * outside of the window when they were removed.
+   */
+  skippedExitingAnimationsCount: number;
+}
+
 /** Type of `__reanimatedModuleProxy` injected with JSI. */
 export interface ReanimatedModuleProxy {
   registerEventHandler<T>(
@@ -58,6 +116,8 @@ export interface ReanimatedModuleProxy {
 
   setViewStyle(viewTag: number, style: StyleProps): void;
 
+  setAnimatedPropsUpdateRate(viewTag: number, updateRate?: UpdateRate): void;
+
   markNodeAsRemovable(shadowNodeWrapper: ShadowNodeWrapper): void;
   unmarkNodeAsRemovable(viewTag: number): void;
 
@@ -86,6 +146,10 @@ export interface ReanimatedModuleProxy {
   ): void;
 
   unregisterCSSTransition(viewTag: number): void;
+
+  getRegistriesStats(): RegistriesStats;
+
+  getFrameStats(): FrameStats;
 }
 
 export interface IReanimatedModule
@@ -1,4 +1,6 @@
 'use strict';
+import { runOnUI } from 'react-native-worklets';
+
 import { IS_WEB, IS_WINDOW_AVAILABLE } from './common';
 import { makeMutable } from './mutables';
 
@@ -21,5 +23,11 @@ export const ReducedMotionManager = {
   setEnabled(value: boolean) {
     ReducedMotionManager.jsValue = value;
     ReducedMotionManager.uiValue.value = value;
+    if (!IS_WEB) {
+      // Native layout animation presets read it when they start
+      runOnUI(() => {
+        global._REANIMATED_IS_REDUCED_MOTION = value;
+      })();
+    }
   },
 };
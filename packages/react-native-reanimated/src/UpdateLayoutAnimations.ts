@@ -9,6 +9,7 @@ import {
   configureLayoutAnimationBatch,
   makeShareableCloneRecursive,
 } from './core';
+import { NativeLayoutAnimationPreset } from './layoutReanimation/nativePresets';
 
 function createUpdateManager() {
   const animations: LayoutAnimationBatchItem[] = [];
@@ -45,8 +46,10 @@ function createUpdateManager() {
  * @param viewTag - The tag of the component you'd like to configure.
  * @param type - The type of the animation you'd like to configure -
  *   {@link LayoutAnimationType}.
- * @param config - The animation configuration - {@link LayoutAnimationFunction}
- *   or {@link Keyframe}. Passing `undefined` will remove the animation.
+ * @param config - The animation configuration -
+ *   {@link LayoutAnimationFunction}, {@link Keyframe} or
+ *   {@link NativeLayoutAnimationPreset}. Passing `undefined` will remove the
+ *   animation.
  * @param isUnmounting - Determines whether the configuration should be included
  *   at the end of the batch, after all the non-deferred configurations (even
  *   those that were updated later). This is used to retain the correct ordering
@@ -55,7 +58,7 @@ function createUpdateManager() {
 export let updateLayoutAnimations: (
   viewTag: number,
   type: LayoutAnimationType,
-  config?: Keyframe | LayoutAnimationFunction,
+  config?: Keyframe | LayoutAnimationFunction | NativeLayoutAnimationPreset,
   isUnmounting?: boolean
 ) => void;
 
@@ -67,11 +70,14 @@ if (SHOULD_BE_USE_WEB) {
   const updateLayoutAnimationsManager = createUpdateManager();
   updateLayoutAnimations = (viewTag, type, config, isUnmounting) =>
     updateLayoutAnimationsManager.update(
-      {
-        viewTag,
-        type,
-        config: config ? makeShareableCloneRecursive(config) : undefined,
-      },
+      // Native presets don't need the worklet, so it isn't shared at all
+      config instanceof NativeLayoutAnimationPreset
+        ? { viewTag, type, config: undefined, preset: config.config }
+        : {
+            viewTag,
+            type,
+            config: config ? makeShareableCloneRecursive(config) : undefined,
+          },
       isUnmounting
     );
 }
@@ -3,10 +3,13 @@ import { logger } from './common';
 import type {
   ILayoutAnimationBuilder,
   LayoutAnimationFunction,
+  LayoutAnimationType,
   LayoutAnimationValues,
   StyleProps,
 } from './commonTypes';
 import type { NestedArray } from './createAnimatedComponent/commonTypes';
+import type { NativeLayoutAnimationPreset } from './layoutReanimation/nativePresets';
+import { getNativeLayoutAnimationPreset } from './layoutReanimation/nativePresets';
 
 const mockTargetValues: LayoutAnimationValues = {
   targetOriginX: 0,
@@ -78,8 +81,9 @@ export function maybeBuild(
     | LayoutAnimationFunction
     | Keyframe,
   style: NestedArray<StyleProps> | undefined,
-  displayName: string
-): LayoutAnimationFunction | Keyframe {
+  displayName: string,
+  type?: LayoutAnimationType
+): LayoutAnimationFunction | Keyframe | NativeLayoutAnimationPreset {
   const isAnimationBuilder = (
     value: ILayoutAnimationBuilder | LayoutAnimationFunction | Keyframe
   ): value is ILayoutAnimationBuilder =>
@@ -98,7 +102,13 @@ export function maybeBuild(
       );
     }
 
-    return animationFactory;
+    // Presets with a native implementation are run without the worklet
+    const nativePreset =
+      type !== undefined
+        ? getNativeLayoutAnimationPreset(layoutAnimationOrBuilder, type)
+        : undefined;
+
+    return nativePreset ?? animationFactory;
   } else {
     return layoutAnimationOrBuilder;
   }
@@ -9,6 +9,7 @@ import type {
 import type { ShareableRef, WorkletFunction } from 'react-native-worklets';
 
 import type { CSSAnimationProperties, CSSTransitionProperties } from './css';
+import type { NormalizedCSSTimingFunction } from './css/easings';
 import type { EasingFunctionFactory } from './Easing';
 
 type LayoutAnimationOptions =
@@ -102,6 +103,19 @@ export type LayoutAnimationStartFunction = (
   config: (arg: Partial<LayoutAnimationValues>) => LayoutAnimation
 ) => void;
 
+/** Layout animation start passed from the native side in a batch. */
+export interface LayoutAnimationStart {
+  tag: number;
+  type: LayoutAnimationType;
+  yogaValues: Partial<LayoutAnimationValues>;
+  config: (arg: Partial<LayoutAnimationValues>) => LayoutAnimation;
+  /**
+   * The view was removed without running the animation, only its callback is
+   * called with `finished` set to `false`.
+   */
+  skipped: boolean;
+}
+
 export interface ILayoutAnimationBuilder {
   build: () => LayoutAnimationFunction;
 }
@@ -154,10 +168,21 @@ export type StylePropsWithArrayTransform = StyleProps & {
   transform?: TransformArrayItem[];
 };
 
+/** Config of a layout animation preset that is run natively. */
+export interface NativeLayoutAnimationPresetConfig {
+  name: string;
+  duration: number;
+  delay: number;
+  easing: NormalizedCSSTimingFunction;
+  /** Resolved natively when the animation starts */
+  reduceMotion: ReduceMotion;
+}
+
 export interface LayoutAnimationBatchItem {
   viewTag: number;
   type: LayoutAnimationType;
   config: ShareableRef<Keyframe | LayoutAnimationFunction> | undefined;
+  preset?: NativeLayoutAnimationPresetConfig;
 }
 
 export type RequiredKeys<T, K extends keyof T> = T & Required<Pick<T, K>>;
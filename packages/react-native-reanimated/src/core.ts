@@ -16,6 +16,7 @@ import type {
   Value3D,
   ValueRotation,
 } from './commonTypes';
+import type { FrameStats, RegistriesStats } from './ReanimatedModule';
 import { ReanimatedModule } from './ReanimatedModule';
 import { SensorContainer } from './SensorContainer';
 
@@ -193,6 +194,24 @@ export function enableLayoutAnimations(
   );
 }
 
+/**
+ * Returns the number of entries and the approximate memory retained by native
+ * Reanimated registries. It is cheap enough to be called periodically, e.g. to
+ * detect registries that keep growing.
+ */
+export function getRegistriesStats(): RegistriesStats {
+  return ReanimatedModule.getRegistriesStats();
+}
+
+/**
+ * Returns the number of frames requested by Reanimated and the time spent in
+ * every phase of these frames (frame callbacks, native layout animations, CSS
+ * animations and the commit).
+ */
+export function getFrameStats(): FrameStats {
+  return ReanimatedModule.getFrameStats();
+}
+
 export function configureLayoutAnimationBatch(
   layoutAnimationsBatch: LayoutAnimationBatchItem[]
 ): void {
@@ -99,7 +99,12 @@ export default class AnimatedComponent
     updateLayoutAnimations(
       this.reanimatedID,
       LayoutAnimationType.ENTERING,
-      maybeBuild(entering, this.props?.style, displayName)
+      maybeBuild(
+        entering,
+        this.props?.style,
+        displayName,
+        LayoutAnimationType.ENTERING
+      )
     );
   }
 
@@ -331,7 +336,8 @@ export default class AnimatedComponent
         maybeBuild(
           layout,
           undefined /* We don't have to warn user if style has common properties with animation for LAYOUT */,
-          this._displayName
+          this._displayName,
+          LayoutAnimationType.LAYOUT
         )
     );
   }
@@ -351,7 +357,12 @@ export default class AnimatedComponent
           updateLayoutAnimations(
             tag,
             LayoutAnimationType.EXITING,
-            maybeBuild(exiting, this.props?.style, this._displayName)
+            maybeBuild(
+              exiting,
+              this.props?.style,
+              this._displayName,
+              LayoutAnimationType.EXITING
+            )
           );
         }
       }
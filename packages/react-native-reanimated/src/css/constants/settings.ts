@@ -11,6 +11,7 @@ export const ANIMATION_PROPS: CSSAnimationProp[] = [
   'animationDirection',
   'animationFillMode',
   'animationPlayState',
+  'animationUpdateRate',
 ];
 
 export const TRANSITION_PROPS: CSSTransitionProp[] = [
@@ -20,6 +21,7 @@ export const TRANSITION_PROPS: CSSTransitionProp[] = [
   'transitionDelay',
   'transitionBehavior',
   'transition',
+  'transitionUpdateRate',
 ];
 
 export const VALID_STEPS_MODIFIERS: StepsModifier[] = [
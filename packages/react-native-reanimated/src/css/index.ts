@@ -14,6 +14,7 @@ export type {
   CSSAnimationProperties,
   CSSAnimationSettings,
   CSSAnimationTimingFunction,
+  CSSAnimationUpdateRate,
   CSSKeyframesRule,
   CSSStyle,
   CSSTransitionDelay,
@@ -23,4 +24,5 @@ export type {
   CSSTransitionSettings,
   CSSTransitionShorthand,
   CSSTransitionTimingFunction,
+  CSSTransitionUpdateRate,
 } from './types';
@@ -165,6 +165,15 @@ describe(normalizeSingleCSSAnimationSettings, () => {
       playState: 'paused',
     });
   });
+
+  it('includes the update rate only if it is specified', () => {
+    expect(normalizeSingleCSSAnimationSettings({})).not.toHaveProperty(
+      'updateRate'
+    );
+    expect(
+      normalizeSingleCSSAnimationSettings({ animationUpdateRate: 'half' })
+    ).toHaveProperty('updateRate', 'half');
+  });
 });
 
 describe(getAnimationSettingsUpdates, () => {
@@ -200,6 +209,7 @@ describe(getAnimationSettingsUpdates, () => {
       { iterationCount: 2 },
       { fillMode: 'forwards' },
       { playState: 'paused' },
+      { updateRate: 30 },
       {
         duration: 2000,
         timingFunction: 'ease-in',
@@ -219,5 +229,14 @@ describe(getAnimationSettingsUpdates, () => {
         ).toEqual(updates);
       }
     );
+
+    it('resets the update rate to "full" when it is removed', () => {
+      expect(
+        getAnimationSettingsUpdates(
+          { ...oldSettings, updateRate: 'half' },
+          oldSettings
+        )
+      ).toEqual({ updateRate: 'full' });
+    });
   });
 });
@@ -17,6 +17,7 @@ export function createSingleCSSAnimationProperties(
     animationDirection,
     animationFillMode,
     animationPlayState,
+    animationUpdateRate,
   } = convertPropertiesToArrays(properties);
 
   return animationNames.map((animationName, index) => {
@@ -33,6 +34,8 @@ export function createSingleCSSAnimationProperties(
       animationFillMode: animationFillMode?.[index % animationFillMode.length],
       animationPlayState:
         animationPlayState?.[index % animationPlayState.length],
+      animationUpdateRate:
+        animationUpdateRate?.[index % animationUpdateRate.length],
     };
   });
 }
@@ -13,6 +13,7 @@ import {
   normalizeDelay,
   normalizeDuration,
   normalizeTimingFunction,
+  normalizeUpdateRate,
 } from '../common';
 import {
   VALID_ANIMATION_DIRECTIONS,
@@ -87,8 +88,9 @@ export function normalizeSingleCSSAnimationSettings({
   animationDirection,
   animationFillMode,
   animationPlayState,
+  animationUpdateRate,
 }: SingleCSSAnimationSettings): NormalizedSingleCSSAnimationSettings {
-  return {
+  const settings: NormalizedSingleCSSAnimationSettings = {
     duration: normalizeDuration(animationDuration),
     timingFunction: normalizeTimingFunction(animationTimingFunction),
     delay: normalizeDelay(animationDelay),
@@ -97,6 +99,10 @@ export function normalizeSingleCSSAnimationSettings({
     fillMode: normalizeFillMode(animationFillMode),
     playState: normalizePlayState(animationPlayState),
   };
+  if (animationUpdateRate !== undefined) {
+    settings.updateRate = normalizeUpdateRate(animationUpdateRate);
+  }
+  return settings;
 }
 
 export function getAnimationSettingsUpdates(
@@ -131,6 +137,9 @@ export function getAnimationSettingsUpdates(
   if (oldConfig.playState !== newConfig.playState) {
     updatedSettings.playState = newConfig.playState;
   }
+  if (oldConfig.updateRate !== newConfig.updateRate) {
+    updatedSettings.updateRate = newConfig.updateRate ?? 'full';
+  }
 
   return updatedSettings;
 }
@@ -6,12 +6,13 @@ import type {
   PredefinedTimingFunction,
 } from '../../../../../easings';
 import { cubicBezier, linear, steps } from '../../../../../easings';
-import type { TimeUnit } from '../../../../../types';
+import type { CSSUpdateRate, TimeUnit } from '../../../../../types';
 import {
   ERROR_MESSAGES,
   normalizeDelay,
   normalizeDuration,
   normalizeTimingFunction,
+  normalizeUpdateRate,
 } from '../settings';
 
 type TestCases = [TimeUnit, number][];
@@ -173,3 +174,19 @@ describe(normalizeTimingFunction, () => {
     });
   });
 });
+
+describe(normalizeUpdateRate, () => {
+  it.each(['full', 'half', 30, 0.5] satisfies CSSUpdateRate[])(
+    'returns %p as is',
+    (updateRate) => {
+      expect(normalizeUpdateRate(updateRate)).toBe(updateRate);
+    }
+  );
+
+  it.each([0, -10, NaN, 'quarter'])('throws an error for %p', (value) => {
+    const updateRate = value as CSSUpdateRate;
+    expect(() => normalizeUpdateRate(updateRate)).toThrow(
+      new ReanimatedError(ERROR_MESSAGES.invalidUpdateRate(updateRate))
+    );
+  });
+});
@@ -3,4 +3,5 @@ export {
   normalizeDelay,
   normalizeDuration,
   normalizeTimingFunction,
+  normalizeUpdateRate,
 } from './settings';
@@ -10,7 +10,7 @@ import type {
   NormalizedCSSTimingFunction,
   PredefinedTimingFunction,
 } from '../../../../easings';
-import type { TimeUnit } from '../../../../types';
+import type { CSSUpdateRate, TimeUnit } from '../../../../types';
 import { isPredefinedTimingFunction } from '../../../../utils';
 
 export const ERROR_MESSAGES = {
@@ -24,6 +24,8 @@ export const ERROR_MESSAGES = {
     `Invalid predefined timing function "${timingFunction}". Supported values are: ${VALID_PREDEFINED_TIMING_FUNCTIONS.join(', ')}.`,
   invalidParametrizedTimingFunction: (timingFunction: CSSTimingFunction) =>
     `Invalid parametrized timing function "${timingFunction?.toString()}".`,
+  invalidUpdateRate: (updateRate: CSSUpdateRate) =>
+    `Invalid update rate "${updateRate}". Expected "full", "half" or a positive number.`,
 };
 
 function normalizeTimeUnit(timeUnit: TimeUnit): number | null {
@@ -76,3 +78,14 @@ export function normalizeTimingFunction(
   }
   return timingFunction.normalize();
 }
+
+export function normalizeUpdateRate(updateRate: CSSUpdateRate): CSSUpdateRate {
+  if (
+    typeof updateRate === 'number'
+      ? !(updateRate > 0)
+      : updateRate !== 'full' && updateRate !== 'half'
+  ) {
+    throw new ReanimatedError(ERROR_MESSAGES.invalidUpdateRate(updateRate));
+  }
+  return updateRate;
+}
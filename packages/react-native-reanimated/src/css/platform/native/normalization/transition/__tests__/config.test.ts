@@ -271,6 +271,41 @@ describe(normalizeCSSTransitionProperties, () => {
     });
   });
 
+  describe('update rate', () => {
+    it('adds the update rate of all properties to the config', () => {
+      const config: CSSTransitionProperties = {
+        transitionProperty: ['opacity', 'width'],
+        transitionDuration: '1s',
+        transitionUpdateRate: 20,
+      };
+
+      expect(normalizeCSSTransitionProperties(config)).toEqual({
+        properties: ['opacity', 'width'],
+        settings: {
+          opacity: {
+            duration: 1000,
+            timingFunction: 'ease',
+            delay: 0,
+            allowDiscrete: false,
+          },
+          width: {
+            duration: 1000,
+            timingFunction: 'ease',
+            delay: 0,
+            allowDiscrete: false,
+          },
+        },
+        updateRate: 20,
+      });
+    });
+
+    it('returns null if only the update rate is specified', () => {
+      expect(
+        normalizeCSSTransitionProperties({ transitionUpdateRate: 'half' })
+      ).toBeNull();
+    });
+  });
+
   describe('transition shorthand', () => {
     it('properly parses transition shorthand', () => {
       const config: CSSTransitionProperties = {
@@ -558,4 +593,36 @@ describe(getNormalizedCSSTransitionConfigUpdates, () => {
       });
     });
   });
+
+  describe('update rate changes', () => {
+    const config: NormalizedCSSTransitionConfig = {
+      properties: 'all',
+      settings: {
+        all: {
+          duration: 1000,
+          timingFunction: 'ease',
+          delay: 0,
+          allowDiscrete: false,
+        },
+      },
+    };
+
+    it('returns the new update rate if it changed', () => {
+      expect(
+        getNormalizedCSSTransitionConfigUpdates(config, {
+          ...config,
+          updateRate: 'half',
+        })
+      ).toEqual({ updateRate: 'half' });
+    });
+
+    it('resets the update rate to "full" when it is removed', () => {
+      expect(
+        getNormalizedCSSTransitionConfigUpdates(
+          { ...config, updateRate: 10 },
+          config
+        )
+      ).toEqual({ updateRate: 'full' });
+    });
+  });
 });
@@ -19,6 +19,7 @@ import {
   normalizeDelay,
   normalizeDuration,
   normalizeTimingFunction,
+  normalizeUpdateRate,
 } from '../common';
 import { normalizeTransitionBehavior } from './settings';
 import type { ExpandedCSSTransitionConfigProperties } from './shorthand';
@@ -72,7 +73,10 @@ const hasTransition = ({
 export function normalizeCSSTransitionProperties(
   config: CSSTransitionProperties
 ): NormalizedCSSTransitionConfig | null {
-  const expandedProperties = getExpandedConfigProperties(config);
+  // The update rate is a single value for all transitioned properties, so it
+  // isn't expanded to an array like the other settings
+  const { transitionUpdateRate, ...rest } = config;
+  const expandedProperties = getExpandedConfigProperties(rest);
 
   if (!hasTransition(expandedProperties)) {
     return null;
@@ -133,10 +137,14 @@ export function normalizeCSSTransitionProperties(
     }
   }
 
-  return {
+  const result: NormalizedCSSTransitionConfig = {
     properties: allPropertiesTransition ? 'all' : specificProperties.reverse(),
     settings,
   };
+  if (transitionUpdateRate !== undefined) {
+    result.updateRate = normalizeUpdateRate(transitionUpdateRate);
+  }
+  return result;
 }
 
 export function getNormalizedCSSTransitionConfigUpdates(
@@ -174,5 +182,9 @@ export function getNormalizedCSSTransitionConfigUpdates(
     }
   }
 
+  if (oldConfig.updateRate !== newConfig.updateRate) {
+    configUpdates.updateRate = newConfig.updateRate ?? 'full';
+  }
+
   return configUpdates;
 }
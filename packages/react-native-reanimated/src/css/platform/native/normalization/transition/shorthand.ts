@@ -19,7 +19,10 @@ import {
 
 export type ExpandedCSSTransitionConfigProperties = Required<
   ConvertValuesToArraysWithUndefined<
-    Omit<CSSTransitionProperties, 'transition' | 'transitionProperty'>
+    Omit<
+      CSSTransitionProperties,
+      'transition' | 'transitionProperty' | 'transitionUpdateRate'
+    >
   >
 > & {
   transitionProperty: string[];
@@ -4,6 +4,7 @@ import type {
   CSSAnimationDirection,
   CSSAnimationFillMode,
   CSSAnimationPlayState,
+  CSSUpdateRate,
   PlainStyle,
 } from '../../../types';
 
@@ -44,6 +45,8 @@ export type NormalizedSingleCSSAnimationSettings = {
   direction: CSSAnimationDirection;
   fillMode: CSSAnimationFillMode;
   playState: CSSAnimationPlayState;
+  // Omitted when not specified (the full rate is used then)
+  updateRate?: CSSUpdateRate;
 };
 
 export type CSSAnimationUpdates = {
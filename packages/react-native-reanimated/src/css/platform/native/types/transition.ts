@@ -1,5 +1,6 @@
 'use strict';
 import type { NormalizedCSSTimingFunction } from '../../../easings';
+import type { CSSUpdateRate } from '../../../types';
 
 export type NormalizedSingleCSSTransitionSettings = {
   duration: number;
@@ -13,6 +14,8 @@ export type NormalizedCSSTransitionPropertyNames = 'all' | string[];
 export type NormalizedCSSTransitionConfig = {
   properties: NormalizedCSSTransitionPropertyNames;
   settings: Record<string, NormalizedSingleCSSTransitionSettings>;
+  // Omitted when not specified (the full rate is used then)
+  updateRate?: CSSUpdateRate;
 };
 
 export type NormalizedCSSTransitionConfigUpdates =
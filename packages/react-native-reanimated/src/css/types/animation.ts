@@ -1,6 +1,6 @@
 'use strict';
 import type { CSSTimingFunction } from '../easings';
-import type { PlainStyle, TimeUnit } from './common';
+import type { CSSUpdateRate, PlainStyle, TimeUnit } from './common';
 import type { AddArrayPropertyType, AddArrayPropertyTypes } from './helpers';
 
 export interface CSSKeyframesRule {
@@ -30,6 +30,7 @@ export type CSSAnimationDirection =
   | 'alternate-reverse';
 export type CSSAnimationFillMode = 'none' | 'forwards' | 'backwards' | 'both';
 export type CSSAnimationPlayState = 'running' | 'paused';
+export type CSSAnimationUpdateRate = CSSUpdateRate;
 
 export type SingleCSSAnimationSettings = {
   animationDuration?: CSSAnimationDuration;
@@ -39,6 +40,7 @@ export type SingleCSSAnimationSettings = {
   animationDirection?: CSSAnimationDirection;
   animationFillMode?: CSSAnimationFillMode;
   animationPlayState?: CSSAnimationPlayState;
+  animationUpdateRate?: CSSAnimationUpdateRate;
   // animationTimeline?: // TODO - This is still experimental in browsers and we might not want to support it when CSS animations in reanimated are released
 };
 
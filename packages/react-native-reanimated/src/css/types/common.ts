@@ -27,6 +27,10 @@ export type TimeUnit = `${number}s` | `${number}ms` | number;
 
 export type Percentage = `${number}%`;
 
+// How often updates are evaluated: at the display refresh rate ('full'), every
+// other frame ('half') or a number of times per second
+export type CSSUpdateRate = 'full' | 'half' | number;
+
 export type Point = { x: number; y: number };
 
 export type TransformsArray = Exclude<
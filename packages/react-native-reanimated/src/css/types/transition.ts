@@ -1,6 +1,6 @@
 'use strict';
 import type { CSSTimingFunction } from '../easings';
-import type { PlainStyle, TimeUnit } from './common';
+import type { CSSUpdateRate, PlainStyle, TimeUnit } from './common';
 import type { AddArrayPropertyTypes } from './helpers';
 
 export type CSSTransitionProperty<S extends object = PlainStyle> =
@@ -13,6 +13,7 @@ export type CSSTransitionTimingFunction = CSSTimingFunction;
 export type CSSTransitionDelay = TimeUnit;
 export type CSSTransitionBehavior = 'normal' | 'allow-discrete';
 export type CSSTransitionShorthand = string;
+export type CSSTransitionUpdateRate = CSSUpdateRate;
 
 type SingleCSSTransitionSettings = {
   transitionDuration?: CSSTransitionDuration;
@@ -33,6 +34,8 @@ export type CSSTransitionProperties<S extends object = PlainStyle> =
   CSSTransitionSettings & {
     transitionProperty?: CSSTransitionProperty<S>;
     transition?: CSSTransitionShorthand;
+    // Applies to all transitioned properties of the view
+    transitionUpdateRate?: CSSTransitionUpdateRate;
   };
 
 export type CSSTransitionProp = keyof CSSTransitionProperties;
@@ -90,6 +90,8 @@ export {
   createWorkletRuntime,
   enableLayoutAnimations,
   executeOnUIRuntimeSync,
+  getFrameStats,
+  getRegistriesStats,
   getViewProp,
   isConfigured,
   isReanimated3,
@@ -289,6 +291,12 @@ export {
 } from './platformFunctions';
 export { getUseOfValueInStyleWarning } from './pluginUtils';
 export { createAnimatedPropAdapter } from './PropAdapters';
+export type {
+  FramePhaseStats,
+  FrameStats,
+  RegistriesStats,
+  RegistryStats,
+} from './ReanimatedModule';
 export type {
   AnimatedScreenTransition,
   GoBackGesture,
@@ -0,0 +1,104 @@
+'use strict';
+import { LayoutAnimationType, ReduceMotion } from '../../commonTypes';
+import { Easing } from '../../Easing';
+import { FadeIn, SlideInRight, SlideOutLeft } from '../defaultAnimations';
+import { LinearTransition } from '../defaultTransitions';
+import {
+  getNativeLayoutAnimationPreset,
+  NativeLayoutAnimationPreset,
+} from '../nativePresets';
+
+describe(getNativeLayoutAnimationPreset, () => {
+  describe('returns a native preset', () => {
+    it('for a preset class', () => {
+      const preset = getNativeLayoutAnimationPreset(
+        FadeIn,
+        LayoutAnimationType.ENTERING
+      );
+
+      expect(preset).toBeInstanceOf(NativeLayoutAnimationPreset);
+      expect(preset?.config).toMatchObject({
+        name: 'FadeIn',
+        duration: 300,
+        delay: 0,
+        reduceMotion: ReduceMotion.System,
+      });
+    });
+
+    it('for a preset instance with duration and delay', () => {
+      const preset = getNativeLayoutAnimationPreset(
+        FadeIn.duration(500).delay(100),
+        LayoutAnimationType.EXITING
+      );
+
+      expect(preset?.config).toMatchObject({
+        name: 'FadeIn',
+        duration: 500,
+        delay: 100,
+      });
+    });
+
+    it('for a layout transition', () => {
+      expect(
+        getNativeLayoutAnimationPreset(
+          LinearTransition,
+          LayoutAnimationType.LAYOUT
+        )?.config.name
+      ).toBe('LinearTransition');
+    });
+
+    it.each([ReduceMotion.Always, ReduceMotion.Never])(
+      'with reduce motion "%s" left to be resolved natively',
+      (reduceMotion) => {
+        expect(
+          getNativeLayoutAnimationPreset(
+            FadeIn.reduceMotion(reduceMotion),
+            LayoutAnimationType.ENTERING
+          )?.config.reduceMotion
+        ).toBe(reduceMotion);
+      }
+    );
+
+    it('with the default easing of withTiming', () => {
+      const easing = getNativeLayoutAnimationPreset(
+        FadeIn,
+        LayoutAnimationType.ENTERING
+      )?.config.easing;
+      const defaultEasing = Easing.inOut(Easing.quad);
+
+      expect(easing).toMatchObject({ name: 'linear' });
+      const { points } = easing as { points: { x: number; y: number }[] };
+      expect(points[0]).toEqual({ x: 0, y: 0 });
+      expect(points[points.length - 1]).toEqual({ x: 1, y: 1 });
+      for (const { x, y } of points) {
+        expect(y).toBeCloseTo(defaultEasing(x));
+      }
+    });
+  });
+
+  describe('returns undefined', () => {
+    it.each([
+      [SlideInRight, LayoutAnimationType.EXITING],
+      [SlideOutLeft, LayoutAnimationType.ENTERING],
+      [LinearTransition, LayoutAnimationType.ENTERING],
+      [FadeIn, LayoutAnimationType.LAYOUT],
+    ])('for a preset with an unsupported type (%#)', (presetClass, type) => {
+      expect(getNativeLayoutAnimationPreset(presetClass, type)).toBeUndefined();
+    });
+
+    it.each([
+      ['custom easing', () => FadeIn.easing(Easing.linear)],
+      ['spring', () => FadeIn.springify()],
+      ['callback', () => FadeIn.withCallback(() => {})],
+      ['initial values', () => FadeIn.withInitialValues({ opacity: 0.5 })],
+      ['random delay', () => FadeIn.randomDelay()],
+    ])('for a preset with %s', (_, createBuilder) => {
+      expect(
+        getNativeLayoutAnimationPreset(
+          createBuilder(),
+          LayoutAnimationType.ENTERING
+        )
+      ).toBeUndefined();
+    });
+  });
+});
@@ -4,6 +4,7 @@ import { runOnUI } from 'react-native-worklets';
 import { withStyleAnimation } from '../animation';
 import type {
   LayoutAnimation,
+  LayoutAnimationStart,
   LayoutAnimationStartFunction,
   LayoutAnimationValues,
   SharedValue,
@@ -35,13 +36,14 @@ function stopObservingProgress(
 
 function createLayoutAnimationManager(): {
   start: LayoutAnimationStartFunction;
+  startBatch: (starts: LayoutAnimationStart[]) => void;
   stop: (tag: number) => void;
 } {
   'worklet';
   const currentAnimationForTag = new Map();
   const mutableValuesForTag = new Map();
 
-  return {
+  const manager = {
     start(
       tag: number,
       type: LayoutAnimationType,
@@ -90,6 +92,34 @@ function createLayoutAnimationManager(): {
       startObservingProgress(tag, value);
       value.value = animation;
     },
+    /**
+     * Starts all layout animations from a single mounting transaction, so that
+     * the native side has to call into JS only once per transaction.
+     */
+    startBatch(starts: LayoutAnimationStart[]): void {
+      const errors: unknown[] = [];
+      for (const { tag, type, yogaValues, config, skipped } of starts) {
+        try {
+          if (skipped) {
+            // The view has already been removed
+            config(yogaValues).callback?.(false);
+          } else {
+            manager.start(tag, type, yogaValues, config);
+          }
+        } catch (error) {
+          // A failing animation mustn't prevent the rest of the batch from
+          // starting. It is ended right away, so that its view isn't left
+          // in the animated state (or never removed if it's exiting).
+          if (!skipped) {
+            global._notifyAboutEnd(tag, type === LayoutAnimationType.EXITING);
+          }
+          errors.push(error);
+        }
+      }
+      if (errors.length > 0) {
+        throw errors[0];
+      }
+    },
     stop(tag: number) {
       const value = mutableValuesForTag.get(tag);
       if (!value) {
@@ -98,6 +128,8 @@ function createLayoutAnimationManager(): {
       stopObservingProgress(tag, value);
     },
   };
+
+  return manager;
 }
 
 runOnUI(() => {
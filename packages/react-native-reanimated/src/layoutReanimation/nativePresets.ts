@@ -0,0 +1,129 @@
+'use strict';
+import type {
+  ILayoutAnimationBuilder,
+  NativeLayoutAnimationPresetConfig,
+} from '../commonTypes';
+import { LayoutAnimationType } from '../commonTypes';
+import { linear } from '../css/easings';
+import { Easing } from '../Easing';
+import { ComplexAnimationBuilder } from './animationBuilder';
+import {
+  FadeIn,
+  FadeInDown,
+  FadeInLeft,
+  FadeInRight,
+  FadeInUp,
+  FadeOut,
+  FadeOutDown,
+  FadeOutLeft,
+  FadeOutRight,
+  FadeOutUp,
+  SlideInDown,
+  SlideInLeft,
+  SlideInRight,
+  SlideInUp,
+  SlideOutDown,
+  SlideOutLeft,
+  SlideOutRight,
+  SlideOutUp,
+  ZoomIn,
+  ZoomOut,
+} from './defaultAnimations';
+import { LinearTransition } from './defaultTransitions';
+
+const ENTERING_AND_EXITING = [
+  LayoutAnimationType.ENTERING,
+  LayoutAnimationType.EXITING,
+];
+
+const DEFAULT_EASING_SAMPLES = 20;
+
+/**
+ * Default easing of `withTiming` (`Easing.inOut(Easing.quad)`) sampled into the
+ * CSS `linear()` easing, which is evaluated by the native easing engine.
+ */
+const DEFAULT_EASING = linear(
+  ...Array.from({ length: DEFAULT_EASING_SAMPLES + 1 }, (_, i) =>
+    Easing.inOut(Easing.quad)(i / DEFAULT_EASING_SAMPLES)
+  )
+).normalize();
+
+/**
+ * Presets that have a native implementation, together with animation types
+ * for which it can be used (presets that depend on the target or current
+ * layout can be used only with the corresponding type).
+ */
+const NATIVE_PRESETS = new Map<unknown, LayoutAnimationType[]>([
+  [FadeIn, ENTERING_AND_EXITING],
+  [FadeInRight, ENTERING_AND_EXITING],
+  [FadeInLeft, ENTERING_AND_EXITING],
+  [FadeInUp, ENTERING_AND_EXITING],
+  [FadeInDown, ENTERING_AND_EXITING],
+  [FadeOut, ENTERING_AND_EXITING],
+  [FadeOutRight, ENTERING_AND_EXITING],
+  [FadeOutLeft, ENTERING_AND_EXITING],
+  [FadeOutUp, ENTERING_AND_EXITING],
+  [FadeOutDown, ENTERING_AND_EXITING],
+  [SlideInRight, [LayoutAnimationType.ENTERING]],
+  [SlideInLeft, [LayoutAnimationType.ENTERING]],
+  [SlideInUp, [LayoutAnimationType.ENTERING]],
+  [SlideInDown, [LayoutAnimationType.ENTERING]],
+  [SlideOutRight, [LayoutAnimationType.EXITING]],
+  [SlideOutLeft, [LayoutAnimationType.EXITING]],
+  [SlideOutUp, [LayoutAnimationType.EXITING]],
+  [SlideOutDown, [LayoutAnimationType.EXITING]],
+  [ZoomIn, ENTERING_AND_EXITING],
+  [ZoomOut, ENTERING_AND_EXITING],
+  [LinearTransition, [LayoutAnimationType.LAYOUT]],
+]);
+
+/**
+ * Layout animation preset that is run entirely on the native side, without
+ * calling into JS in every frame of the animation.
+ */
+export class NativeLayoutAnimationPreset {
+  constructor(public readonly config: NativeLayoutAnimationPresetConfig) {}
+}
+
+/**
+ * Returns the native counterpart of the preset or `undefined` if the preset
+ * has to be run in JS. Only unmodified timing-based presets are supported -
+ * custom easing, springs, callbacks, initial values and random delays require
+ * the worklet implementation.
+ */
+export function getNativeLayoutAnimationPreset(
+  builderOrClass: ILayoutAnimationBuilder,
+  type: LayoutAnimationType
+): NativeLayoutAnimationPreset | undefined {
+  const presetClass =
+    builderOrClass instanceof ComplexAnimationBuilder
+      ? builderOrClass.constructor
+      : builderOrClass;
+  if (!NATIVE_PRESETS.get(presetClass)?.includes(type)) {
+    return undefined;
+  }
+
+  const builder =
+    builderOrClass instanceof ComplexAnimationBuilder
+      ? builderOrClass
+      : (builderOrClass as typeof ComplexAnimationBuilder).createInstance();
+
+  if (
+    builder.type !== undefined ||
+    builder.easingV !== undefined ||
+    builder.rotateV !== undefined ||
+    builder.callbackV !== undefined ||
+    builder.initialValues !== undefined ||
+    builder.randomizeDelay
+  ) {
+    return undefined;
+  }
+
+  return new NativeLayoutAnimationPreset({
+    name: (presetClass as { presetName: string }).presetName,
+    duration: builder.getDuration(),
+    delay: builder.getDelay(),
+    easing: DEFAULT_EASING,
+    reduceMotion: builder.getReduceMotion(),
+  });
+}
@@ -316,6 +316,8 @@ const core = {
   // isConfigured: ADD ME IF NEEDED
   enableLayoutAnimations: NOOP,
   // getViewProp: ADD ME IF NEEDED
+  // getRegistriesStats: ADD ME IF NEEDED
+  // getFrameStats: ADD ME IF NEEDED
 };
 
 const layoutReanimation = {
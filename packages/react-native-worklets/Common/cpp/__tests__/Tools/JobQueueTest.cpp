@@ -0,0 +1,79 @@
+#include <worklets/Tools/JobQueue.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+namespace worklets {
+
+namespace {
+
+void runAll(JobQueue &queue) {
+  while (const auto job = queue.pop()) {
+    job.value()();
+  }
+}
+
+} // namespace
+
+TEST(JobQueueTest, runsHigherPriorityJobsFirst) {
+  JobQueue queue;
+  std::vector<int> order;
+  queue.push([&]() { order.push_back(0); }, {.priority = JobPriority::Low});
+  queue.push([&]() { order.push_back(1); });
+  queue.push([&]() { order.push_back(2); }, {.priority = JobPriority::High});
+  queue.push([&]() { order.push_back(3); });
+
+  runAll(queue);
+
+  EXPECT_EQ(order, (std::vector<int>{2, 1, 3, 0}));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(JobQueueTest, dropsCancelledJobs) {
+  JobQueue queue;
+  std::vector<int> order;
+  queue.push([&]() { order.push_back(0); });
+  const auto handle = queue.push([&]() { order.push_back(1); });
+  queue.push([&]() { order.push_back(2); });
+
+  handle->cancel();
+  runAll(queue);
+
+  EXPECT_EQ(order, (std::vector<int>{0, 2}));
+  const auto metrics = queue.getMetrics();
+  EXPECT_EQ(metrics.executedJobs, 2);
+  EXPECT_EQ(metrics.cancelledJobs, 1);
+}
+
+TEST(JobQueueTest, dropsExpiredJobs) {
+  JobQueue queue;
+  std::vector<int> order;
+  queue.push(
+      [&]() { order.push_back(0); },
+      {.deadline = JobClock::now() - std::chrono::milliseconds(1)});
+  queue.push(
+      [&]() { order.push_back(1); },
+      {.deadline = JobClock::now() + std::chrono::hours(1)});
+
+  runAll(queue);
+
+  EXPECT_EQ(order, (std::vector<int>{1}));
+  EXPECT_EQ(queue.getMetrics().expiredJobs, 1);
+}
+
+TEST(JobQueueTest, reportsDepthOfAllPriorities) {
+  JobQueue queue;
+  queue.push([]() {}, {.priority = JobPriority::High});
+  queue.push([]() {});
+  queue.push([]() {}, {.priority = JobPriority::Low});
+
+  EXPECT_EQ(queue.getMetrics().depth, 3);
+  queue.pop();
+  EXPECT_EQ(queue.getMetrics().depth, 2);
+  queue.clear();
+  EXPECT_EQ(queue.getMetrics().depth, 0);
+}
+
+} // namespace worklets
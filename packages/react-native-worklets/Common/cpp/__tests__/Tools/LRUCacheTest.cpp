@@ -0,0 +1,56 @@
+#include <worklets/Tools/LRUCache.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace worklets {
+
+TEST(LRUCacheTest, findsInsertedValues) {
+  LRUCache<std::string, int> cache(2);
+  cache.emplace("a", 1);
+
+  ASSERT_NE(cache.find("a"), nullptr);
+  EXPECT_EQ(*cache.find("a"), 1);
+  EXPECT_EQ(cache.find("b"), nullptr);
+}
+
+TEST(LRUCacheTest, keepsExistingValue) {
+  LRUCache<std::string, int> cache(2);
+  cache.emplace("a", 1);
+
+  EXPECT_EQ(cache.emplace("a", 2), 1);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(LRUCacheTest, evictsLeastRecentlyUsedEntry) {
+  LRUCache<std::string, int> cache(2);
+  cache.emplace("a", 1);
+  cache.emplace("b", 2);
+  cache.find("a");
+
+  cache.emplace("c", 3);
+
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_NE(cache.find("a"), nullptr);
+  EXPECT_EQ(cache.find("b"), nullptr);
+  EXPECT_NE(cache.find("c"), nullptr);
+}
+
+TEST(LRUCacheTest, distinguishesKeysWithEqualPrefixes) {
+  LRUCache<std::string, int> cache(4);
+  cache.emplace("function f() { return 1; }", 1);
+  cache.emplace("function f() { return 2; }", 2);
+
+  EXPECT_EQ(*cache.find("function f() { return 1; }"), 1);
+  EXPECT_EQ(*cache.find("function f() { return 2; }"), 2);
+}
+
+TEST(LRUCacheTest, keepsAtLeastOneEntry) {
+  LRUCache<std::string, int> cache(0);
+
+  EXPECT_EQ(cache.emplace("a", 1), 1);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+} // namespace worklets
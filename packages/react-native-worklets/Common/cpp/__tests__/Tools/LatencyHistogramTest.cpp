@@ -0,0 +1,87 @@
+#include <worklets/Tools/LatencyHistogram.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace worklets {
+
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, reportsNothingWhenEmpty) {
+  LatencyHistogram histogram;
+
+  const auto percentiles = histogram.getPercentiles();
+
+  EXPECT_EQ(percentiles.count, 0);
+  EXPECT_EQ(percentiles.p99Ms, 0);
+  EXPECT_EQ(percentiles.maxMs, 0);
+}
+
+TEST(LatencyHistogramTest, reportsPercentilesWithinAFactorOfTwo) {
+  LatencyHistogram histogram;
+  for (int i = 0; i < 98; ++i) {
+    histogram.record(100us);
+  }
+  histogram.record(10ms);
+  histogram.record(20ms);
+
+  const auto percentiles = histogram.getPercentiles();
+
+  EXPECT_EQ(percentiles.count, 100);
+  EXPECT_GE(percentiles.p50Ms, 0.1);
+  EXPECT_LT(percentiles.p50Ms, 0.2);
+  EXPECT_GE(percentiles.p99Ms, 10);
+  EXPECT_LT(percentiles.p99Ms, 20);
+  EXPECT_DOUBLE_EQ(percentiles.maxMs, 20);
+}
+
+TEST(LatencyHistogramTest, neverReportsPercentilesAboveMax) {
+  LatencyHistogram histogram;
+  histogram.record(3ms);
+
+  const auto percentiles = histogram.getPercentiles();
+
+  EXPECT_DOUBLE_EQ(percentiles.p50Ms, 3);
+  EXPECT_DOUBLE_EQ(percentiles.p99Ms, 3);
+}
+
+TEST(LatencyHistogramTest, clampsNegativeLatencies) {
+  LatencyHistogram histogram;
+  histogram.record(-5ms);
+
+  const auto percentiles = histogram.getPercentiles();
+
+  EXPECT_EQ(percentiles.count, 1);
+  EXPECT_EQ(percentiles.maxMs, 0);
+}
+
+TEST(LatencyHistogramTest, resetsSamples) {
+  LatencyHistogram histogram;
+  histogram.record(1ms);
+
+  histogram.reset();
+
+  EXPECT_EQ(histogram.getPercentiles().count, 0);
+}
+
+TEST(LatencyHistogramTest, countsSamplesRecordedConcurrently) {
+  LatencyHistogram histogram;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&histogram]() {
+      for (int j = 0; j < 1000; ++j) {
+        histogram.record(std::chrono::microseconds(j));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(histogram.getPercentiles().count, 4000);
+}
+
+} // namespace worklets
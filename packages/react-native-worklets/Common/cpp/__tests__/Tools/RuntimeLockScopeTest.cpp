@@ -0,0 +1,104 @@
+#include <worklets/Tools/RuntimeLockScope.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace worklets {
+
+TEST(RuntimeLockScopeTest, marksMutexAsHeldOnlyInsideScope) {
+  std::recursive_mutex mutex;
+  EXPECT_FALSE(RuntimeLockScope::isHeldByCurrentThread(mutex));
+  {
+    RuntimeLockScope scope(mutex);
+    EXPECT_TRUE(RuntimeLockScope::isHeldByCurrentThread(mutex));
+  }
+  EXPECT_FALSE(RuntimeLockScope::isHeldByCurrentThread(mutex));
+}
+
+TEST(RuntimeLockScopeTest, restoresOuterScopeOfAnotherMutex) {
+  std::recursive_mutex outerMutex;
+  std::recursive_mutex innerMutex;
+  RuntimeLockScope outerScope(outerMutex);
+  {
+    RuntimeLockScope innerScope(innerMutex);
+    EXPECT_TRUE(RuntimeLockScope::isHeldByCurrentThread(innerMutex));
+  }
+  EXPECT_TRUE(RuntimeLockScope::isHeldByCurrentThread(outerMutex));
+}
+
+TEST(RuntimeLockScopeTest, isNotSharedWithOtherThreads) {
+  std::recursive_mutex mutex;
+  RuntimeLockScope scope(mutex);
+
+  bool heldByOtherThread = true;
+  std::thread([&]() {
+    heldByOtherThread = RuntimeLockScope::isHeldByCurrentThread(mutex);
+  }).join();
+  EXPECT_FALSE(heldByOtherThread);
+}
+
+TEST(RuntimeLockScopeTest, blocksOtherThreadsUntilReleased) {
+  auto mutex = std::make_shared<std::recursive_mutex>();
+  std::optional<RuntimeLockScope> scope;
+  scope.emplace(*mutex);
+
+  bool locked = true;
+  std::thread([&]() { locked = mutex->try_lock(); }).join();
+  EXPECT_FALSE(locked);
+
+  scope.reset();
+  std::thread([&]() {
+    locked = mutex->try_lock();
+    if (locked) {
+      mutex->unlock();
+    }
+  }).join();
+  EXPECT_TRUE(locked);
+}
+
+TEST(AroundLockTest, locksEachCallOutsideOfScope) {
+  auto mutex = std::make_shared<std::recursive_mutex>();
+  AroundLock aroundLock(mutex);
+
+  aroundLock.before();
+  bool locked = true;
+  std::thread([&]() { locked = mutex->try_lock(); }).join();
+  EXPECT_FALSE(locked);
+  aroundLock.after();
+
+  std::thread([&]() {
+    locked = mutex->try_lock();
+    if (locked) {
+      mutex->unlock();
+    }
+  }).join();
+  EXPECT_TRUE(locked);
+}
+
+TEST(AroundLockTest, skipsLockingInsideScope) {
+  auto mutex = std::make_shared<std::recursive_mutex>();
+  AroundLock aroundLock(mutex);
+  std::optional<RuntimeLockScope> scope;
+  scope.emplace(*mutex);
+
+  // Unbalanced calls would leave the mutex locked after the scope ends
+  aroundLock.before();
+  aroundLock.after();
+  aroundLock.before();
+  scope.reset();
+
+  bool locked = false;
+  std::thread([&]() {
+    locked = mutex->try_lock();
+    if (locked) {
+      mutex->unlock();
+    }
+  }).join();
+  EXPECT_TRUE(locked);
+}
+
+} // namespace worklets
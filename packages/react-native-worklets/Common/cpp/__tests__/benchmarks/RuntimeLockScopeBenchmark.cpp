@@ -0,0 +1,60 @@
+#include <worklets/Tools/RuntimeLockScope.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <mutex>
+
+namespace worklets {
+
+namespace {
+
+// Number of JSI calls made by a single job, e.g. getProperty calls of an
+// animated props update
+constexpr int CALLS_PER_BATCH = 1000;
+
+// Stands in for the work of a JSI call, so that only the locking around it
+// differs between the benchmarks
+void simulateJSICall(int &counter) {
+  benchmark::DoNotOptimize(++counter);
+}
+
+// Every call of a lockable runtime locks and unlocks the runtime mutex
+void BM_PerCallLock(benchmark::State &state) {
+  auto mutex = std::make_shared<std::recursive_mutex>();
+  AroundLock aroundLock(mutex);
+  int counter = 0;
+
+  for (auto _ : state) {
+    for (int i = 0; i < CALLS_PER_BATCH; ++i) {
+      aroundLock.before();
+      simulateJSICall(counter);
+      aroundLock.after();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * CALLS_PER_BATCH);
+}
+
+// The batch holds the mutex, so calls only check the thread-local scope
+void BM_BatchLockScope(benchmark::State &state) {
+  auto mutex = std::make_shared<std::recursive_mutex>();
+  AroundLock aroundLock(mutex);
+  int counter = 0;
+
+  for (auto _ : state) {
+    RuntimeLockScope scope(*mutex);
+    for (int i = 0; i < CALLS_PER_BATCH; ++i) {
+      aroundLock.before();
+      simulateJSICall(counter);
+      aroundLock.after();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * CALLS_PER_BATCH);
+}
+
+} // namespace
+
+BENCHMARK(BM_PerCallLock);
+BENCHMARK(BM_BatchLockScope);
+
+} // namespace worklets
@@ -0,0 +1,129 @@
+#include <worklets/Tools/LatencyHistogram.h>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace worklets {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// The UI thread holds the runtime lock for a part of every frame, e.g. while
+// running the mappers and the frame callbacks
+constexpr auto FRAME_DURATION = 2ms;
+constexpr auto LOCKED_PART_OF_FRAME = 1ms;
+
+class SimulatedUIThread {
+ public:
+  SimulatedUIThread()
+      : thread_([this]() {
+          while (!stopped_) {
+            {
+              std::lock_guard<std::mutex> lock(runtimeMutex_);
+              spinFor(LOCKED_PART_OF_FRAME);
+              flushPending();
+            }
+            std::this_thread::sleep_for(
+                FRAME_DURATION - LOCKED_PART_OF_FRAME);
+          }
+        }) {}
+
+  ~SimulatedUIThread() {
+    stopped_ = true;
+    thread_.join();
+  }
+
+  // Counterpart of `executeOnUIRuntimeSync`
+  void runSync(const std::function<void()> &job) {
+    std::lock_guard<std::mutex> lock(runtimeMutex_);
+    job();
+  }
+
+  // Counterpart of `executeOnUIRuntimeAsync`
+  void runAsync(std::function<void()> &&job) {
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pending_.push_back(std::move(job));
+  }
+
+ private:
+  static void spinFor(const std::chrono::nanoseconds duration) {
+    const auto until = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+  }
+
+  void flushPending() {
+    std::vector<std::function<void()>> pending;
+    {
+      std::lock_guard<std::mutex> lock(pendingMutex_);
+      pending.swap(pending_);
+    }
+    for (const auto &job : pending) {
+      job();
+    }
+  }
+
+  std::atomic_bool stopped_{false};
+  std::mutex runtimeMutex_;
+  std::mutex pendingMutex_;
+  std::vector<std::function<void()>> pending_;
+  std::thread thread_;
+};
+
+void reportLatency(
+    benchmark::State &state,
+    const LatencyHistogram &histogram) {
+  const auto percentiles = histogram.getPercentiles();
+  state.counters["p50_ms"] = percentiles.p50Ms;
+  state.counters["p99_ms"] = percentiles.p99Ms;
+  state.counters["max_ms"] = percentiles.maxMs;
+}
+
+// Time the JS thread is blocked for by a single UI runtime access
+void BM_JSThreadBlockedBySyncAccess(benchmark::State &state) {
+  SimulatedUIThread uiThread;
+  LatencyHistogram histogram;
+  int counter = 0;
+
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    uiThread.runSync([&counter]() { benchmark::DoNotOptimize(++counter); });
+    histogram.record(std::chrono::steady_clock::now() - start);
+    std::this_thread::sleep_for(100us);
+  }
+  reportLatency(state, histogram);
+}
+
+void BM_JSThreadBlockedByAsyncAccess(benchmark::State &state) {
+  SimulatedUIThread uiThread;
+  LatencyHistogram histogram;
+  std::atomic_int counter = 0;
+
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    uiThread.runAsync([&counter]() { ++counter; });
+    histogram.record(std::chrono::steady_clock::now() - start);
+    std::this_thread::sleep_for(100us);
+  }
+  reportLatency(state, histogram);
+}
+
+} // namespace
+
+BENCHMARK(BM_JSThreadBlockedBySyncAccess)
+    ->Iterations(2000)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_JSThreadBlockedByAsyncAccess)
+    ->Iterations(2000)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace worklets
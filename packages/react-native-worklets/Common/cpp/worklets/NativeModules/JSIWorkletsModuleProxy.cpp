@@ -12,20 +12,26 @@
 #include <fbjni/fbjni.h>
 #endif // __ANDROID__
 
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
 #include <utility>
 
 using namespace facebook;
 
 namespace worklets {
 
-inline void scheduleOnUI(
+// Returns nullptr when scheduled without options
+inline std::shared_ptr<JobHandle> scheduleOnUI(
     const std::shared_ptr<UIScheduler> &uiScheduler,
     const std::weak_ptr<WorkletRuntime> &weakUIWorkletRuntime,
     jsi::Runtime &rt,
-    const jsi::Value &worklet) {
+    const jsi::Value &worklet,
+    const std::optional<JobOptions> &options) {
   auto shareableWorklet = extractShareableOrThrow<ShareableWorklet>(
       rt, worklet, "[Worklets] Only worklets can be scheduled to run on UI.");
-  uiScheduler->scheduleOnUI([shareableWorklet, weakUIWorkletRuntime]() {
+  auto job = [shareableWorklet, weakUIWorkletRuntime]() {
     // This callback can outlive the WorkletsModuleProxy object during the
     // invalidation of React Native. This happens when WorkletsModuleProxy
     // destructor is called on the JS thread and the UI thread is
@@ -46,7 +52,15 @@ inline void scheduleOnUI(
 #endif // JS_RUNTIME_HERMES
 
     uiWorkletRuntime->runGuarded(shareableWorklet);
-  });
+  };
+
+  if (!options.has_value()) {
+    // Platform schedulers may run jobs without options differently (e.g. the
+    // iOS one runs them right away when called on the main thread)
+    uiScheduler->scheduleOnUI(std::move(job));
+    return nullptr;
+  }
+  return uiScheduler->scheduleJobOnUI(std::move(job), *options);
 }
 
 inline jsi::Value executeOnUIRuntimeSync(
@@ -59,6 +73,93 @@ inline jsi::Value executeOnUIRuntimeSync(
   return jsi::Value::undefined();
 }
 
+// Keeps the `resolve` and `reject` functions of a promise until it's settled
+// without destroying them after their runtime is torn down.
+class PromiseCallbacks {
+ public:
+  PromiseCallbacks(
+      jsi::Runtime &rt,
+      const jsi::Value &resolve,
+      const jsi::Value &reject)
+      : rt_(&rt),
+        resolve_(std::make_unique<jsi::Value>(rt, resolve)),
+        reject_(std::make_unique<jsi::Value>(rt, reject)) {}
+
+  ~PromiseCallbacks() {
+    cleanupIfRuntimeExists(rt_, resolve_);
+    cleanupIfRuntimeExists(rt_, reject_);
+  }
+
+  void resolve(jsi::Runtime &rt, const jsi::Value &value) const {
+    resolve_->asObject(rt).asFunction(rt).call(rt, value);
+  }
+
+  void reject(jsi::Runtime &rt, const std::string &message) const {
+    reject_->asObject(rt).asFunction(rt).call(
+        rt, jsi::String::createFromUtf8(rt, message));
+  }
+
+ private:
+  jsi::Runtime *rt_;
+  std::unique_ptr<jsi::Value> resolve_;
+  std::unique_ptr<jsi::Value> reject_;
+};
+
+inline jsi::Value executeOnUIRuntimeAsync(
+    const std::shared_ptr<UIRuntimeAsyncExecutor> &uiRuntimeAsyncExecutor,
+    const std::shared_ptr<JSScheduler> &jsScheduler,
+    jsi::Runtime &rt,
+    const jsi::Value &worklet) {
+  if (!uiRuntimeAsyncExecutor) {
+    throw std::runtime_error(
+        "[Worklets] `executeOnUIRuntimeAsync` is not available on this runtime.");
+  }
+  auto shareableWorklet = extractShareableOrThrow<ShareableWorklet>(
+      rt,
+      worklet,
+      "[Worklets] Only worklets can be executed asynchronously on UI runtime.");
+
+  auto promiseExecutor = jsi::Function::createFromHostFunction(
+      rt,
+      jsi::PropNameID::forAscii(rt, "executor"),
+      2,
+      [uiRuntimeAsyncExecutor, jsScheduler, shareableWorklet](
+          jsi::Runtime &rt,
+          const jsi::Value &thisValue,
+          const jsi::Value *args,
+          size_t count) {
+        auto callbacks =
+            std::make_shared<PromiseCallbacks>(rt, args[0], args[1]);
+        uiRuntimeAsyncExecutor->execute(
+            shareableWorklet,
+            [jsScheduler, callbacks](
+                const std::shared_ptr<Shareable> &result,
+                const std::exception_ptr &error) {
+              jsScheduler->scheduleOnJS(
+                  [callbacks, result, error](jsi::Runtime &rt) {
+                    if (!error) {
+                      callbacks->resolve(rt, result->toJSValue(rt));
+                      return;
+                    }
+                    std::string message;
+                    try {
+                      std::rethrow_exception(error);
+                    } catch (const std::exception &e) {
+                      message = e.what();
+                    } catch (...) {
+                      message = "[Worklets] Unknown error.";
+                    }
+                    callbacks->reject(rt, message);
+                  });
+            });
+        return jsi::Value::undefined();
+      });
+
+  return rt.global()
+      .getPropertyAsFunction(rt, "Promise")
+      .callAsConstructor(rt, promiseExecutor);
+}
+
 inline jsi::Value createWorkletRuntime(
     std::shared_ptr<JSIWorkletsModuleProxy> jsiWorkletsModuleProxy,
     const std::shared_ptr<MessageQueueThread> &jsQueue,
@@ -109,7 +210,8 @@ JSIWorkletsModuleProxy::JSIWorkletsModuleProxy(
     const std::shared_ptr<JSScheduler> &jsScheduler,
     const std::shared_ptr<UIScheduler> &uiScheduler,
     const std::shared_ptr<RuntimeManager> &runtimeManager,
-    std::shared_ptr<WorkletRuntime> uiWorkletRuntime)
+    std::shared_ptr<WorkletRuntime> uiWorkletRuntime,
+    std::shared_ptr<UIRuntimeAsyncExecutor> uiRuntimeAsyncExecutor)
     : jsi::HostObject(),
       isDevBundle_(isDevBundle),
       script_(script),
@@ -118,7 +220,8 @@ JSIWorkletsModuleProxy::JSIWorkletsModuleProxy(
       jsScheduler_(jsScheduler),
       uiScheduler_(uiScheduler),
       runtimeManager_(runtimeManager),
-      uiWorkletRuntime_(uiWorkletRuntime) {}
+      uiWorkletRuntime_(uiWorkletRuntime),
+      uiRuntimeAsyncExecutor_(std::move(uiRuntimeAsyncExecutor)) {}
 
 JSIWorkletsModuleProxy::JSIWorkletsModuleProxy(
     const JSIWorkletsModuleProxy &other)
@@ -130,7 +233,10 @@ JSIWorkletsModuleProxy::JSIWorkletsModuleProxy(
       jsScheduler_(other.jsScheduler_),
       uiScheduler_(other.uiScheduler_),
       runtimeManager_(other.runtimeManager_),
-      uiWorkletRuntime_(other.uiWorkletRuntime_) {}
+      uiWorkletRuntime_(other.uiWorkletRuntime_),
+      // The copies are installed in worker runtimes, while the executor
+      // settles its promises on the React Native runtime only.
+      uiRuntimeAsyncExecutor_(nullptr) {}
 
 JSIWorkletsModuleProxy::~JSIWorkletsModuleProxy() = default;
 
@@ -172,8 +278,12 @@ std::vector<jsi::PropNameID> JSIWorkletsModuleProxy::getPropertyNames(
       jsi::PropNameID::forAscii(rt, "makeShareableWorklet"));
 
   propertyNames.emplace_back(jsi::PropNameID::forAscii(rt, "scheduleOnUI"));
+  propertyNames.emplace_back(
+      jsi::PropNameID::forAscii(rt, "getUIQueueMetrics"));
   propertyNames.emplace_back(
       jsi::PropNameID::forAscii(rt, "executeOnUIRuntimeSync"));
+  propertyNames.emplace_back(
+      jsi::PropNameID::forAscii(rt, "executeOnUIRuntimeAsync"));
   propertyNames.emplace_back(
       jsi::PropNameID::forAscii(rt, "createWorkletRuntime"));
   propertyNames.emplace_back(
@@ -425,8 +535,32 @@ jsi::Value JSIWorkletsModuleProxy::get(
             const jsi::Value &thisValue,
             const jsi::Value *args,
             size_t count) {
-          scheduleOnUI(uiScheduler, uiWorkletRuntime, rt, args[0]);
-          return jsi::Value::undefined();
+          if (count < 2) {
+            scheduleOnUI(
+                uiScheduler, uiWorkletRuntime, rt, args[0], std::nullopt);
+            return jsi::Value::undefined();
+          }
+          auto handle = scheduleOnUI(
+              uiScheduler,
+              uiWorkletRuntime,
+              rt,
+              args[0],
+              parseJobOptions(rt, args[1]));
+          return jobHandleToJSValue(rt, handle);
+        });
+  }
+
+  if (name == "getUIQueueMetrics") {
+    return jsi::Function::createFromHostFunction(
+        rt,
+        propName,
+        0,
+        [uiScheduler = uiScheduler_](
+            jsi::Runtime &rt,
+            const jsi::Value &thisValue,
+            const jsi::Value *args,
+            size_t count) {
+          return jobQueueMetricsToJSValue(rt, uiScheduler->getMetrics());
         });
   }
 
@@ -444,6 +578,22 @@ jsi::Value JSIWorkletsModuleProxy::get(
         });
   }
 
+  if (name == "executeOnUIRuntimeAsync") {
+    return jsi::Function::createFromHostFunction(
+        rt,
+        propName,
+        1,
+        [uiRuntimeAsyncExecutor = uiRuntimeAsyncExecutor_,
+         jsScheduler = jsScheduler_](
+            jsi::Runtime &rt,
+            const jsi::Value &thisValue,
+            const jsi::Value *args,
+            size_t count) {
+          return executeOnUIRuntimeAsync(
+              uiRuntimeAsyncExecutor, jsScheduler, rt, args[0]);
+        });
+  }
+
   if (name == "createWorkletRuntime") {
     auto clone = std::make_shared<JSIWorkletsModuleProxy>(*this);
     return jsi::Function::createFromHostFunction(
@@ -485,8 +635,13 @@ jsi::Value JSIWorkletsModuleProxy::get(
            const jsi ::Value &thisValue,
            const jsi::Value *args,
            size_t count) {
-          worklets::scheduleOnRuntime(rt, args[0], args[1]);
-          return jsi::Value::undefined();
+          if (count < 3) {
+            worklets::scheduleOnRuntime(rt, args[0], args[1]);
+            return jsi::Value::undefined();
+          }
+          auto handle = worklets::scheduleOnRuntime(
+              rt, args[0], args[1], parseJobOptions(rt, args[2]));
+          return jobHandleToJSValue(rt, handle);
         });
   }
 
@@ -8,6 +8,7 @@
 #include <worklets/SharedItems/Shareables.h>
 #include <worklets/Tools/Defs.h>
 #include <worklets/WorkletRuntime/RuntimeManager.h>
+#include <worklets/WorkletRuntime/UIRuntimeAsyncExecutor.h>
 #include <worklets/WorkletRuntime/UIRuntimeDecorator.h>
 
 #ifdef __ANDROID__
@@ -34,7 +35,8 @@ class JSIWorkletsModuleProxy : public jsi::HostObject {
       const std::shared_ptr<JSScheduler> &jsScheduler,
       const std::shared_ptr<UIScheduler> &uiScheduler,
       const std::shared_ptr<RuntimeManager> &runtimeManager,
-      std::shared_ptr<WorkletRuntime> uiWorkletRuntime);
+      std::shared_ptr<WorkletRuntime> uiWorkletRuntime,
+      std::shared_ptr<UIRuntimeAsyncExecutor> uiRuntimeAsyncExecutor);
 
   JSIWorkletsModuleProxy(const JSIWorkletsModuleProxy &other);
 
@@ -54,6 +56,8 @@ class JSIWorkletsModuleProxy : public jsi::HostObject {
   const std::shared_ptr<RuntimeManager> runtimeManager_;
   // TODO: Make it non-nullptr on the UI runtime.
   std::weak_ptr<WorkletRuntime> uiWorkletRuntime_;
+  // Only set on the React Native runtime, nullptr on the UI and worker ones
+  const std::shared_ptr<UIRuntimeAsyncExecutor> uiRuntimeAsyncExecutor_;
 };
 
 } // namespace worklets
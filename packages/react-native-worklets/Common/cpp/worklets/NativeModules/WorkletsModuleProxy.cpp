@@ -47,6 +47,10 @@ WorkletsModuleProxy::WorkletsModuleProxy(
       isDevBundle_,
       script_,
       sourceUrl_);
+  uiWorkletRuntime_->setUIScheduler(uiScheduler_);
+  uiScheduler_->setUIRuntimeMutex(uiWorkletRuntime_->getRuntimeMutex());
+  uiRuntimeAsyncExecutor_ = std::make_shared<UIRuntimeAsyncExecutor>(
+      uiWorkletRuntime_, uiScheduler_);
 
   animationFrameBatchinator_ = std::make_shared<AnimationFrameBatchinator>(
       uiWorkletRuntime_->getJSIRuntime(),
@@ -67,11 +71,13 @@ WorkletsModuleProxy::createJSIWorkletsModuleProxy() const {
       jsScheduler_,
       uiScheduler_,
       runtimeManager_,
-      uiWorkletRuntime_);
+      uiWorkletRuntime_,
+      uiRuntimeAsyncExecutor_);
 }
 
 WorkletsModuleProxy::~WorkletsModuleProxy() {
   animationFrameBatchinator_.reset();
+  uiRuntimeAsyncExecutor_.reset();
   jsQueue_->quitSynchronous();
   uiWorkletRuntime_.reset();
 }
@@ -8,6 +8,7 @@
 #include <worklets/Tools/SingleInstanceChecker.h>
 #include <worklets/Tools/UIScheduler.h>
 #include <worklets/WorkletRuntime/RuntimeManager.h>
+#include <worklets/WorkletRuntime/UIRuntimeAsyncExecutor.h>
 #include <worklets/WorkletRuntime/WorkletRuntime.h>
 
 #include <memory>
@@ -48,6 +49,11 @@ class WorkletsModuleProxy
     return uiWorkletRuntime_;
   }
 
+  [[nodiscard]] inline std::shared_ptr<UIRuntimeAsyncExecutor>
+  getUIRuntimeAsyncExecutor() const {
+    return uiRuntimeAsyncExecutor_;
+  }
+
   [[nodiscard]] std::shared_ptr<JSIWorkletsModuleProxy>
   createJSIWorkletsModuleProxy() const;
 
@@ -64,6 +70,7 @@ class WorkletsModuleProxy
   const std::string sourceUrl_;
   const std::shared_ptr<RuntimeManager> runtimeManager_;
   std::shared_ptr<WorkletRuntime> uiWorkletRuntime_;
+  std::shared_ptr<UIRuntimeAsyncExecutor> uiRuntimeAsyncExecutor_;
   std::shared_ptr<AnimationFrameBatchinator> animationFrameBatchinator_;
 #ifndef NDEBUG
   SingleInstanceChecker<WorkletsModuleProxy> singleInstanceChecker_;
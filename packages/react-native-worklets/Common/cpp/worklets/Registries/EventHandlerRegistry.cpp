@@ -76,7 +76,9 @@ void EventHandlerRegistry::processEvent(
 
   jsi::Runtime &rt = uiWorkletRuntime->getJSIRuntime();
   eventPayload.asObject(rt).setProperty(
-      rt, "eventName", jsi::String::createFromUtf8(rt, eventName));
+      rt,
+      "eventName",
+      eventNames_.get(rt, uiWorkletRuntime->getGeneration(), eventName));
   for (auto handler : handlersForEvent) {
     handler->process(uiWorkletRuntime, eventTimestamp, eventPayload);
   }
@@ -91,4 +93,28 @@ bool EventHandlerRegistry::isAnyHandlerWaitingForEvent(
   return it != eventMappingsWithTag.end() && !it->second.empty();
 }
 
+size_t EventHandlerRegistry::getHandlersCount() {
+  const std::lock_guard<std::mutex> lock(instanceMutex);
+  return eventHandlers.size();
+}
+
+size_t EventHandlerRegistry::getRetainedBytes() {
+  const std::lock_guard<std::mutex> lock(instanceMutex);
+
+  // Every handler is stored in the handlers map and in one of the mappings
+  using HandlerEntry =
+      std::pair<const uint64_t, std::shared_ptr<WorkletEventHandler>>;
+  size_t bytes = eventHandlers.size() *
+      (2 * sizeof(HandlerEntry) + sizeof(WorkletEventHandler));
+  for (const auto &[eventHash, _] : eventMappingsWithTag) {
+    bytes += sizeof(decltype(eventMappingsWithTag)::value_type) +
+        eventHash.second.capacity();
+  }
+  for (const auto &[eventName, _] : eventMappingsWithoutTag) {
+    bytes += sizeof(decltype(eventMappingsWithoutTag)::value_type) +
+        eventName.capacity();
+  }
+  return bytes;
+}
+
 } // namespace worklets
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <worklets/Tools/RuntimeStringCache.h>
 #include <worklets/WorkletRuntime/WorkletRuntime.h>
 
 #include <jsi/jsi.h>
@@ -29,6 +30,11 @@ class EventHandlerRegistry {
   std::map<uint64_t, std::shared_ptr<WorkletEventHandler>> eventHandlers;
   std::mutex instanceMutex;
 
+  // Event name strings are created on the UI runtime once per event name and
+  // reused for every event. They are only accessed from `processEvent`, which
+  // runs on the UI thread.
+  RuntimeStringCache eventNames_;
+
  public:
   void registerEventHandler(
       const std::shared_ptr<WorkletEventHandler> &eventHandler);
@@ -44,6 +50,11 @@ class EventHandlerRegistry {
   bool isAnyHandlerWaitingForEvent(
       const std::string &eventName,
       const int emitterReactTag);
+
+  size_t getHandlersCount();
+  // Approximate number of bytes retained by the registry entries (handler
+  // worklets are shareables, which aren't measured)
+  size_t getRetainedBytes();
 };
 
 } // namespace worklets
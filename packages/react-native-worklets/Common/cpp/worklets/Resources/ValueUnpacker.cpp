@@ -25,6 +25,8 @@ const char ValueUnpackerCode[] =
         workletFun = global.evalWithSourceMap('(' + initData.code + '\n)', initData.location, initData.sourceMap);
       } else if (global.evalWithSourceUrl) {
         workletFun = global.evalWithSourceUrl('(' + initData.code + '\n)', "worklet_".concat(workletHash));
+      } else if (global._evalWorklet) {
+        workletFun = global._evalWorklet('(' + initData.code + '\n)', workletHash);
       } else {
         workletFun = eval('(' + initData.code + '\n)');
       }
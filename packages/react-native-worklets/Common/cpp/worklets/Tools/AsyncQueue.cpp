@@ -17,13 +17,14 @@ AsyncQueue::AsyncQueue(std::string name)
       if (!state->running) {
         return;
       }
-      if (state->queue.empty()) {
+      // Cancelled and expired jobs are dropped here, so `pop` may come back
+      // empty even though the queue wasn't
+      auto job = state->queue.pop();
+      if (!job.has_value()) {
         continue;
       }
-      auto job = std::move(state->queue.front());
-      state->queue.pop();
       lock.unlock();
-      job();
+      job.value()();
     }
   });
 #ifdef ANDROID
@@ -36,17 +37,30 @@ AsyncQueue::~AsyncQueue() {
   {
     std::unique_lock<std::mutex> lock(state_->mutex);
     state_->running = false;
-    state_->queue = {};
+    state_->queue.clear();
   }
   state_->cv.notify_all();
 }
 
 void AsyncQueue::push(std::function<void()> &&job) {
+  push(std::move(job), {});
+}
+
+std::shared_ptr<JobHandle> AsyncQueue::push(
+    std::function<void()> &&job,
+    const JobOptions &options) {
+  std::shared_ptr<JobHandle> handle;
   {
     std::unique_lock<std::mutex> lock(state_->mutex);
-    state_->queue.emplace(job);
+    handle = state_->queue.push(std::move(job), options);
   }
   state_->cv.notify_one();
+  return handle;
+}
+
+JobQueueMetrics AsyncQueue::getMetrics() const {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  return state_->queue.getMetrics();
 }
 
 } // namespace worklets
@@ -1,11 +1,12 @@
 #pragma once
 
+#include <worklets/Tools/JobQueue.h>
+
 #include <jsi/jsi.h>
 
 #include <atomic>
 #include <condition_variable>
 #include <memory>
-#include <queue>
 #include <string>
 #include <thread>
 #include <utility>
@@ -17,7 +18,7 @@ struct AsyncQueueState {
   std::atomic_bool running{true};
   std::mutex mutex;
   std::condition_variable cv;
-  std::queue<std::function<void()>> queue;
+  JobQueue queue;
 };
 
 class AsyncQueue {
@@ -28,6 +29,12 @@ class AsyncQueue {
 
   void push(std::function<void()> &&job);
 
+  std::shared_ptr<JobHandle> push(
+      std::function<void()> &&job,
+      const JobOptions &options);
+
+  JobQueueMetrics getMetrics() const;
+
  private:
   const std::shared_ptr<AsyncQueueState> state_;
 };
@@ -0,0 +1,79 @@
+#include <worklets/Tools/JobQueue.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace worklets {
+
+std::shared_ptr<JobHandle> JobQueue::push(
+    std::function<void()> &&job,
+    const JobOptions &options) {
+  auto handle = std::make_shared<JobHandle>();
+  queues_[static_cast<size_t>(options.priority)].push_back(
+      {.job = std::move(job),
+       .handle = handle,
+       .deadline = options.deadline,
+       .enqueuedAt = JobClock::now()});
+  return handle;
+}
+
+std::optional<std::function<void()>> JobQueue::pop() {
+  const auto now = JobClock::now();
+
+  for (auto &queue : queues_) {
+    while (!queue.empty()) {
+      auto entry = std::move(queue.front());
+      queue.pop_front();
+
+      if (entry.handle->isCancelled()) {
+        cancelledJobs_++;
+        continue;
+      }
+      if (entry.deadline.has_value() && entry.deadline.value() < now) {
+        expiredJobs_++;
+        continue;
+      }
+
+      const double waitMs =
+          std::chrono::duration<double, std::milli>(now - entry.enqueuedAt)
+              .count();
+      totalWaitMs_ += waitMs;
+      maxWaitMs_ = std::max(maxWaitMs_, waitMs);
+      executedJobs_++;
+      return std::move(entry.job);
+    }
+  }
+
+  return std::nullopt;
+}
+
+bool JobQueue::empty() const {
+  return std::all_of(queues_.begin(), queues_.end(), [](const auto &queue) {
+    return queue.empty();
+  });
+}
+
+void JobQueue::clear() {
+  for (auto &queue : queues_) {
+    queue.clear();
+  }
+}
+
+JobQueueMetrics JobQueue::getMetrics() const {
+  size_t depth = 0;
+  for (const auto &queue : queues_) {
+    depth += queue.size();
+  }
+
+  return {
+      .depth = depth,
+      .executedJobs = executedJobs_,
+      .cancelledJobs = cancelledJobs_,
+      .expiredJobs = expiredJobs_,
+      .averageWaitMs =
+          executedJobs_ > 0 ? totalWaitMs_ / static_cast<double>(executedJobs_)
+                            : 0,
+      .maxWaitMs = maxWaitMs_};
+}
+
+} // namespace worklets
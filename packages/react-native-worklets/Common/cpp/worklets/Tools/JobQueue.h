@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace worklets {
+
+using JobClock = std::chrono::steady_clock;
+
+enum class JobPriority : uint8_t {
+  High = 0,
+  Normal = 1,
+  Low = 2,
+};
+
+inline constexpr size_t JOB_PRIORITIES_COUNT = 3;
+
+struct JobOptions {
+  JobPriority priority = JobPriority::Normal;
+  // Jobs that haven't started before the deadline are dropped
+  std::optional<JobClock::time_point> deadline;
+};
+
+// Handle returned to the scheduling side. Cancellation is cooperative: a
+// cancelled job is dropped when it reaches the front of the queue, but a job
+// that is already running is never interrupted.
+class JobHandle {
+ public:
+  void cancel() {
+    cancelled_ = true;
+  }
+
+  bool isCancelled() const {
+    return cancelled_;
+  }
+
+ private:
+  std::atomic_bool cancelled_{false};
+};
+
+struct JobQueueMetrics {
+  size_t depth = 0;
+  uint64_t executedJobs = 0;
+  uint64_t cancelledJobs = 0;
+  uint64_t expiredJobs = 0;
+  double averageWaitMs = 0;
+  double maxWaitMs = 0;
+};
+
+// Priority queue of jobs with cancellation and deadline support. It is not
+// thread safe - the owner is responsible for guarding it with its own mutex.
+class JobQueue {
+ public:
+  std::shared_ptr<JobHandle> push(
+      std::function<void()> &&job,
+      const JobOptions &options = {});
+
+  // Returns the next job that should be executed, dropping all cancelled and
+  // expired jobs that precede it.
+  std::optional<std::function<void()>> pop();
+
+  bool empty() const;
+  void clear();
+
+  JobQueueMetrics getMetrics() const;
+
+ private:
+  struct Entry {
+    std::function<void()> job;
+    std::shared_ptr<JobHandle> handle;
+    std::optional<JobClock::time_point> deadline;
+    JobClock::time_point enqueuedAt;
+  };
+
+  std::array<std::deque<Entry>, JOB_PRIORITIES_COUNT> queues_;
+  uint64_t executedJobs_ = 0;
+  uint64_t cancelledJobs_ = 0;
+  uint64_t expiredJobs_ = 0;
+  double totalWaitMs_ = 0;
+  double maxWaitMs_ = 0;
+};
+
+} // namespace worklets
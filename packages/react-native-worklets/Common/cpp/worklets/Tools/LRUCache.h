@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace worklets {
+
+// Map that keeps at most `capacity` entries, evicting the least recently used
+// one when full. Keys are stored once, in the recency list, and the index only
+// refers to them, so large keys (e.g. code strings) aren't duplicated. It is
+// not thread safe - the owner is responsible for guarding it with its own
+// mutex.
+template <typename Key, typename Value>
+class LRUCache {
+ public:
+  explicit LRUCache(const size_t capacity)
+      : capacity_(std::max<size_t>(capacity, 1)) {}
+
+  // Returns nullptr when there is no entry for the key. The pointer is valid
+  // until the next insertion.
+  Value *find(const Key &key) {
+    const auto it = index_.find(std::cref(key));
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  // Keeps the existing value if there already is an entry for the key
+  Value &emplace(Key &&key, Value &&value) {
+    if (auto *existing = find(key)) {
+      return *existing;
+    }
+    entries_.emplace_front(std::move(key), std::move(value));
+    index_.emplace(std::cref(entries_.front().first), entries_.begin());
+    if (entries_.size() > capacity_) {
+      index_.erase(std::cref(entries_.back().first));
+      entries_.pop_back();
+    }
+    return entries_.front().second;
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+ private:
+  using Entries = std::list<std::pair<const Key, Value>>;
+  using KeyRef = std::reference_wrapper<const Key>;
+
+  struct KeyRefHash {
+    size_t operator()(const KeyRef &key) const {
+      return std::hash<Key>{}(key.get());
+    }
+  };
+
+  struct KeyRefEqual {
+    bool operator()(const KeyRef &lhs, const KeyRef &rhs) const {
+      return lhs.get() == rhs.get();
+    }
+  };
+
+  const size_t capacity_;
+  Entries entries_;
+  std::unordered_map<
+      KeyRef,
+      typename Entries::iterator,
+      KeyRefHash,
+      KeyRefEqual>
+      index_;
+};
+
+} // namespace worklets
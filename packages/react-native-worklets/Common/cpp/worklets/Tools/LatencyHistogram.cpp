@@ -0,0 +1,84 @@
+#include <worklets/Tools/LatencyHistogram.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace worklets {
+
+namespace {
+
+constexpr double NANOSECONDS_IN_MILLISECOND = 1000000.0;
+
+size_t getBucketIndex(const int64_t latencyNs) {
+  if (latencyNs <= 1) {
+    return 0;
+  }
+  const auto index =
+      static_cast<size_t>(std::bit_width(static_cast<uint64_t>(latencyNs))) -
+      1;
+  return std::min(index, LATENCY_HISTOGRAM_BUCKETS_COUNT - 1);
+}
+
+} // namespace
+
+void LatencyHistogram::record(const std::chrono::nanoseconds latency) {
+  const auto latencyNs = std::max<int64_t>(latency.count(), 0);
+  buckets_[getBucketIndex(latencyNs)].fetch_add(1, std::memory_order_relaxed);
+
+  auto maxNs = maxNs_.load(std::memory_order_relaxed);
+  while (latencyNs > maxNs &&
+         !maxNs_.compare_exchange_weak(
+             maxNs, latencyNs, std::memory_order_relaxed)) {
+  }
+}
+
+LatencyPercentiles LatencyHistogram::getPercentiles() const {
+  std::array<uint64_t, LATENCY_HISTOGRAM_BUCKETS_COUNT> buckets{};
+  uint64_t count = 0;
+  for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i) {
+    buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+    count += buckets[i];
+  }
+  if (count == 0) {
+    return {};
+  }
+
+  const auto maxMs =
+      static_cast<double>(maxNs_.load(std::memory_order_relaxed)) /
+      NANOSECONDS_IN_MILLISECOND;
+  return {
+      .count = count,
+      .p50Ms = std::min(getPercentileMs(buckets, count, 0.5), maxMs),
+      .p90Ms = std::min(getPercentileMs(buckets, count, 0.9), maxMs),
+      .p99Ms = std::min(getPercentileMs(buckets, count, 0.99), maxMs),
+      .maxMs = maxMs,
+  };
+}
+
+void LatencyHistogram::reset() {
+  for (auto &bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  maxNs_.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getPercentileMs(
+    const std::array<uint64_t, LATENCY_HISTOGRAM_BUCKETS_COUNT> &buckets,
+    const uint64_t count,
+    const double percentile) const {
+  const auto rank = static_cast<uint64_t>(
+      std::ceil(percentile * static_cast<double>(count)));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return std::ldexp(1.0, static_cast<int>(i) + 1) /
+          NANOSECONDS_IN_MILLISECOND;
+    }
+  }
+  return std::ldexp(1.0, static_cast<int>(LATENCY_HISTOGRAM_BUCKETS_COUNT)) /
+      NANOSECONDS_IN_MILLISECOND;
+}
+
+} // namespace worklets
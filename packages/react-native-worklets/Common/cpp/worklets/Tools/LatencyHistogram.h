@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace worklets {
+
+inline constexpr size_t LATENCY_HISTOGRAM_BUCKETS_COUNT = 48;
+
+struct LatencyPercentiles {
+  uint64_t count = 0;
+  double p50Ms = 0;
+  double p90Ms = 0;
+  double p99Ms = 0;
+  double maxMs = 0;
+};
+
+// Lock-free histogram of latencies with power-of-two buckets, i.e. bucket `i`
+// counts samples in [2^i, 2^(i+1)) nanoseconds. Percentiles are reported as
+// the upper bounds of their buckets, so they are accurate up to a factor of 2,
+// which is enough to tell a frame-sized stall from a microsecond one.
+class LatencyHistogram {
+ public:
+  void record(std::chrono::nanoseconds latency);
+
+  LatencyPercentiles getPercentiles() const;
+
+  void reset();
+
+ private:
+  double getPercentileMs(
+      const std::array<uint64_t, LATENCY_HISTOGRAM_BUCKETS_COUNT> &buckets,
+      uint64_t count,
+      double percentile) const;
+
+  std::array<std::atomic<uint64_t>, LATENCY_HISTOGRAM_BUCKETS_COUNT>
+      buckets_{};
+  std::atomic<int64_t> maxNs_{0};
+};
+
+} // namespace worklets
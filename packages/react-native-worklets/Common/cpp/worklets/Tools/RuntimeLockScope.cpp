@@ -0,0 +1,25 @@
+#include <worklets/Tools/RuntimeLockScope.h>
+
+namespace worklets {
+
+namespace {
+thread_local const std::recursive_mutex *currentScopeMutex = nullptr;
+} // namespace
+
+RuntimeLockScope::RuntimeLockScope(std::recursive_mutex &mutex)
+    : mutex_(mutex), previousMutex_(currentScopeMutex) {
+  mutex_.lock();
+  currentScopeMutex = &mutex_;
+}
+
+RuntimeLockScope::~RuntimeLockScope() {
+  currentScopeMutex = previousMutex_;
+  mutex_.unlock();
+}
+
+bool RuntimeLockScope::isHeldByCurrentThread(
+    const std::recursive_mutex &mutex) {
+  return currentScopeMutex == &mutex;
+}
+
+} // namespace worklets
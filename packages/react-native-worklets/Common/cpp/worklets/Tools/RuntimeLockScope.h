@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+namespace worklets {
+
+// Holds the runtime mutex for the whole scope. While the scope is alive on
+// the current thread, JSI calls on a lockable runtime guarded by the same
+// mutex skip their per-call lock and unlock, which matters in hot loops that
+// make many JSI calls in a row (frame callbacks, event handlers, props
+// updates).
+class RuntimeLockScope {
+ public:
+  explicit RuntimeLockScope(std::recursive_mutex &mutex);
+  ~RuntimeLockScope();
+
+  RuntimeLockScope(const RuntimeLockScope &) = delete;
+  RuntimeLockScope &operator=(const RuntimeLockScope &) = delete;
+
+  static bool isHeldByCurrentThread(const std::recursive_mutex &mutex);
+
+ private:
+  std::recursive_mutex &mutex_;
+  const std::recursive_mutex *previousMutex_;
+};
+
+// Locks the runtime around a single JSI call of a lockable runtime, unless
+// the current thread already holds the mutex through a RuntimeLockScope
+class AroundLock {
+  const std::shared_ptr<std::recursive_mutex> mutex_;
+
+ public:
+  explicit AroundLock(const std::shared_ptr<std::recursive_mutex> &mutex)
+      : mutex_(mutex) {}
+
+  void before() const {
+    if (RuntimeLockScope::isHeldByCurrentThread(*mutex_)) {
+      return;
+    }
+    mutex_->lock();
+  }
+
+  void after() const {
+    if (RuntimeLockScope::isHeldByCurrentThread(*mutex_)) {
+      return;
+    }
+    mutex_->unlock();
+  }
+};
+
+} // namespace worklets
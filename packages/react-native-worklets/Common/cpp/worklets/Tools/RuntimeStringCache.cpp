@@ -0,0 +1,48 @@
+#include <worklets/SharedItems/Shareables.h>
+#include <worklets/Tools/RuntimeStringCache.h>
+
+#include <memory>
+#include <string>
+
+namespace worklets {
+
+RuntimeStringCache::~RuntimeStringCache() {
+  for (auto &[str, value] : strings_) {
+    cleanupIfRuntimeExists(rt_, value);
+  }
+}
+
+jsi::String RuntimeStringCache::get(
+    jsi::Runtime &rt,
+    const uint64_t runtimeGeneration,
+    const std::string &str) {
+  if (runtimeGeneration_ != runtimeGeneration) {
+    reset(rt, runtimeGeneration);
+  }
+
+  auto &value = strings_[str];
+  if (!value) {
+    value =
+        std::make_unique<jsi::Value>(jsi::String::createFromUtf8(rt, str));
+  }
+  return value->getString(rt);
+}
+
+void RuntimeStringCache::reset(
+    jsi::Runtime &rt,
+    const uint64_t runtimeGeneration) {
+  for (auto &[str, value] : strings_) {
+    if (rt_ == &rt) {
+      // The new runtime took the address of the one that created the strings,
+      // so that one is gone, but the registry would consider it alive
+      value.release();
+    } else {
+      cleanupIfRuntimeExists(rt_, value);
+    }
+  }
+  strings_.clear();
+  rt_ = &rt;
+  runtimeGeneration_ = runtimeGeneration;
+}
+
+} // namespace worklets
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+using namespace facebook;
+
+namespace worklets {
+
+// JS strings created once per runtime and reused, e.g. for event names or
+// the keys of event payloads. The cache is reset when it's used with a runtime
+// of another generation (see `WorkletRuntime::getGeneration`). It is not
+// thread safe - it's meant to be used only from the thread of the runtime.
+class RuntimeStringCache {
+ public:
+  ~RuntimeStringCache();
+
+  jsi::String get(
+      jsi::Runtime &rt,
+      uint64_t runtimeGeneration,
+      const std::string &str);
+
+ private:
+  void reset(jsi::Runtime &rt, uint64_t runtimeGeneration);
+
+  jsi::Runtime *rt_ = nullptr;
+  uint64_t runtimeGeneration_ = 0;
+  std::unordered_map<std::string, std::unique_ptr<jsi::Value>> strings_;
+};
+
+} // namespace worklets
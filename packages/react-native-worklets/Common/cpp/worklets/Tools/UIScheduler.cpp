@@ -5,15 +5,58 @@
 namespace worklets {
 
 void UIScheduler::scheduleOnUI(std::function<void()> job) {
-  uiJobs_.push(std::move(job));
+  scheduleJobOnUI(std::move(job), {});
+}
+
+std::shared_ptr<JobHandle> UIScheduler::scheduleJobOnUI(
+    std::function<void()> job,
+    const JobOptions &options) {
+  std::shared_ptr<JobHandle> handle;
+  {
+    std::lock_guard<std::mutex> lock(uiJobsMutex_);
+    handle = uiJobs_.push(std::move(job), options);
+  }
+  requestTriggerUI();
+  return handle;
 }
 
 void UIScheduler::triggerUI() {
   scheduledOnUI_ = false;
-  while (!uiJobs_.empty()) {
-    const auto job = uiJobs_.pop();
-    job();
+
+  std::shared_ptr<std::recursive_mutex> uiRuntimeMutex;
+  {
+    std::lock_guard<std::mutex> lock(uiJobsMutex_);
+    if (uiJobs_.empty()) {
+      return;
+    }
+    uiRuntimeMutex = uiRuntimeMutex_;
+  }
+
+  while (const auto job = popJob()) {
+    // The lock is held for one job at a time, so that other threads (e.g.
+    // `executeOnUIRuntimeSync` from JS) can take it in between jobs
+    std::optional<RuntimeLockScope> lockScope;
+    if (uiRuntimeMutex) {
+      lockScope.emplace(*uiRuntimeMutex);
+    }
+    job.value()();
   }
 }
 
+void UIScheduler::setUIRuntimeMutex(
+    const std::shared_ptr<std::recursive_mutex> &uiRuntimeMutex) {
+  std::lock_guard<std::mutex> lock(uiJobsMutex_);
+  uiRuntimeMutex_ = uiRuntimeMutex;
+}
+
+JobQueueMetrics UIScheduler::getMetrics() const {
+  std::lock_guard<std::mutex> lock(uiJobsMutex_);
+  return uiJobs_.getMetrics();
+}
+
+std::optional<std::function<void()>> UIScheduler::popJob() {
+  std::lock_guard<std::mutex> lock(uiJobsMutex_);
+  return uiJobs_.pop();
+}
+
 } // namespace worklets
@@ -1,22 +1,43 @@
 #pragma once
 
-#include <worklets/Tools/ThreadSafeQueue.h>
+#include <worklets/Tools/JobQueue.h>
+#include <worklets/Tools/RuntimeLockScope.h>
 
 #include <ReactCommon/CallInvoker.h>
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace worklets {
 
 class UIScheduler {
  public:
   virtual void scheduleOnUI(std::function<void()> job);
+  std::shared_ptr<JobHandle> scheduleJobOnUI(
+      std::function<void()> job,
+      const JobOptions &options);
   virtual void triggerUI();
+  JobQueueMetrics getMetrics() const;
+  // Makes `triggerUI` hold the UI runtime lock for the whole duration of each
+  // job
+  void setUIRuntimeMutex(
+      const std::shared_ptr<std::recursive_mutex> &uiRuntimeMutex);
   virtual ~UIScheduler() = default;
 
  protected:
+  // Called after a job was enqueued. Platform schedulers override it to
+  // request `triggerUI` on the UI thread.
+  virtual void requestTriggerUI() {}
+
   std::atomic<bool> scheduledOnUI_{false};
-  ThreadSafeQueue<std::function<void()>> uiJobs_;
+
+ private:
+  std::optional<std::function<void()>> popJob();
+
+  mutable std::mutex uiJobsMutex_;
+  JobQueue uiJobs_;
+  std::shared_ptr<std::recursive_mutex> uiRuntimeMutex_;
 };
 
 } // namespace worklets
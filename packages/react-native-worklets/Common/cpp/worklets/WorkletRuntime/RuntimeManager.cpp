@@ -65,7 +65,8 @@ std::shared_ptr<WorkletRuntime> RuntimeManager::createWorkletRuntime(
       true /* supportsLocking */,
       isDevBundle,
       script,
-      sourceUrl);
+      sourceUrl,
+      workletCodeCache_);
 
   if (!initializer.isUndefined()) {
     auto initializerShareable = extractShareableOrThrow<ShareableWorklet>(
@@ -96,7 +97,8 @@ std::shared_ptr<WorkletRuntime> RuntimeManager::createUIRuntime(
       true /* supportsLocking */,
       isDevBundle,
       script,
-      sourceUrl);
+      sourceUrl,
+      workletCodeCache_);
   std::unique_lock lock(weakRuntimesMutex_);
   weakRuntimes_[uiRuntimeId] = uiRuntime;
   return uiRuntime;
@@ -61,6 +61,8 @@ class RuntimeManager {
   std::map<uint64_t, std::weak_ptr<WorkletRuntime>> weakRuntimes_;
   std::shared_mutex weakRuntimesMutex_;
   std::map<std::string, uint64_t> nameToRuntimeId_;
+  const std::shared_ptr<WorkletCodeCache> workletCodeCache_ =
+      std::make_shared<WorkletCodeCache>();
 };
 
 } // namespace worklets
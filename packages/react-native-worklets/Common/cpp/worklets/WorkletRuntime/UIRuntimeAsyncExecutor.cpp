@@ -0,0 +1,109 @@
+#include <worklets/Tools/Defs.h>
+#include <worklets/WorkletRuntime/UIRuntimeAsyncExecutor.h>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace worklets {
+
+UIRuntimeAsyncExecutor::UIRuntimeAsyncExecutor(
+    const std::weak_ptr<WorkletRuntime> &uiWorkletRuntime,
+    const std::shared_ptr<UIScheduler> &uiScheduler)
+    : uiWorkletRuntime_(uiWorkletRuntime), uiScheduler_(uiScheduler) {}
+
+void UIRuntimeAsyncExecutor::execute(
+    const std::shared_ptr<ShareableWorklet> &shareableWorklet,
+    Callback &&callback) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pendingRequests_.push_back(
+        {.shareableWorklet = shareableWorklet,
+         .callback = std::move(callback),
+         .requestedAt = std::chrono::steady_clock::now()});
+    if (flushScheduled_) {
+      return;
+    }
+    flushScheduled_ = true;
+  }
+
+  uiScheduler_->scheduleOnUI([weakThis = weak_from_this()]() {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->flush();
+    }
+  });
+}
+
+std::future<std::shared_ptr<Shareable>> UIRuntimeAsyncExecutor::execute(
+    const std::shared_ptr<ShareableWorklet> &shareableWorklet) {
+  auto promise = std::make_shared<std::promise<std::shared_ptr<Shareable>>>();
+  auto future = promise->get_future();
+  execute(
+      shareableWorklet,
+      [promise](
+          const std::shared_ptr<Shareable> &result,
+          const std::exception_ptr &error) {
+        if (error) {
+          promise->set_exception(error);
+        } else {
+          promise->set_value(result);
+        }
+      });
+  return future;
+}
+
+UIRuntimeAsyncExecutorMetrics UIRuntimeAsyncExecutor::getMetrics() const {
+  return {
+      .waitLatency = waitLatency_.getPercentiles(),
+      .executionLatency = executionLatency_.getPercentiles(),
+  };
+}
+
+void UIRuntimeAsyncExecutor::flush() {
+  std::vector<Request> requests;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests.swap(pendingRequests_);
+    flushScheduled_ = false;
+  }
+
+  const auto uiWorkletRuntime = uiWorkletRuntime_.lock();
+  if (!uiWorkletRuntime) {
+    const auto error = std::make_exception_ptr(
+        std::runtime_error("[Worklets] UI runtime is no longer available."));
+    for (const auto &request : requests) {
+      request.callback(nullptr, error);
+    }
+    return;
+  }
+
+  const auto lockScope = uiWorkletRuntime->lockScope();
+  jsi::Runtime &uiRuntime = uiWorkletRuntime->getJSIRuntime();
+
+  for (const auto &request : requests) {
+    const auto startedAt = std::chrono::steady_clock::now();
+    waitLatency_.record(startedAt - request.requestedAt);
+
+    std::shared_ptr<Shareable> shareableResult;
+    std::exception_ptr error;
+    try {
+#if JS_RUNTIME_HERMES
+      const auto scope = jsi::Scope(uiRuntime);
+#endif // JS_RUNTIME_HERMES
+      // The worklet is called without the call guard, which would report
+      // the error to LogBox and return undefined instead of rethrowing it,
+      // so that the promise is rejected with the actual error.
+      const auto result = request.shareableWorklet->toJSValue(uiRuntime)
+                              .asObject(uiRuntime)
+                              .asFunction(uiRuntime)
+                              .call(uiRuntime);
+      shareableResult = extractShareableOrThrow(uiRuntime, result);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    executionLatency_.record(std::chrono::steady_clock::now() - startedAt);
+    request.callback(shareableResult, error);
+  }
+}
+
+} // namespace worklets
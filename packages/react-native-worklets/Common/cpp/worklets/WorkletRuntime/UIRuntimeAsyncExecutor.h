@@ -0,0 +1,68 @@
+#pragma once
+
+#include <worklets/SharedItems/Shareables.h>
+#include <worklets/Tools/LatencyHistogram.h>
+#include <worklets/Tools/UIScheduler.h>
+#include <worklets/WorkletRuntime/WorkletRuntime.h>
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace worklets {
+
+struct UIRuntimeAsyncExecutorMetrics {
+  // From the request to the start of its execution on the UI thread
+  LatencyPercentiles waitLatency;
+  // Execution of the worklet and the conversion of its result
+  LatencyPercentiles executionLatency;
+};
+
+// Non-blocking counterpart of `WorkletRuntime::executeSync`. Worklets are
+// scheduled on the UI thread instead of taking the UI runtime lock from the
+// calling thread. All requests made before the next UI turn are executed in
+// a single batch, under a single runtime lock.
+class UIRuntimeAsyncExecutor
+    : public std::enable_shared_from_this<UIRuntimeAsyncExecutor> {
+ public:
+  using Callback = std::function<void(
+      const std::shared_ptr<Shareable> &result,
+      const std::exception_ptr &error)>;
+
+  UIRuntimeAsyncExecutor(
+      const std::weak_ptr<WorkletRuntime> &uiWorkletRuntime,
+      const std::shared_ptr<UIScheduler> &uiScheduler);
+
+  // The callback is called on the UI thread
+  void execute(
+      const std::shared_ptr<ShareableWorklet> &shareableWorklet,
+      Callback &&callback);
+
+  std::future<std::shared_ptr<Shareable>> execute(
+      const std::shared_ptr<ShareableWorklet> &shareableWorklet);
+
+  UIRuntimeAsyncExecutorMetrics getMetrics() const;
+
+ private:
+  struct Request {
+    std::shared_ptr<ShareableWorklet> shareableWorklet;
+    Callback callback;
+    std::chrono::steady_clock::time_point requestedAt;
+  };
+
+  void flush();
+
+  const std::weak_ptr<WorkletRuntime> uiWorkletRuntime_;
+  const std::shared_ptr<UIScheduler> uiScheduler_;
+  std::mutex mutex_;
+  std::vector<Request> pendingRequests_;
+  bool flushScheduled_ = false;
+  LatencyHistogram waitLatency_;
+  LatencyHistogram executionLatency_;
+};
+
+} // namespace worklets
@@ -0,0 +1,50 @@
+#include <worklets/Resources/ValueUnpacker.h>
+#include <worklets/WorkletRuntime/WorkletCodeCache.h>
+
+#include <memory>
+#include <string>
+
+namespace worklets {
+
+WorkletCodeCache::WorkletCodeCache(const size_t capacity)
+    : preparedWorklets_(capacity) {}
+
+std::shared_ptr<const jsi::PreparedJavaScript>
+WorkletCodeCache::getOrPrepareWorklet(
+    jsi::Runtime &rt,
+    const uint64_t workletHash,
+    const std::string &code) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (const auto *preparedWorklet = preparedWorklets_.find(code)) {
+      return *preparedWorklet;
+    }
+  }
+
+  // Preparing can take a while, so it's done without holding the lock. If two
+  // runtimes prepare the same worklet at once, the first result is kept.
+  auto prepared = rt.prepareJavaScript(
+      std::make_shared<const jsi::StringBuffer>(code),
+      "worklet_" + std::to_string(workletHash));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  return preparedWorklets_.emplace(std::string(code), std::move(prepared));
+}
+
+std::shared_ptr<const jsi::PreparedJavaScript>
+WorkletCodeCache::getOrPrepareValueUnpacker(jsi::Runtime &rt) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!preparedValueUnpacker_) {
+    preparedValueUnpacker_ = rt.prepareJavaScript(
+        std::make_shared<const jsi::StringBuffer>(ValueUnpackerCode),
+        "valueUnpacker");
+  }
+  return preparedValueUnpacker_;
+}
+
+size_t WorkletCodeCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return preparedWorklets_.size();
+}
+
+} // namespace worklets
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <worklets/Tools/LRUCache.h>
+
+#include <jsi/jsi.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using namespace facebook;
+
+namespace worklets {
+
+inline constexpr size_t WORKLET_CODE_CACHE_CAPACITY = 512;
+
+// Worklet code prepared (parsed and compiled to bytecode on Hermes) once and
+// shared by all worklet runtimes. `jsi::PreparedJavaScript` can be evaluated
+// in any runtime of the same concrete type as the one that prepared it, so
+// a worklet used on several runtimes is compiled only once.
+//
+// Entries are keyed by the code itself, as worklet hashes are converted from
+// JS numbers and may collide, and only the most recently used ones are kept.
+class WorkletCodeCache {
+ public:
+  explicit WorkletCodeCache(size_t capacity = WORKLET_CODE_CACHE_CAPACITY);
+
+  std::shared_ptr<const jsi::PreparedJavaScript> getOrPrepareWorklet(
+      jsi::Runtime &rt,
+      uint64_t workletHash,
+      const std::string &code);
+
+  std::shared_ptr<const jsi::PreparedJavaScript> getOrPrepareValueUnpacker(
+      jsi::Runtime &rt);
+
+  size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;
+  LRUCache<std::string, std::shared_ptr<const jsi::PreparedJavaScript>>
+      preparedWorklets_;
+  std::shared_ptr<const jsi::PreparedJavaScript> preparedValueUnpacker_;
+};
+
+} // namespace worklets
@@ -2,6 +2,7 @@
 #include <worklets/Tools/Defs.h>
 #include <worklets/Tools/JSISerializer.h>
 #include <worklets/Tools/JSLogger.h>
+#include <worklets/Tools/RuntimeLockScope.h>
 #include <worklets/Tools/WorkletsJSIUtils.h>
 #include <worklets/WorkletRuntime/WorkletRuntime.h>
 #include <worklets/WorkletRuntime/WorkletRuntimeCollector.h>
@@ -11,7 +12,10 @@
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
 #include <utility>
 
 #if JS_RUNTIME_HERMES
@@ -22,22 +26,6 @@
 
 namespace worklets {
 
-class AroundLock {
-  const std::shared_ptr<std::recursive_mutex> mutex_;
-
- public:
-  explicit AroundLock(const std::shared_ptr<std::recursive_mutex> &mutex)
-      : mutex_(mutex) {}
-
-  void before() const {
-    mutex_->lock();
-  }
-
-  void after() const {
-    mutex_->unlock();
-  }
-};
-
 class LockableRuntime : public jsi::WithRuntimeDecorator<AroundLock> {
   AroundLock aroundLock_;
   std::shared_ptr<jsi::Runtime> runtime_;
@@ -51,6 +39,8 @@ class LockableRuntime : public jsi::WithRuntimeDecorator<AroundLock> {
         runtime_(std::move(runtime)) {}
 };
 
+static std::atomic<uint64_t> nextGeneration{1};
+
 static std::shared_ptr<jsi::Runtime> makeRuntime(
     const std::shared_ptr<MessageQueueThread> &jsQueue,
     const std::string &name,
@@ -81,8 +71,10 @@ WorkletRuntime::WorkletRuntime(
     const bool supportsLocking,
     const bool isDevBundle,
     const std::shared_ptr<const BigStringBuffer> &script,
-    const std::string &sourceUrl)
+    const std::string &sourceUrl,
+    const std::shared_ptr<WorkletCodeCache> &workletCodeCache)
     : runtimeId_(runtimeId),
+      generation_(nextGeneration.fetch_add(1)),
       runtimeMutex_(std::make_shared<std::recursive_mutex>()),
       runtime_(makeRuntime(jsQueue, name, supportsLocking, runtimeMutex_)),
 #ifndef NDEBUG
@@ -100,7 +92,8 @@ WorkletRuntime::WorkletRuntime(
       name,
       jsScheduler,
       isDevBundle,
-      std::move(optimizedJsiWorkletsModuleProxy));
+      std::move(optimizedJsiWorkletsModuleProxy),
+      workletCodeCache);
 
 #ifdef WORKLETS_BUNDLE_MODE
   if (!script) {
@@ -126,9 +119,8 @@ WorkletRuntime::WorkletRuntime(
   }
 #else
   // Legacy behavior
-  auto valueUnpackerBuffer =
-      std::make_shared<const jsi::StringBuffer>(ValueUnpackerCode);
-  rt.evaluateJavaScript(valueUnpackerBuffer, "valueUnpacker");
+  rt.evaluatePreparedJavaScript(
+      workletCodeCache->getOrPrepareValueUnpacker(rt));
 #endif // WORKLETS_BUNDLE_MODE
 }
 
@@ -174,6 +166,22 @@ jsi::Value WorkletRuntime::get(
   if (name == "name") {
     return jsi::String::createFromUtf8(rt, name_);
   }
+  if (name == "getQueueMetrics") {
+    return jsi::Function::createFromHostFunction(
+        rt,
+        propName,
+        0,
+        [weakThis = weak_from_this()](
+            jsi::Runtime &rt, const jsi::Value &, const jsi::Value *, size_t)
+            -> jsi::Value {
+          auto strongThis = weakThis.lock();
+          if (!strongThis) {
+            return jsi::Value::undefined();
+          }
+
+          return jobQueueMetricsToJSValue(rt, strongThis->getQueueMetrics());
+        });
+  }
   return jsi::Value::undefined();
 }
 
@@ -182,6 +190,7 @@ std::vector<jsi::PropNameID> WorkletRuntime::getPropertyNames(
   std::vector<jsi::PropNameID> result;
   result.push_back(jsi::PropNameID::forUtf8(rt, "toString"));
   result.push_back(jsi::PropNameID::forUtf8(rt, "name"));
+  result.push_back(jsi::PropNameID::forUtf8(rt, "getQueueMetrics"));
   return result;
 }
 
@@ -195,12 +204,87 @@ void scheduleOnRuntime(
     jsi::Runtime &rt,
     const jsi::Value &workletRuntimeValue,
     const jsi::Value &shareableWorkletValue) {
+  scheduleOnRuntime(rt, workletRuntimeValue, shareableWorkletValue, {});
+}
+
+std::shared_ptr<JobHandle> scheduleOnRuntime(
+    jsi::Runtime &rt,
+    const jsi::Value &workletRuntimeValue,
+    const jsi::Value &shareableWorkletValue,
+    const JobOptions &options) {
   auto workletRuntime = extractWorkletRuntime(rt, workletRuntimeValue);
   auto shareableWorklet = extractShareableOrThrow<ShareableWorklet>(
       rt,
       shareableWorkletValue,
       "[Worklets] Function passed to `_scheduleOnRuntime` is not a shareable worklet.");
-  workletRuntime->runAsyncGuarded(shareableWorklet);
+  return workletRuntime->runAsyncGuarded(shareableWorklet, options);
+}
+
+JobOptions parseJobOptions(jsi::Runtime &rt, const jsi::Value &optionsValue) {
+  JobOptions options;
+  if (!optionsValue.isObject()) {
+    return options;
+  }
+
+  const auto optionsObject = optionsValue.asObject(rt);
+
+  const auto priorityValue = optionsObject.getProperty(rt, "priority");
+  if (priorityValue.isString()) {
+    const auto priority = priorityValue.asString(rt).utf8(rt);
+    if (priority == "high") {
+      options.priority = JobPriority::High;
+    } else if (priority == "low") {
+      options.priority = JobPriority::Low;
+    } else if (priority != "normal") {
+      throw std::invalid_argument(
+          "[Worklets] Unknown job priority: \"" + priority + "\".");
+    }
+  }
+
+  const auto timeoutValue = optionsObject.getProperty(rt, "timeout");
+  if (timeoutValue.isNumber()) {
+    const auto timeout = std::chrono::duration<double, std::milli>(
+        timeoutValue.asNumber());
+    options.deadline = JobClock::now() +
+        std::chrono::duration_cast<JobClock::duration>(timeout);
+  }
+
+  return options;
+}
+
+jsi::Value jobHandleToJSValue(
+    jsi::Runtime &rt,
+    const std::shared_ptr<JobHandle> &handle) {
+  jsi::Object jobHandle(rt);
+  jobHandle.setProperty(
+      rt,
+      "cancel",
+      jsi::Function::createFromHostFunction(
+          rt,
+          jsi::PropNameID::forAscii(rt, "cancel"),
+          0,
+          [handle](
+              jsi::Runtime &, const jsi::Value &, const jsi::Value *, size_t) {
+            handle->cancel();
+            return jsi::Value::undefined();
+          }));
+  return jobHandle;
+}
+
+jsi::Value jobQueueMetricsToJSValue(
+    jsi::Runtime &rt,
+    const JobQueueMetrics &metrics) {
+  jsi::Object result(rt);
+  result.setProperty(rt, "depth", static_cast<double>(metrics.depth));
+  result.setProperty(
+      rt, "executedJobs", static_cast<double>(metrics.executedJobs));
+  result.setProperty(
+      rt, "cancelledJobs", static_cast<double>(metrics.cancelledJobs));
+  result.setProperty(
+      rt, "expiredJobs", static_cast<double>(metrics.expiredJobs));
+  result.setProperty(rt, "averageWaitMs", metrics.averageWaitMs);
+  result.setProperty(rt, "maxWaitMs", metrics.maxWaitMs);
+  return result;
 }
 
 } // namespace worklets
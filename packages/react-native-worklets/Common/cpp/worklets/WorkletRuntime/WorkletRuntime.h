@@ -7,6 +7,9 @@
 #include <worklets/SharedItems/Shareables.h>
 #include <worklets/Tools/AsyncQueue.h>
 #include <worklets/Tools/JSScheduler.h>
+#include <worklets/Tools/RuntimeLockScope.h>
+#include <worklets/Tools/UIScheduler.h>
+#include <worklets/WorkletRuntime/WorkletCodeCache.h>
 
 #include <memory>
 #include <string>
@@ -30,7 +33,8 @@ class WorkletRuntime : public jsi::HostObject,
       const bool supportsLocking,
       const bool isDevBundle,
       const std::shared_ptr<const BigStringBuffer> &script,
-      const std::string &sourceUrl);
+      const std::string &sourceUrl,
+      const std::shared_ptr<WorkletCodeCache> &workletCodeCache);
 
   jsi::Runtime &getJSIRuntime() const {
     return *runtime_;
@@ -45,23 +49,52 @@ class WorkletRuntime : public jsi::HostObject,
         rt, shareableWorklet->toJSValue(rt), std::forward<Args>(args)...);
   }
 
-  void runAsyncGuarded(
-      const std::shared_ptr<ShareableWorklet> &shareableWorklet) {
+  std::shared_ptr<JobHandle> runAsyncGuarded(
+      const std::shared_ptr<ShareableWorklet> &shareableWorklet,
+      const JobOptions &options = {}) {
     if (queue_ == nullptr) {
       queue_ = std::make_shared<AsyncQueue>(name_);
     }
-    queue_->push([=, weakThis = weak_from_this()] {
-      auto strongThis = weakThis.lock();
-      if (!strongThis) {
-        return;
-      }
-
-      strongThis->runGuarded(shareableWorklet);
-    });
+    return queue_->push(
+        [=, weakThis = weak_from_this()] {
+          auto strongThis = weakThis.lock();
+          if (!strongThis) {
+            return;
+          }
+
+          strongThis->runGuarded(shareableWorklet);
+        },
+        options);
+  }
+
+  // Jobs of the UI runtime are queued in the UI scheduler instead of its own
+  // queue, so its metrics are reported instead
+  void setUIScheduler(const std::weak_ptr<UIScheduler> &uiScheduler) {
+    uiScheduler_ = uiScheduler;
+  }
+
+  JobQueueMetrics getQueueMetrics() const {
+    if (const auto uiScheduler = uiScheduler_.lock()) {
+      return uiScheduler->getMetrics();
+    }
+    if (queue_ == nullptr) {
+      return {};
+    }
+    return queue_->getMetrics();
   }
 
   jsi::Value executeSync(jsi::Runtime &rt, const jsi::Value &worklet) const;
 
+  // Locks the runtime until the returned scope is destroyed. JSI calls made
+  // on this thread in the meantime don't lock the runtime one by one.
+  [[nodiscard]] RuntimeLockScope lockScope() const {
+    return RuntimeLockScope(*runtimeMutex_);
+  }
+
+  [[nodiscard]] std::shared_ptr<std::recursive_mutex> getRuntimeMutex() const {
+    return runtimeMutex_;
+  }
+
   std::string toString() const {
     return "[WorkletRuntime \"" + name_ + "\"]";
   }
@@ -78,8 +111,16 @@ class WorkletRuntime : public jsi::HostObject,
     return name_;
   }
 
+  // Unique among all the runtimes created by the process, unlike the runtime
+  // id, which is reused by the runtimes created after a reload, and the
+  // address of the JSI runtime, which can be reused too.
+  [[nodiscard]] auto getGeneration() const -> uint64_t {
+    return generation_;
+  }
+
  private:
   const uint64_t runtimeId_;
+  const uint64_t generation_;
   const std::shared_ptr<std::recursive_mutex> runtimeMutex_;
   const std::shared_ptr<jsi::Runtime> runtime_;
 #ifndef NDEBUG
@@ -87,6 +128,7 @@ class WorkletRuntime : public jsi::HostObject,
 #endif
   const std::string name_;
   std::shared_ptr<AsyncQueue> queue_;
+  std::weak_ptr<UIScheduler> uiScheduler_;
 };
 
 // This function needs to be non-inline to avoid problems with dynamic_cast on
@@ -100,4 +142,23 @@ void scheduleOnRuntime(
     const jsi::Value &workletRuntimeValue,
     const jsi::Value &shareableWorkletValue);
 
+std::shared_ptr<JobHandle> scheduleOnRuntime(
+    jsi::Runtime &rt,
+    const jsi::Value &workletRuntimeValue,
+    const jsi::Value &shareableWorkletValue,
+    const JobOptions &options);
+
+// Parses `{ priority?: 'high' | 'normal' | 'low', timeout?: number }` where
+// `timeout` is the number of milliseconds after which the job is dropped if
+// it hasn't started yet.
+JobOptions parseJobOptions(jsi::Runtime &rt, const jsi::Value &optionsValue);
+
+jsi::Value jobHandleToJSValue(
+    jsi::Runtime &rt,
+    const std::shared_ptr<JobHandle> &handle);
+
+jsi::Value jobQueueMetricsToJSValue(
+    jsi::Runtime &rt,
+    const JobQueueMetrics &metrics);
+
 } // namespace worklets
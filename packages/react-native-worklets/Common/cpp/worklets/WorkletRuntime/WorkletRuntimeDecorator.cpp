@@ -42,7 +42,8 @@ void WorkletRuntimeDecorator::decorate(
     const std::string &name,
     const std::shared_ptr<JSScheduler> &jsScheduler,
     const bool isDevBundle,
-    jsi::Object &&jsiWorkletsModuleProxy) {
+    jsi::Object &&jsiWorkletsModuleProxy,
+    const std::shared_ptr<WorkletCodeCache> &workletCodeCache) {
   // resolves "ReferenceError: Property 'global' doesn't exist at ..."
   rt.global().setProperty(rt, "global", rt.global());
 
@@ -82,6 +83,18 @@ void WorkletRuntimeDecorator::decorate(
           evalWithSourceUrl));
 #endif // NDEBUG
 
+  jsi_utils::installJsiFunction(
+      rt,
+      "_evalWorklet",
+      [workletCodeCache](
+          jsi::Runtime &rt, const jsi::Value &code, const jsi::Value &hash) {
+        const auto preparedWorklet = workletCodeCache->getOrPrepareWorklet(
+            rt,
+            static_cast<uint64_t>(hash.asNumber()),
+            code.asString(rt).utf8(rt));
+        return rt.evaluatePreparedJavaScript(preparedWorklet);
+      });
+
   jsi_utils::installJsiFunction(
       rt, "_log", [](jsi::Runtime &rt, const jsi::Value &value) {
         PlatformLogger::log(stringifyJSIValue(rt, value));
@@ -244,14 +257,28 @@ void WorkletRuntimeDecorator::decorate(
         });
       });
 
-  jsi_utils::installJsiFunction(
+  // Options are optional, so the function can't be installed with
+  // installJsiFunction, which expects a fixed number of arguments
+  auto scheduleOnRuntimeFunction = [](jsi::Runtime &rt,
+                                      const jsi::Value &,
+                                      const jsi::Value *args,
+                                      size_t count) -> jsi::Value {
+    if (count < 3 || args[2].isUndefined()) {
+      scheduleOnRuntime(rt, args[0], args[1]);
+      return jsi::Value::undefined();
+    }
+    auto handle =
+        scheduleOnRuntime(rt, args[0], args[1], parseJobOptions(rt, args[2]));
+    return jobHandleToJSValue(rt, handle);
+  };
+  rt.global().setProperty(
       rt,
       "_scheduleOnRuntime",
-      [](jsi::Runtime &rt,
-         const jsi::Value &workletRuntimeValue,
-         const jsi::Value &shareableWorkletValue) {
-        scheduleOnRuntime(rt, workletRuntimeValue, shareableWorkletValue);
-      });
+      jsi::Function::createFromHostFunction(
+          rt,
+          jsi::PropNameID::forAscii(rt, "_scheduleOnRuntime"),
+          2,
+          scheduleOnRuntimeFunction));
 
   jsi::Object performance(rt);
   performance.setProperty(
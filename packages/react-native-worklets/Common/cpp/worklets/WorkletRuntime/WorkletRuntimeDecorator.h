@@ -1,6 +1,7 @@
 #pragma once
 
 #include <worklets/Tools/JSScheduler.h>
+#include <worklets/WorkletRuntime/WorkletCodeCache.h>
 
 #include <jsi/jsi.h>
 
@@ -18,7 +19,8 @@ class WorkletRuntimeDecorator {
       const std::string &name,
       const std::shared_ptr<JSScheduler> &jsScheduler,
       const bool isDevBundle,
-      jsi::Object &&jsiWorkletsModuleProxy);
+      jsi::Object &&jsiWorkletsModuleProxy,
+      const std::shared_ptr<WorkletCodeCache> &workletCodeCache);
 };
 
 } // namespace worklets
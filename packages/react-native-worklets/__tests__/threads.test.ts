@@ -0,0 +1,140 @@
+import { runOnRuntime } from '../src/runtimes';
+import { executeOnUIRuntimeAsync, runOnUI } from '../src/threads';
+import { WorkletsModule } from '../src/WorkletsModule';
+import type { WorkletRuntime } from '../src/workletTypes';
+
+jest.mock('../src/WorkletsModule', () => ({
+  WorkletsModule: {
+    executeOnUIRuntimeAsync: jest.fn(),
+    scheduleOnUI: jest.fn(),
+    scheduleOnRuntime: jest.fn(),
+  },
+}));
+
+const executeOnUIRuntimeAsyncMock =
+  WorkletsModule.executeOnUIRuntimeAsync as jest.Mock;
+const scheduleOnUIMock = WorkletsModule.scheduleOnUI as jest.Mock;
+const scheduleOnRuntimeMock = WorkletsModule.scheduleOnRuntime as jest.Mock;
+
+describe('executeOnUIRuntimeAsync', () => {
+  beforeEach(() => {
+    // In Jest shareables are the values themselves, so the native module
+    // receives a function that runs the worklet with the captured arguments.
+    executeOnUIRuntimeAsyncMock.mockReset();
+    executeOnUIRuntimeAsyncMock.mockImplementation(
+      (worklet: () => unknown) => {
+        try {
+          return Promise.resolve(worklet());
+        } catch (error) {
+          return Promise.reject(error);
+        }
+      }
+    );
+  });
+
+  test('resolves with the result of the worklet', async () => {
+    const add = (a: number, b: number) => {
+      'worklet';
+      return a + b;
+    };
+
+    await expect(executeOnUIRuntimeAsync(add)(2, 3)).resolves.toBe(5);
+    expect(executeOnUIRuntimeAsyncMock).toHaveBeenCalledTimes(1);
+  });
+
+  test('passes the arguments of every call separately', async () => {
+    const identity = (value: string) => {
+      'worklet';
+      return value;
+    };
+    const run = executeOnUIRuntimeAsync(identity);
+
+    const results = await Promise.all([run('a'), run('b')]);
+
+    expect(results).toEqual(['a', 'b']);
+    expect(executeOnUIRuntimeAsyncMock).toHaveBeenCalledTimes(2);
+  });
+
+  test('does not call the worklet before the module runs it', () => {
+    const worklet = jest.fn();
+    executeOnUIRuntimeAsyncMock.mockImplementation(
+      () => new Promise(() => {})
+    );
+
+    void executeOnUIRuntimeAsync(worklet)();
+
+    expect(worklet).not.toHaveBeenCalled();
+  });
+
+  test('rejects with the error thrown by the worklet', async () => {
+    const fail = () => {
+      'worklet';
+      throw new Error('Worklet failed');
+    };
+
+    await expect(executeOnUIRuntimeAsync(fail)()).rejects.toThrow(
+      'Worklet failed'
+    );
+  });
+});
+
+describe('job options', () => {
+  const jobHandle = { cancel: jest.fn() };
+
+  beforeEach(() => {
+    scheduleOnUIMock.mockReset();
+    scheduleOnUIMock.mockReturnValue(jobHandle);
+    scheduleOnRuntimeMock.mockReset();
+    scheduleOnRuntimeMock.mockReturnValue(jobHandle);
+  });
+
+  test('runOnUI forwards the options and returns the job handle', () => {
+    const worklet = jest.fn();
+    const options = { priority: 'high', timeout: 100 } as const;
+
+    const handle = runOnUI(() => {
+      'worklet';
+      worklet();
+    }, options)();
+
+    expect(handle).toBe(jobHandle);
+    expect(scheduleOnUIMock).toHaveBeenCalledTimes(1);
+    expect(scheduleOnUIMock).toHaveBeenCalledWith(
+      expect.any(Function),
+      options
+    );
+
+    // In Jest shareables are the values themselves
+    scheduleOnUIMock.mock.calls[0][0]();
+    expect(worklet).toHaveBeenCalledTimes(1);
+  });
+
+  test('runOnUI schedules without options when none are passed', () => {
+    runOnUI(() => {
+      'worklet';
+    })();
+
+    expect(scheduleOnUIMock).toHaveBeenCalledTimes(1);
+    expect(scheduleOnUIMock.mock.calls[0]).toHaveLength(1);
+  });
+
+  test('runOnRuntime forwards the options and returns the job handle', () => {
+    const workletRuntime = { name: 'test' } as WorkletRuntime;
+    const options = { priority: 'low' } as const;
+
+    const handle = runOnRuntime(
+      workletRuntime,
+      () => {
+        'worklet';
+      },
+      options
+    )();
+
+    expect(handle).toBe(jobHandle);
+    expect(scheduleOnRuntimeMock).toHaveBeenCalledWith(
+      workletRuntime,
+      expect.any(Function),
+      options
+    );
+  });
+});
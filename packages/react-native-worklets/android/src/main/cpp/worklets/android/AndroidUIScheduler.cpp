@@ -14,8 +14,8 @@ class UISchedulerWrapper : public UIScheduler {
       jni::global_ref<AndroidUIScheduler::javaobject> androidUiScheduler)
       : androidUiScheduler_(androidUiScheduler) {}
 
-  void scheduleOnUI(std::function<void()> job) override {
-    UIScheduler::scheduleOnUI(job);
+ protected:
+  void requestTriggerUI() override {
     if (!scheduledOnUI_) {
       scheduledOnUI_ = true;
       androidUiScheduler_->cthis()->scheduleTriggerOnUI();
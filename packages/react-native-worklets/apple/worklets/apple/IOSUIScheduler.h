@@ -9,6 +9,9 @@ using namespace worklets;
 class IOSUIScheduler : public UIScheduler {
  public:
   void scheduleOnUI(std::function<void()> job) override;
+
+ protected:
+  void requestTriggerUI() override;
 };
 
 } // namespace worklets
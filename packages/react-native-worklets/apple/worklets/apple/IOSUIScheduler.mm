@@ -13,7 +13,10 @@ void IOSUIScheduler::scheduleOnUI(std::function<void()> job)
   }
 
   UIScheduler::scheduleOnUI(job);
+}
 
+void IOSUIScheduler::requestTriggerUI()
+{
   if (!scheduledOnUI_) {
     dispatch_async(dispatch_get_main_queue(), ^{
       triggerUI();
@@ -3,7 +3,13 @@
 import { mockedRequestAnimationFrame } from '../animationFrameQueue/mockedRequestAnimationFrame';
 import { IS_JEST } from '../PlatformChecker';
 import { WorkletsError } from '../WorkletsError';
-import type { ShareableRef, WorkletRuntime } from '../workletTypes';
+import type {
+  JobHandle,
+  JobOptions,
+  JobQueueMetrics,
+  ShareableRef,
+  WorkletRuntime,
+} from '../workletTypes';
 import type { IWorkletsModule } from './workletsModuleProxy';
 
 export function createJSWorkletsModule(): IWorkletsModule {
@@ -123,12 +129,42 @@ class JSWorklets implements IWorkletsModule {
     );
   }
 
-  scheduleOnUI<TValue>(worklet: ShareableRef<TValue>) {
+  scheduleOnUI<TValue>(
+    worklet: ShareableRef<TValue>,
+    options?: JobOptions
+  ): JobHandle | undefined {
     // TODO: `requestAnimationFrame` should be used exclusively in Reanimated
 
-    // @ts-ignore web implementation has still not been updated after the rewrite,
-    // this will be addressed once the web implementation updates are ready
-    requestAnimationFrameImpl(worklet);
+    if (options === undefined) {
+      // @ts-ignore web implementation has still not been updated after the rewrite,
+      // this will be addressed once the web implementation updates are ready
+      requestAnimationFrameImpl(worklet);
+      return undefined;
+    }
+
+    // There is no queue of UI jobs on web, so priorities don't apply
+    let isCancelled = false;
+    const deadline =
+      options.timeout === undefined
+        ? Infinity
+        : performance.now() + options.timeout;
+    requestAnimationFrameImpl((timestamp: number) => {
+      if (!isCancelled && performance.now() <= deadline) {
+        // @ts-ignore See the comment above
+        worklet(timestamp);
+      }
+    });
+    return {
+      cancel: () => {
+        isCancelled = true;
+      },
+    };
+  }
+
+  getUIQueueMetrics(): JobQueueMetrics {
+    throw new WorkletsError(
+      '`getUIQueueMetrics` is not available in JSWorklets.'
+    );
   }
 
   executeOnUIRuntimeSync<T, R>(_shareable: ShareableRef<T>): R {
@@ -137,6 +173,12 @@ class JSWorklets implements IWorkletsModule {
     );
   }
 
+  executeOnUIRuntimeAsync<T, R>(_shareable: ShareableRef<T>): Promise<R> {
+    throw new WorkletsError(
+      '`executeOnUIRuntimeAsync` is not available in JSWorklets.'
+    );
+  }
+
   createWorkletRuntime(
     _name: string,
     _initializer: ShareableRef<() => void>
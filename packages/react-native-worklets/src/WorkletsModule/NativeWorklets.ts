@@ -2,7 +2,11 @@
 
 import { WorkletsTurboModule } from '../specs';
 import { WorkletsError } from '../WorkletsError';
-import type { ShareableRef, WorkletRuntime } from '../workletTypes';
+import type {
+  JobOptions,
+  ShareableRef,
+  WorkletRuntime,
+} from '../workletTypes';
 import type {
   IWorkletsModule,
   WorkletsModuleProxy,
@@ -136,8 +140,17 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
     );
   }
 
-  scheduleOnUI<TValue>(shareable: ShareableRef<TValue>) {
-    return this.#workletsModuleProxy.scheduleOnUI(shareable);
+  scheduleOnUI<TValue>(shareable: ShareableRef<TValue>, options?: JobOptions) {
+    // Jobs without options are left to the platform scheduler, which the
+    // native side tells apart by the number of arguments
+    if (options === undefined) {
+      return this.#workletsModuleProxy.scheduleOnUI(shareable);
+    }
+    return this.#workletsModuleProxy.scheduleOnUI(shareable, options);
+  }
+
+  getUIQueueMetrics() {
+    return this.#workletsModuleProxy.getUIQueueMetrics();
   }
 
   executeOnUIRuntimeSync<TValue, TReturn>(
@@ -146,17 +159,31 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
     return this.#workletsModuleProxy.executeOnUIRuntimeSync(shareable);
   }
 
+  executeOnUIRuntimeAsync<TValue, TReturn>(
+    shareable: ShareableRef<TValue>
+  ): Promise<TReturn> {
+    return this.#workletsModuleProxy.executeOnUIRuntimeAsync(shareable);
+  }
+
   createWorkletRuntime(name: string, initializer: ShareableRef<() => void>) {
     return this.#workletsModuleProxy.createWorkletRuntime(name, initializer);
   }
 
   scheduleOnRuntime<T>(
     workletRuntime: WorkletRuntime,
-    shareableWorklet: ShareableRef<T>
+    shareableWorklet: ShareableRef<T>,
+    options?: JobOptions
   ) {
+    if (options === undefined) {
+      return this.#workletsModuleProxy.scheduleOnRuntime(
+        workletRuntime,
+        shareableWorklet
+      );
+    }
     return this.#workletsModuleProxy.scheduleOnRuntime(
       workletRuntime,
-      shareableWorklet
+      shareableWorklet,
+      options
     );
   }
 
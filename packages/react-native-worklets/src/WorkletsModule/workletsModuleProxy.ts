@@ -1,6 +1,12 @@
 'use strict';
 
-import type { ShareableRef, WorkletRuntime } from '../workletTypes';
+import type {
+  JobHandle,
+  JobOptions,
+  JobQueueMetrics,
+  ShareableRef,
+  WorkletRuntime,
+} from '../workletTypes';
 
 /** Type of `__workletsModuleProxy` injected with JSI. */
 export interface WorkletsModuleProxy {
@@ -63,21 +69,33 @@ export interface WorkletsModuleProxy {
     shouldPersistRemote: boolean
   ): ShareableRef<object>;
 
-  scheduleOnUI<TValue>(shareable: ShareableRef<TValue>): void;
+  /** Returns a handle only for jobs scheduled with options. */
+  scheduleOnUI<TValue>(
+    shareable: ShareableRef<TValue>,
+    options?: JobOptions
+  ): JobHandle | undefined;
+
+  getUIQueueMetrics(): JobQueueMetrics;
 
   executeOnUIRuntimeSync<TValue, TReturn>(
     shareable: ShareableRef<TValue>
   ): TReturn;
 
+  executeOnUIRuntimeAsync<TValue, TReturn>(
+    shareable: ShareableRef<TValue>
+  ): Promise<TReturn>;
+
   createWorkletRuntime(
     name: string,
     initializer: ShareableRef<() => void>
   ): WorkletRuntime;
 
+  /** Returns a handle only for jobs scheduled with options. */
   scheduleOnRuntime<TValue>(
     workletRuntime: WorkletRuntime,
-    worklet: ShareableRef<TValue>
-  ): void;
+    worklet: ShareableRef<TValue>,
+    options?: JobOptions
+  ): JobHandle | undefined;
 
   reportFatalErrorOnJS(
     message: string,
@@ -16,7 +16,9 @@ export {
 } from './shareables';
 export {
   callMicrotasks,
+  executeOnUIRuntimeAsync,
   executeOnUIRuntimeSync,
+  getUIQueueMetrics,
   runOnJS,
   runOnUI,
   runOnUIAsync,
@@ -25,6 +27,10 @@ export { isWorkletFunction } from './workletFunction';
 export type { IWorkletsModule, WorkletsModuleProxy } from './WorkletsModule';
 export { WorkletsModule } from './WorkletsModule';
 export type {
+  JobHandle,
+  JobOptions,
+  JobPriority,
+  JobQueueMetrics,
   ShareableRef,
   WorkletFunction,
   WorkletRuntime,
@@ -7,7 +7,7 @@ import type { callGuardDEV } from './callGuard';
 import type { reportFatalRemoteError } from './errors';
 import type { IWorkletsErrorConstructor } from './WorkletsError';
 import type { WorkletsModuleProxy } from './WorkletsModule';
-import type { ValueUnpacker } from './workletTypes';
+import type { JobHandle, JobOptions, ValueUnpacker } from './workletTypes';
 
 declare global {
   /** The only runtime-available require method is `__r` defined by Metro. */
@@ -20,6 +20,9 @@ declare global {
   var evalWithSourceUrl:
     | ((js: string, sourceURL: string) => () => unknown)
     | undefined;
+  var _evalWorklet:
+    | ((js: string, workletHash: number) => () => unknown)
+    | undefined;
   var _toString: (value: unknown) => string;
   var __workletsModuleProxy: WorkletsModuleProxy | undefined;
   var _WORKLET: boolean | undefined;
@@ -61,8 +64,9 @@ declare global {
   var _getAnimationTimestamp: () => number;
   var _scheduleOnRuntime: (
     runtime: WorkletRuntime,
-    worklet: ShareableRef<() => void>
-  ) => void;
+    worklet: ShareableRef<() => void>,
+    options?: JobOptions
+  ) => JobHandle | undefined;
   var _microtaskQueueFinalizers: (() => void)[];
   var WorkletsError: IWorkletsErrorConstructor;
 }
@@ -10,7 +10,12 @@ import {
 import { isWorkletFunction } from './workletFunction';
 import { registerWorkletsError, WorkletsError } from './WorkletsError';
 import { WorkletsModule } from './WorkletsModule';
-import type { WorkletFunction, WorkletRuntime } from './workletTypes';
+import type {
+  JobHandle,
+  JobOptions,
+  WorkletFunction,
+  WorkletRuntime,
+} from './workletTypes';
 
 /**
  * Lets you create a new JS runtime which can be used to run worklets possibly
@@ -52,11 +57,22 @@ export function runOnRuntime<Args extends unknown[], ReturnValue>(
   workletRuntime: WorkletRuntime,
   worklet: (...args: Args) => ReturnValue
 ): WorkletFunction<Args, ReturnValue>;
-/** Schedule a worklet to execute on the background queue. */
+// @ts-expect-error Check `runOnUI` overload.
+export function runOnRuntime<Args extends unknown[], ReturnValue>(
+  workletRuntime: WorkletRuntime,
+  worklet: (...args: Args) => ReturnValue,
+  options: JobOptions
+): (...args: Args) => JobHandle;
+/**
+ * Schedule a worklet to execute on the background queue. With `options`, the
+ * job gets a priority and a timeout and the returned function returns a handle
+ * that cancels it.
+ */
 export function runOnRuntime<Args extends unknown[], ReturnValue>(
   workletRuntime: WorkletRuntime,
-  worklet: WorkletFunction<Args, ReturnValue>
-): (...args: Args) => void {
+  worklet: WorkletFunction<Args, ReturnValue>,
+  options?: JobOptions
+): (...args: Args) => JobHandle | void {
   'worklet';
   if (__DEV__ && !SHOULD_BE_USE_WEB && !isWorkletFunction(worklet)) {
     throw new WorkletsError(
@@ -70,7 +86,8 @@ export function runOnRuntime<Args extends unknown[], ReturnValue>(
         makeShareableCloneOnUIRecursive(() => {
           'worklet';
           worklet(...args);
-        })
+        }),
+        options
       );
   }
   return (...args) =>
@@ -79,6 +96,7 @@ export function runOnRuntime<Args extends unknown[], ReturnValue>(
       makeShareableCloneRecursive(() => {
         'worklet';
         worklet(...args);
-      })
+      }),
+      options
     );
 }
@@ -8,7 +8,13 @@ import {
 import { isWorkletFunction } from './workletFunction';
 import { WorkletsError } from './WorkletsError';
 import { WorkletsModule } from './WorkletsModule';
-import type { WorkletFunction, WorkletImport } from './workletTypes';
+import type {
+  JobHandle,
+  JobOptions,
+  JobQueueMetrics,
+  WorkletFunction,
+  WorkletImport,
+} from './workletTypes';
 
 type UIJob<Args extends unknown[] = unknown[], ReturnValue = unknown> = [
   worklet: WorkletFunction<Args, ReturnValue>,
@@ -68,12 +74,18 @@ export const callMicrotasks = SHOULD_BE_USE_WEB
  * queueMicrotask to schedule all the worklets at once making sure they will run
  * within the same frame boundaries on the UI thread.
  *
+ * Worklets scheduled with `options` aren't batched with other ones, so that
+ * each of them can have its own priority and timeout and can be cancelled
+ * with the returned handle.
+ *
  * @param fun - A reference to a function you want to execute on the [UI
  *   thread](https://docs.swmansion.com/react-native-reanimated/docs/threading/runOnUI)
  *   from the [JavaScript
  *   thread](https://docs.swmansion.com/react-native-reanimated/docs/threading/runOnUI).
+ * @param options - An optional priority and timeout of the job.
  * @returns A function that accepts arguments for the function passed as the
- *   first argument.
+ *   first argument. When `options` are passed, it returns a handle that
+ *   cancels the job.
  * @see https://docs.swmansion.com/react-native-reanimated/docs/threading/runOnUI
  */
 // @ts-expect-error This overload is correct since it's what user sees in his code
@@ -82,9 +94,16 @@ export function runOnUI<Args extends unknown[], ReturnValue>(
   worklet: (...args: Args) => ReturnValue
 ): (...args: Args) => void;
 
+// @ts-expect-error Check the overload above.
 export function runOnUI<Args extends unknown[], ReturnValue>(
-  worklet: WorkletFunction<Args, ReturnValue>
-): (...args: Args) => void {
+  worklet: (...args: Args) => ReturnValue,
+  options: JobOptions
+): (...args: Args) => JobHandle;
+
+export function runOnUI<Args extends unknown[], ReturnValue>(
+  worklet: WorkletFunction<Args, ReturnValue>,
+  options?: JobOptions
+): (...args: Args) => JobHandle | void {
   if (
     __DEV__ &&
     !SHOULD_BE_USE_WEB &&
@@ -93,6 +112,19 @@ export function runOnUI<Args extends unknown[], ReturnValue>(
   ) {
     throw new WorkletsError('`runOnUI` can only be used with worklets.');
   }
+  if (options !== undefined) {
+    return (...args) =>
+      WorkletsModule.scheduleOnUI(
+        makeShareableCloneRecursive(() => {
+          'worklet';
+          worklet(...args);
+          if (!IS_JEST) {
+            callMicrotasks();
+          }
+        }),
+        options
+      ) as JobHandle;
+  }
   return (...args) => {
     if (IS_JEST) {
       // Mocking time in Jest is tricky as both requestAnimationFrame and queueMicrotask
@@ -157,6 +189,39 @@ export function executeOnUIRuntimeSync<Args extends unknown[], ReturnValue>(
   };
 }
 
+// @ts-expect-error This overload is required by our API.
+export function executeOnUIRuntimeAsync<Args extends unknown[], ReturnValue>(
+  worklet: (...args: Args) => ReturnValue
+): (...args: Args) => Promise<ReturnValue>;
+
+/**
+ * Non-blocking counterpart of `executeOnUIRuntimeSync`. Instead of locking the
+ * UI runtime from the JS thread, the worklet is scheduled on the UI thread and
+ * the returned promise resolves with its result. Requests made before the next
+ * UI turn are executed together.
+ */
+export function executeOnUIRuntimeAsync<Args extends unknown[], ReturnValue>(
+  worklet: WorkletFunction<Args, ReturnValue>
+): (...args: Args) => Promise<ReturnValue> {
+  return (...args) => {
+    return WorkletsModule.executeOnUIRuntimeAsync(
+      makeShareableCloneRecursive(() => {
+        'worklet';
+        const result = worklet(...args);
+        return makeShareableCloneOnUIRecursive(result);
+      })
+    );
+  };
+}
+
+/**
+ * Returns the metrics of the queue of jobs scheduled with options on the UI
+ * thread.
+ */
+export function getUIQueueMetrics(): JobQueueMetrics {
+  return WorkletsModule.getUIQueueMetrics();
+}
+
 type ReleaseRemoteFunction<Args extends unknown[], ReturnValue> = {
   (...args: Args): ReturnValue;
 };
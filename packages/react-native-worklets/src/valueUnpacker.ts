@@ -38,8 +38,14 @@ function __valueUnpacker(
           '(' + initData.code + '\n)',
           `worklet_${workletHash}`
         );
+      } else if (global._evalWorklet) {
+        // in release we evaluate the worklet through the native code cache,
+        // so that its code is compiled only once and reused by all runtimes
+        workletFun = global._evalWorklet(
+          '(' + initData.code + '\n)',
+          workletHash
+        );
       } else {
-        // in release we use the regular eval to save on JSI calls
         // eslint-disable-next-line no-eval
         workletFun = eval('(' + initData.code + '\n)');
       }
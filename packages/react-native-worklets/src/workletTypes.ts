@@ -21,6 +21,37 @@ export type FlatShareableRef<T> =
 export type WorkletRuntime = {
   __hostObjectWorkletRuntime: never;
   readonly name: string;
+  getQueueMetrics(): JobQueueMetrics;
+};
+
+export type JobPriority = 'high' | 'normal' | 'low';
+
+export type JobOptions = {
+  /** Queued jobs of a higher priority run before the ones of a lower one. */
+  priority?: JobPriority;
+  /**
+   * Time in milliseconds after which the job is dropped if it hasn't started
+   * yet.
+   */
+  timeout?: number;
+};
+
+/** Returned for jobs scheduled with options. */
+export type JobHandle = {
+  /**
+   * Drops the job if it hasn't started yet. A running job is never
+   * interrupted.
+   */
+  cancel(): void;
+};
+
+export type JobQueueMetrics = {
+  depth: number;
+  executedJobs: number;
+  cancelledJobs: number;
+  expiredJobs: number;
+  averageWaitMs: number;
+  maxWaitMs: number;
 };
 
 export type WorkletStackDetails = [